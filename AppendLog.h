@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+// A sequence that only ever grows, written by one thread and read by any
+// number of others without a lock.
+//
+// Items live in fixed-size chunks that never move once allocated, so a
+// reference to an item stays valid for the life of the log. The writer
+// constructs new items past the end and then publishes the new length with a
+// release store; a reader that loads the length with acquire may read every
+// item below it. Nothing below the published length is ever modified again.
+//
+// The chunk directory is the only thing that is reallocated as the log grows.
+// A reader may still be looking at the old directory, so the old ones are kept
+// until the log itself is destroyed; their total size is below twice the
+// final directory's, which is one pointer per CHUNK_SIZE items.
+template <typename T> class AppendLog {
+public:
+  static const size_t CHUNK_SIZE = 1024;
+
+  AppendLog() : length(0), directory(nullptr), directoryCapacity(0) {}
+
+  ~AppendLog() {
+    size_t n = length.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < n; ++i) {
+      chunks[i / CHUNK_SIZE][i % CHUNK_SIZE].~T();
+    }
+    for (size_t c = 0; c < chunks.size(); ++c) {
+      ::operator delete(chunks[c]);
+    }
+  }
+
+  AppendLog(const AppendLog &) = delete;
+  AppendLog &operator=(const AppendLog &) = delete;
+
+  // --- Writer side: one thread at a time ------------------------------------
+
+  // Appends [first, last) and publishes it in one step: a reader sees either
+  // none of the range or all of it.
+  template <typename It> void Append(It first, It last) {
+    size_t n = length.load(std::memory_order_relaxed);
+    for (; first != last; ++first, ++n) {
+      new (Slot(n)) T(*first);
+    }
+    length.store(n, std::memory_order_release);
+  }
+
+  void Append(const T &item) { Append(&item, &item + 1); }
+
+  // --- Reader side: any thread ----------------------------------------------
+
+  // Number of items published so far.
+  size_t Size() const { return length.load(std::memory_order_acquire); }
+
+  // Item `i`, which must be below a Size() this thread has already read.
+  const T &At(size_t i) const {
+    T *const *dir = directory.load(std::memory_order_acquire);
+    return dir[i / CHUNK_SIZE][i % CHUNK_SIZE];
+  }
+
+private:
+  std::atomic<size_t> length;
+  std::atomic<T **> directory;
+
+  // Writer-only bookkeeping.
+  size_t directoryCapacity;
+  std::vector<T *> chunks;
+  std::vector<std::unique_ptr<T *[]> > directories; // every one published
+
+  // Storage for item `n`, allocating its chunk if needed. The chunk reaches
+  // the directory before the length that makes it visible is published.
+  T *Slot(size_t n) {
+    size_t c = n / CHUNK_SIZE;
+    if (c == chunks.size()) {
+      T *chunk = static_cast<T *>(::operator new(sizeof(T) * CHUNK_SIZE));
+      chunks.push_back(chunk);
+      if (chunks.size() > directoryCapacity) {
+        size_t capacity = directoryCapacity ? directoryCapacity * 2 : 16;
+        std::unique_ptr<T *[]> dir(new T *[capacity]);
+        for (size_t i = 0; i < chunks.size(); ++i) dir[i] = chunks[i];
+        directory.store(dir.get(), std::memory_order_release);
+        directories.push_back(std::move(dir));
+        directoryCapacity = capacity;
+      } else {
+        // Readers index only the chunks below the published length, and this
+        // slot is past it until the release store in Append().
+        directory.load(std::memory_order_relaxed)[c] = chunk;
+      }
+    }
+    return chunks[c] + n % CHUNK_SIZE;
+  }
+};
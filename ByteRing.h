@@ -0,0 +1,89 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+// The last `capacity` bytes of a stream, for saving what was received.
+//
+// Appending costs only the copy of the new bytes: once the ring is full they
+// overwrite the oldest ones in place instead of shifting the whole buffer.
+// Memory is taken as data arrives, up to the capacity, so an idle ring costs
+// nothing. Any thread may append or read; a lock is held for the copy.
+class ByteRing {
+public:
+  explicit ByteRing(size_t capacity) : capacity(capacity), start(0) {}
+
+  ByteRing(const ByteRing &) = delete;
+  ByteRing &operator=(const ByteRing &) = delete;
+
+  void Append(const unsigned char *data, size_t length) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (capacity == 0) return;
+    if (length > capacity) { // only the tail of it can stay
+      data += length - capacity;
+      length = capacity;
+    }
+    if (buffer.size() < capacity) { // still filling: start is 0
+      size_t n = std::min(length, capacity - buffer.size());
+      buffer.insert(buffer.end(), data, data + n);
+      data += n;
+      length -= n;
+    }
+    if (length == 0) return;
+    // Full: the oldest bytes start at `start` and are the ones overwritten.
+    size_t first = std::min(length, capacity - start);
+    std::memcpy(&buffer[start], data, first);
+    std::memcpy(&buffer[0], data + first, length - first);
+    start = (start + length) % capacity;
+  }
+
+  // Keeps the newest bytes that fit the new capacity.
+  void SetCapacity(size_t newCapacity) {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<unsigned char> kept;
+    size_t skip = buffer.size() > newCapacity ? buffer.size() - newCapacity : 0;
+    kept.reserve(buffer.size() - skip);
+    Spans([&](const unsigned char *p, size_t n) {
+      size_t s = std::min(skip, n);
+      kept.insert(kept.end(), p + s, p + n);
+      skip -= s;
+    });
+    buffer.swap(kept);
+    start = 0;
+    capacity = newCapacity;
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<unsigned char>().swap(buffer);
+    start = 0;
+  }
+
+  size_t Size() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return buffer.size();
+  }
+
+  // Calls `f(data, length)` for the one or two contiguous runs that hold the
+  // bytes, oldest first, so they can be written out without a copy. Appends
+  // wait until it returns.
+  template <typename F> void ForEachSpan(F f) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Spans(f);
+  }
+
+private:
+  std::mutex mutex;
+  std::vector<unsigned char> buffer; // grows to capacity, then wraps
+  size_t capacity;
+  size_t start; // oldest byte, once the buffer is full
+
+  template <typename F> void Spans(F &&f) {
+    if (buffer.empty()) return;
+    f(&buffer[start], buffer.size() - start);
+    if (start > 0) f(&buffer[0], start);
+  }
+};
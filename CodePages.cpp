@@ -343,14 +343,23 @@ bool IsKnownCodePage(int codePage) {
   return false;
 }
 
+static const wchar_t *UpperHalfTable(int codePage) {
+  for (size_t i = 0; i < sizeof(kCodePages) / sizeof(kCodePages[0]); ++i) {
+    if (kCodePages[i].id == codePage) return kCodePages[i].table;
+  }
+  return PC437_Map; // printers default to PC437
+}
+
 wchar_t MapCodePageChar(unsigned char c, int codePage) {
   if (c < 0x80) return (wchar_t)c;
-  const wchar_t *table = PC437_Map; // printers default to PC437
-  for (size_t i = 0; i < sizeof(kCodePages) / sizeof(kCodePages[0]); ++i) {
-    if (kCodePages[i].id == codePage) {
-      table = kCodePages[i].table;
-      break;
-    }
+  return UpperHalfTable(codePage)[c - 0x80];
+}
+
+void MapCodePageRun(const unsigned char *src, size_t length, int codePage,
+                    wchar_t *out) {
+  const wchar_t *table = UpperHalfTable(codePage);
+  for (size_t i = 0; i < length; ++i) {
+    unsigned char c = src[i];
+    out[i] = (c < 0x80) ? (wchar_t)c : table[c - 0x80];
   }
-  return table[c - 0x80];
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 // Character code tables selected by ESC t n.
 //
 // A receipt printer holds one 8-bit code page at a time: bytes below 0x80 are
@@ -11,5 +13,11 @@
 // fall back to PC437, which is what printers power up with.
 wchar_t MapCodePageChar(unsigned char c, int codePage);
 
+// Maps a run of `length` bytes into `out`, which must have room for as many
+// characters. Same result as MapCodePageChar byte by byte, but the table is
+// looked up once for the whole run.
+void MapCodePageRun(const unsigned char *src, size_t length, int codePage,
+                    wchar_t *out);
+
 // True when the given ESC t parameter names a code page we have a table for.
 bool IsKnownCodePage(int codePage);
@@ -1,5 +1,6 @@
 #include "FontB10x24.h"
 
+#include <algorithm>
 #include <cstddef>
 
 // Generated by tools/genfont.py - do not edit by hand.
@@ -14,2258 +15,2675 @@
 
 namespace {
 
-struct Glyph {
-  unsigned short code;
-  unsigned short rows[FONT_B_HEIGHT];
-};
-
-// Sorted by code point: FontBGlyph binary searches it.
-const Glyph kGlyphs[] = {
-    // U+0020 SPACE
-    {0x0020, {
+// The rows of every glyph, in code point order. Each glyph starts a 64 byte
+// line of its own and its 24 rows fit in it, so drawing one touches a
+// single cache line; the words past the last row are padding.
+alignas(64) const unsigned short kRows[][32] = {
+    // 0: U+0020 SPACE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0021 EXCLAMATION MARK
-    {0x0021, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 1: U+0021 EXCLAMATION MARK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x030, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x000, 
-     0x000, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0022 QUOTATION MARK
-    {0x0022, {
+     0x000, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 2: U+0022 QUOTATION MARK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x048, 
      0x048, 0x048, 0x048, 0x048, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0023 NUMBER SIGN
-    {0x0023, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 3: U+0023 NUMBER SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x026, 0x024, 0x024, 0x1FF, 0x04C, 0x048, 0x048, 0x3FE, 
-     0x098, 0x090, 0x190, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0024 DOLLAR SIGN
-    {0x0024, {
+     0x098, 0x090, 0x190, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 4: U+0024 DOLLAR SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x010, 0x010, 
      0x078, 0x0D4, 0x0D0, 0x0D0, 0x0F0, 0x07C, 0x01E, 0x016, 
-     0x016, 0x096, 0x07C, 0x010, 0x010, 0x010, 0x000, 0x000, }},
-    // U+0025 PERCENT SIGN
-    {0x0025, {
+     0x016, 0x096, 0x07C, 0x010, 0x010, 0x010, 0x000, 0x000, },
+    // 5: U+0025 PERCENT SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1C0, 
      0x360, 0x360, 0x360, 0x1C6, 0x018, 0x060, 0x18E, 0x01B, 
-     0x01B, 0x01B, 0x00E, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0026 AMPERSAND
-    {0x0026, {
+     0x01B, 0x01B, 0x00E, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 6: U+0026 AMPERSAND
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 
      0x0C0, 0x0C0, 0x0C0, 0x060, 0x0E0, 0x0F6, 0x1B6, 0x1BE, 
-     0x19C, 0x0D8, 0x06C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0027 APOSTROPHE
-    {0x0027, {
+     0x19C, 0x0D8, 0x06C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 7: U+0027 APOSTROPHE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x020, 
      0x020, 0x020, 0x020, 0x020, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0028 LEFT PARENTHESIS
-    {0x0028, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 8: U+0028 LEFT PARENTHESIS
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x00C, 0x008, 
      0x018, 0x018, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x018, 0x018, 0x008, 0x00C, 0x000, 0x000, 0x000, }},
-    // U+0029 RIGHT PARENTHESIS
-    {0x0029, {
+     0x030, 0x018, 0x018, 0x008, 0x00C, 0x000, 0x000, 0x000, },
+    // 9: U+0029 RIGHT PARENTHESIS
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x060, 0x020, 
      0x030, 0x030, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 
-     0x018, 0x030, 0x030, 0x020, 0x060, 0x000, 0x000, 0x000, }},
-    // U+002A ASTERISK
-    {0x002A, {
+     0x018, 0x030, 0x030, 0x020, 0x060, 0x000, 0x000, 0x000, },
+    // 10: U+002A ASTERISK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x010, 
      0x010, 0x092, 0x07C, 0x038, 0x0D6, 0x010, 0x010, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+002B PLUS SIGN
-    {0x002B, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 11: U+002B PLUS SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x030, 0x030, 0x030, 0x030, 0x3FF, 0x3FF, 0x030, 0x030, 
-     0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+002C COMMA
-    {0x002C, {
+     0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 12: U+002C COMMA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x030, 0x030, 0x030, 0x060, 0x040, 0x000, 0x000, 0x000, }},
-    // U+002D HYPHEN-MINUS
-    {0x002D, {
+     0x030, 0x030, 0x030, 0x060, 0x040, 0x000, 0x000, 0x000, },
+    // 13: U+002D HYPHEN-MINUS
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 0x078, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+002E FULL STOP
-    {0x002E, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 14: U+002E FULL STOP
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+002F SOLIDUS
-    {0x002F, {
+     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 15: U+002F SOLIDUS
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x003, 
      0x006, 0x006, 0x00C, 0x00C, 0x018, 0x018, 0x030, 0x030, 
-     0x060, 0x060, 0x0C0, 0x0C0, 0x180, 0x000, 0x000, 0x000, }},
-    // U+0030 DIGIT ZERO
-    {0x0030, {
+     0x060, 0x060, 0x0C0, 0x0C0, 0x180, 0x000, 0x000, 0x000, },
+    // 16: U+0030 DIGIT ZERO
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 
      0x0CC, 0x084, 0x186, 0x186, 0x1B6, 0x1B6, 0x186, 0x186, 
-     0x084, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0031 DIGIT ONE
-    {0x0031, {
+     0x084, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 17: U+0031 DIGIT ONE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x038, 
      0x0D8, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 
-     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0032 DIGIT TWO
-    {0x0032, {
+     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 18: U+0032 DIGIT TWO
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0F8, 
      0x18C, 0x106, 0x006, 0x006, 0x00E, 0x01C, 0x038, 0x070, 
-     0x0E0, 0x1C0, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0033 DIGIT THREE
-    {0x0033, {
+     0x0E0, 0x1C0, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 19: U+0033 DIGIT THREE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0F8, 
      0x10C, 0x006, 0x006, 0x00C, 0x070, 0x00C, 0x006, 0x006, 
-     0x006, 0x10C, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0034 DIGIT FOUR
-    {0x0034, {
+     0x006, 0x10C, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 20: U+0034 DIGIT FOUR
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x00C, 
      0x01C, 0x03C, 0x02C, 0x04C, 0x0CC, 0x08C, 0x10C, 0x1FF, 
-     0x00C, 0x00C, 0x00C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0035 DIGIT FIVE
-    {0x0035, {
+     0x00C, 0x00C, 0x00C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 21: U+0035 DIGIT FIVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0FC, 
      0x0C0, 0x0C0, 0x0C0, 0x0F8, 0x08C, 0x006, 0x006, 0x006, 
-     0x006, 0x10C, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0036 DIGIT SIX
-    {0x0036, {
+     0x006, 0x10C, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 22: U+0036 DIGIT SIX
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 
      0x0C4, 0x0C0, 0x180, 0x1B8, 0x1CC, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0037 DIGIT SEVEN
-    {0x0037, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 23: U+0037 DIGIT SEVEN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1FE, 
      0x006, 0x00C, 0x00C, 0x00C, 0x018, 0x018, 0x018, 0x030, 
-     0x030, 0x030, 0x060, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0038 DIGIT EIGHT
-    {0x0038, {
+     0x030, 0x030, 0x060, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 24: U+0038 DIGIT EIGHT
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 
      0x1CE, 0x186, 0x186, 0x0CC, 0x078, 0x0CC, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0039 DIGIT NINE
-    {0x0039, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 25: U+0039 DIGIT NINE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 
      0x0CC, 0x186, 0x186, 0x186, 0x186, 0x0CE, 0x076, 0x006, 
-     0x00C, 0x08C, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+003A COLON
-    {0x003A, {
+     0x00C, 0x08C, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 26: U+003A COLON
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 
-     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+003B SEMICOLON
-    {0x003B, {
+     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 27: U+003B SEMICOLON
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 
-     0x030, 0x030, 0x030, 0x060, 0x040, 0x000, 0x000, 0x000, }},
-    // U+003C LESS-THAN SIGN
-    {0x003C, {
+     0x030, 0x030, 0x030, 0x060, 0x040, 0x000, 0x000, 0x000, },
+    // 28: U+003C LESS-THAN SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x001, 0x00F, 0x078, 0x1C0, 0x1C0, 0x078, 
-     0x00F, 0x001, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+003D EQUALS SIGN
-    {0x003D, {
+     0x00F, 0x001, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 29: U+003D EQUALS SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x1FF, 0x1FF, 0x000, 0x000, 0x1FF, 
-     0x1FF, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+003E GREATER-THAN SIGN
-    {0x003E, {
+     0x1FF, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 30: U+003E GREATER-THAN SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x100, 0x1E0, 0x03C, 0x007, 0x007, 0x03C, 
-     0x1E0, 0x100, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+003F QUESTION MARK
-    {0x003F, {
+     0x1E0, 0x100, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 31: U+003F QUESTION MARK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07C, 
      0x086, 0x006, 0x00E, 0x01C, 0x038, 0x030, 0x030, 0x030, 
-     0x000, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0040 COMMERCIAL AT
-    {0x0040, {
+     0x000, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 32: U+0040 COMMERCIAL AT
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x03C, 
      0x04E, 0x0C6, 0x09E, 0x19E, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 
-     0x1B6, 0x19E, 0x0DE, 0x0C0, 0x060, 0x038, 0x000, 0x000, }},
-    // U+0041 LATIN CAPITAL LETTER A
-    {0x0041, {
+     0x1B6, 0x19E, 0x0DE, 0x0C0, 0x060, 0x038, 0x000, 0x000, },
+    // 33: U+0041 LATIN CAPITAL LETTER A
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x030, 
      0x030, 0x078, 0x078, 0x078, 0x048, 0x0CC, 0x0CC, 0x0FC, 
-     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0042 LATIN CAPITAL LETTER B
-    {0x0042, {
+     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 34: U+0042 LATIN CAPITAL LETTER B
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1F8, 
      0x186, 0x186, 0x186, 0x18E, 0x1F8, 0x18C, 0x186, 0x186, 
-     0x186, 0x18E, 0x1F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0043 LATIN CAPITAL LETTER C
-    {0x0043, {
+     0x186, 0x18E, 0x1F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 35: U+0043 LATIN CAPITAL LETTER C
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x03C, 
      0x0E2, 0x0C0, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 
-     0x0C0, 0x0E2, 0x03C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0044 LATIN CAPITAL LETTER D
-    {0x0044, {
+     0x0C0, 0x0E2, 0x03C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 36: U+0044 LATIN CAPITAL LETTER D
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1F0, 
      0x18C, 0x184, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x18C, 0x18C, 0x1F0, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0045 LATIN CAPITAL LETTER E
-    {0x0045, {
+     0x18C, 0x18C, 0x1F0, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 37: U+0045 LATIN CAPITAL LETTER E
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1FE, 
      0x180, 0x180, 0x180, 0x180, 0x1FE, 0x180, 0x180, 0x180, 
-     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0046 LATIN CAPITAL LETTER F
-    {0x0046, {
+     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 38: U+0046 LATIN CAPITAL LETTER F
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1FE, 
      0x180, 0x180, 0x180, 0x180, 0x1FC, 0x180, 0x180, 0x180, 
-     0x180, 0x180, 0x180, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0047 LATIN CAPITAL LETTER G
-    {0x0047, {
+     0x180, 0x180, 0x180, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 39: U+0047 LATIN CAPITAL LETTER G
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x03C, 
      0x0C2, 0x0C0, 0x180, 0x180, 0x180, 0x19E, 0x186, 0x186, 
-     0x0C6, 0x0C6, 0x03C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0048 LATIN CAPITAL LETTER H
-    {0x0048, {
+     0x0C6, 0x0C6, 0x03C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 40: U+0048 LATIN CAPITAL LETTER H
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x186, 
      0x186, 0x186, 0x186, 0x186, 0x1FE, 0x186, 0x186, 0x186, 
-     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0049 LATIN CAPITAL LETTER I
-    {0x0049, {
+     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 41: U+0049 LATIN CAPITAL LETTER I
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1FE, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+004A LATIN CAPITAL LETTER J
-    {0x004A, {
+     0x030, 0x030, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 42: U+004A LATIN CAPITAL LETTER J
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07C, 
      0x00C, 0x00C, 0x00C, 0x00C, 0x00C, 0x00C, 0x00C, 0x00C, 
-     0x00C, 0x118, 0x0F0, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+004B LATIN CAPITAL LETTER K
-    {0x004B, {
+     0x00C, 0x118, 0x0F0, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 43: U+004B LATIN CAPITAL LETTER K
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x183, 
      0x186, 0x18C, 0x198, 0x1B0, 0x1F0, 0x1F0, 0x198, 0x19C, 
-     0x18E, 0x186, 0x183, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+004C LATIN CAPITAL LETTER L
-    {0x004C, {
+     0x18E, 0x186, 0x183, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 44: U+004C LATIN CAPITAL LETTER L
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x180, 
      0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 
-     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+004D LATIN CAPITAL LETTER M
-    {0x004D, {
+     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 45: U+004D LATIN CAPITAL LETTER M
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1CE, 
      0x1CE, 0x1CE, 0x1CE, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 0x186, 
-     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+004E LATIN CAPITAL LETTER N
-    {0x004E, {
+     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 46: U+004E LATIN CAPITAL LETTER N
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1C6, 
      0x1C6, 0x1C6, 0x1E6, 0x1A6, 0x1A6, 0x196, 0x196, 0x19E, 
-     0x18E, 0x18E, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+004F LATIN CAPITAL LETTER O
-    {0x004F, {
+     0x18E, 0x18E, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 47: U+004F LATIN CAPITAL LETTER O
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 
      0x0CC, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0050 LATIN CAPITAL LETTER P
-    {0x0050, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 48: U+0050 LATIN CAPITAL LETTER P
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1F8, 
      0x18C, 0x186, 0x186, 0x186, 0x18C, 0x1F8, 0x180, 0x180, 
-     0x180, 0x180, 0x180, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0051 LATIN CAPITAL LETTER Q
-    {0x0051, {
+     0x180, 0x180, 0x180, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 49: U+0051 LATIN CAPITAL LETTER Q
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 
      0x0CC, 0x184, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x184, 0x0CC, 0x078, 0x008, 0x00C, 0x000, 0x000, 0x000, }},
-    // U+0052 LATIN CAPITAL LETTER R
-    {0x0052, {
+     0x184, 0x0CC, 0x078, 0x008, 0x00C, 0x000, 0x000, 0x000, },
+    // 50: U+0052 LATIN CAPITAL LETTER R
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1F8, 
      0x18C, 0x186, 0x186, 0x186, 0x18C, 0x1F8, 0x18C, 0x18C, 
-     0x186, 0x186, 0x183, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0053 LATIN CAPITAL LETTER S
-    {0x0053, {
+     0x186, 0x186, 0x183, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 51: U+0053 LATIN CAPITAL LETTER S
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 
      0x0C4, 0x180, 0x180, 0x1E0, 0x0FC, 0x01E, 0x006, 0x006, 
-     0x006, 0x18E, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0054 LATIN CAPITAL LETTER T
-    {0x0054, {
+     0x006, 0x18E, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 52: U+0054 LATIN CAPITAL LETTER T
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x3FF, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0055 LATIN CAPITAL LETTER U
-    {0x0055, {
+     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 53: U+0055 LATIN CAPITAL LETTER U
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x186, 
      0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0056 LATIN CAPITAL LETTER V
-    {0x0056, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 54: U+0056 LATIN CAPITAL LETTER V
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x186, 
      0x186, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x078, 0x078, 0x078, 
-     0x078, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0057 LATIN CAPITAL LETTER W
-    {0x0057, {
+     0x078, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 55: U+0057 LATIN CAPITAL LETTER W
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x303, 
      0x303, 0x303, 0x1B6, 0x1B6, 0x1B6, 0x1FE, 0x1CE, 0x1CE, 
-     0x1CE, 0x0CC, 0x084, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0058 LATIN CAPITAL LETTER X
-    {0x0058, {
+     0x1CE, 0x0CC, 0x084, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 56: U+0058 LATIN CAPITAL LETTER X
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1CE, 
      0x0CC, 0x0FC, 0x078, 0x030, 0x030, 0x030, 0x078, 0x078, 
-     0x0DC, 0x0CC, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0059 LATIN CAPITAL LETTER Y
-    {0x0059, {
+     0x0DC, 0x0CC, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 57: U+0059 LATIN CAPITAL LETTER Y
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x387, 
      0x186, 0x0CC, 0x0CC, 0x078, 0x078, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+005A LATIN CAPITAL LETTER Z
-    {0x005A, {
+     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 58: U+005A LATIN CAPITAL LETTER Z
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1FE, 
      0x006, 0x00C, 0x01C, 0x018, 0x030, 0x030, 0x060, 0x0E0, 
-     0x0C0, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+005B LEFT SQUARE BRACKET
-    {0x005B, {
+     0x0C0, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 59: U+005B LEFT SQUARE BRACKET
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x03C, 0x030, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x03C, 0x000, 0x000, 0x000, }},
-    // U+005C REVERSE SOLIDUS
-    {0x005C, {
+     0x030, 0x030, 0x030, 0x030, 0x03C, 0x000, 0x000, 0x000, },
+    // 60: U+005C REVERSE SOLIDUS
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x180, 
      0x0C0, 0x0C0, 0x060, 0x060, 0x030, 0x030, 0x018, 0x018, 
-     0x00C, 0x00C, 0x006, 0x006, 0x003, 0x000, 0x000, 0x000, }},
-    // U+005D RIGHT SQUARE BRACKET
-    {0x005D, {
+     0x00C, 0x00C, 0x006, 0x006, 0x003, 0x000, 0x000, 0x000, },
+    // 61: U+005D RIGHT SQUARE BRACKET
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 0x018, 
      0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 
-     0x018, 0x018, 0x018, 0x018, 0x078, 0x000, 0x000, 0x000, }},
-    // U+005E CIRCUMFLEX ACCENT
-    {0x005E, {
+     0x018, 0x018, 0x018, 0x018, 0x078, 0x000, 0x000, 0x000, },
+    // 62: U+005E CIRCUMFLEX ACCENT
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x038, 
      0x028, 0x06C, 0x0C6, 0x183, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+005F LOW LINE
-    {0x005F, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 63: U+005F LOW LINE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x3FF, 0x000, }},
-    // U+0060 GRAVE ACCENT
-    {0x0060, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x3FF, 0x000, },
+    // 64: U+0060 GRAVE ACCENT
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x0C0, 0x060, 0x030, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0061 LATIN SMALL LETTER A
-    {0x0061, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 65: U+0061 LATIN SMALL LETTER A
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x07C, 0x086, 0x006, 0x07E, 0x1C6, 0x186, 
-     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0062 LATIN SMALL LETTER B
-    {0x0062, {
+     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 66: U+0062 LATIN SMALL LETTER B
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x180, 0x180, 
      0x180, 0x180, 0x1B8, 0x1CC, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x1CC, 0x1B8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0063 LATIN SMALL LETTER C
-    {0x0063, {
+     0x186, 0x1CC, 0x1B8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 67: U+0063 LATIN SMALL LETTER C
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x078, 0x0C4, 0x180, 0x180, 0x180, 0x180, 
-     0x180, 0x0C4, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0064 LATIN SMALL LETTER D
-    {0x0064, {
+     0x180, 0x0C4, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 68: U+0064 LATIN SMALL LETTER D
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x006, 0x006, 
      0x006, 0x006, 0x076, 0x0CE, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CE, 0x076, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0065 LATIN SMALL LETTER E
-    {0x0065, {
+     0x186, 0x0CE, 0x076, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 69: U+0065 LATIN SMALL LETTER E
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x078, 0x0CC, 0x186, 0x186, 0x1FE, 0x180, 
-     0x180, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0066 LATIN SMALL LETTER F
-    {0x0066, {
+     0x180, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 70: U+0066 LATIN SMALL LETTER F
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x01E, 0x030, 
      0x030, 0x030, 0x0FE, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0067 LATIN SMALL LETTER G
-    {0x0067, {
+     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 71: U+0067 LATIN SMALL LETTER G
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x076, 0x0CE, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CE, 0x076, 0x006, 0x006, 0x08C, 0x078, 0x000, }},
-    // U+0068 LATIN SMALL LETTER H
-    {0x0068, {
+     0x186, 0x0CE, 0x076, 0x006, 0x006, 0x08C, 0x078, 0x000, },
+    // 72: U+0068 LATIN SMALL LETTER H
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x180, 0x180, 
      0x180, 0x180, 0x1BC, 0x1CE, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0069 LATIN SMALL LETTER I
-    {0x0069, {
+     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 73: U+0069 LATIN SMALL LETTER I
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x018, 0x018, 
      0x000, 0x000, 0x078, 0x018, 0x018, 0x018, 0x018, 0x018, 
-     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+006A LATIN SMALL LETTER J
-    {0x006A, {
+     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 74: U+006A LATIN SMALL LETTER J
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x018, 0x018, 
      0x000, 0x000, 0x0F8, 0x018, 0x018, 0x018, 0x018, 0x018, 
-     0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x0F0, 0x000, }},
-    // U+006B LATIN SMALL LETTER K
-    {0x006B, {
+     0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x0F0, 0x000, },
+    // 75: U+006B LATIN SMALL LETTER K
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x180, 0x180, 
      0x180, 0x180, 0x18E, 0x19C, 0x1B8, 0x1F0, 0x1F0, 0x1F8, 
-     0x198, 0x19C, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+006C LATIN SMALL LETTER L
-    {0x006C, {
+     0x198, 0x19C, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 76: U+006C LATIN SMALL LETTER L
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1F0, 0x030, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x01E, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+006D LATIN SMALL LETTER M
-    {0x006D, {
+     0x030, 0x030, 0x01E, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 77: U+006D LATIN SMALL LETTER M
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x1EC, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 
-     0x1B6, 0x1B6, 0x1B6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+006E LATIN SMALL LETTER N
-    {0x006E, {
+     0x1B6, 0x1B6, 0x1B6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 78: U+006E LATIN SMALL LETTER N
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x1BC, 0x1CE, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+006F LATIN SMALL LETTER O
-    {0x006F, {
+     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 79: U+006F LATIN SMALL LETTER O
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x078, 0x0CC, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0070 LATIN SMALL LETTER P
-    {0x0070, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 80: U+0070 LATIN SMALL LETTER P
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x1B8, 0x1CC, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x1CC, 0x1B8, 0x180, 0x180, 0x180, 0x180, 0x000, }},
-    // U+0071 LATIN SMALL LETTER Q
-    {0x0071, {
+     0x186, 0x1CC, 0x1B8, 0x180, 0x180, 0x180, 0x180, 0x000, },
+    // 81: U+0071 LATIN SMALL LETTER Q
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x076, 0x0CE, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CE, 0x076, 0x006, 0x006, 0x006, 0x006, 0x000, }},
-    // U+0072 LATIN SMALL LETTER R
-    {0x0072, {
+     0x186, 0x0CE, 0x076, 0x006, 0x006, 0x006, 0x006, 0x000, },
+    // 82: U+0072 LATIN SMALL LETTER R
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x06E, 0x071, 0x070, 0x060, 0x060, 0x060, 
-     0x060, 0x060, 0x060, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0073 LATIN SMALL LETTER S
-    {0x0073, {
+     0x060, 0x060, 0x060, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 83: U+0073 LATIN SMALL LETTER S
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x07C, 0x182, 0x180, 0x1F8, 0x0FE, 0x00E, 
-     0x006, 0x106, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0074 LATIN SMALL LETTER T
-    {0x0074, {
+     0x006, 0x106, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 84: U+0074 LATIN SMALL LETTER T
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x030, 
      0x030, 0x030, 0x0FE, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x01E, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0075 LATIN SMALL LETTER U
-    {0x0075, {
+     0x030, 0x030, 0x01E, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 85: U+0075 LATIN SMALL LETTER U
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x1CE, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0076 LATIN SMALL LETTER V
-    {0x0076, {
+     0x186, 0x1CE, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 86: U+0076 LATIN SMALL LETTER V
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x186, 0x0CC, 0x0CC, 0x0CC, 0x078, 0x078, 
-     0x078, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0077 LATIN SMALL LETTER W
-    {0x0077, {
+     0x078, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 87: U+0077 LATIN SMALL LETTER W
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x303, 0x303, 0x186, 0x1B6, 0x1B6, 0x1B6, 
-     0x0CC, 0x0CC, 0x0CC, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0078 LATIN SMALL LETTER X
-    {0x0078, {
+     0x0CC, 0x0CC, 0x0CC, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 88: U+0078 LATIN SMALL LETTER X
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x1CE, 0x0FC, 0x078, 0x030, 0x030, 0x078, 
-     0x078, 0x0CC, 0x1CE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0079 LATIN SMALL LETTER Y
-    {0x0079, {
+     0x078, 0x0CC, 0x1CE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 89: U+0079 LATIN SMALL LETTER Y
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x186, 0x0CE, 0x0CC, 0x0CC, 0x07C, 0x078, 
-     0x078, 0x038, 0x030, 0x030, 0x070, 0x060, 0x0C0, 0x000, }},
-    // U+007A LATIN SMALL LETTER Z
-    {0x007A, {
+     0x078, 0x038, 0x030, 0x030, 0x070, 0x060, 0x0C0, 0x000, },
+    // 90: U+007A LATIN SMALL LETTER Z
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x1FE, 0x00E, 0x01C, 0x038, 0x030, 0x060, 
-     0x0E0, 0x1C0, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+007B LEFT CURLY BRACKET
-    {0x007B, {
+     0x0E0, 0x1C0, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 91: U+007B LEFT CURLY BRACKET
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x01C, 0x030, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x1C0, 0x070, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x01C, 0x000, 0x000, }},
-    // U+007C VERTICAL LINE
-    {0x007C, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x01C, 0x000, 0x000, },
+    // 92: U+007C VERTICAL LINE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x020, 0x020, 
      0x020, 0x020, 0x020, 0x020, 0x020, 0x020, 0x020, 0x020, 
-     0x020, 0x020, 0x020, 0x020, 0x020, 0x020, 0x020, 0x000, }},
-    // U+007D RIGHT CURLY BRACKET
-    {0x007D, {
+     0x020, 0x020, 0x020, 0x020, 0x020, 0x020, 0x020, 0x000, },
+    // 93: U+007D RIGHT CURLY BRACKET
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E0, 0x030, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x00E, 0x038, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x0E0, 0x000, 0x000, }},
-    // U+007E TILDE
-    {0x007E, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x0E0, 0x000, 0x000, },
+    // 94: U+007E TILDE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x0F1, 0x1FF, 0x10E, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00A0 NO-BREAK SPACE
-    {0x00A0, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 95: U+00A0 NO-BREAK SPACE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00A1 INVERTED EXCLAMATION MARK
-    {0x00A1, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 96: U+00A1 INVERTED EXCLAMATION MARK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x030, 
      0x030, 0x000, 0x000, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00A2 CENT SIGN
-    {0x00A2, {
+     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 97: U+00A2 CENT SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x010, 0x010, 0x078, 0x0D4, 0x190, 0x190, 0x190, 0x190, 
-     0x190, 0x0D4, 0x078, 0x010, 0x010, 0x010, 0x000, 0x000, }},
-    // U+00A3 POUND SIGN
-    {0x00A3, {
+     0x190, 0x0D4, 0x078, 0x010, 0x010, 0x010, 0x000, 0x000, },
+    // 98: U+00A3 POUND SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x01C, 
      0x032, 0x060, 0x060, 0x060, 0x060, 0x1FC, 0x060, 0x060, 
-     0x060, 0x060, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00A4 CURRENCY SIGN
-    {0x00A4, {
+     0x060, 0x060, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 99: U+00A4 CURRENCY SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x081, 0x07E, 0x066, 0x042, 0x042, 0x066, 
-     0x07E, 0x081, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00A5 YEN SIGN
-    {0x00A5, {
+     0x07E, 0x081, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 100: U+00A5 YEN SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x387, 
      0x186, 0x0CC, 0x0C8, 0x1FE, 0x030, 0x030, 0x1FE, 0x030, 
-     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00A6 BROKEN BAR
-    {0x00A6, {
+     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 101: U+00A6 BROKEN BAR
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x020, 
      0x020, 0x020, 0x020, 0x020, 0x020, 0x000, 0x000, 0x020, 
-     0x020, 0x020, 0x020, 0x020, 0x020, 0x000, 0x000, 0x000, }},
-    // U+00A7 SECTION SIGN
-    {0x00A7, {
+     0x020, 0x020, 0x020, 0x020, 0x020, 0x000, 0x000, 0x000, },
+    // 102: U+00A7 SECTION SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x03C, 
      0x060, 0x060, 0x020, 0x078, 0x0CC, 0x0C6, 0x0C6, 0x066, 
-     0x03C, 0x008, 0x00C, 0x00C, 0x078, 0x000, 0x000, 0x000, }},
-    // U+00A8 DIAERESIS
-    {0x00A8, {
+     0x03C, 0x008, 0x00C, 0x00C, 0x078, 0x000, 0x000, 0x000, },
+    // 103: U+00A8 DIAERESIS
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x066, 0x066, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00A9 COPYRIGHT SIGN
-    {0x00A9, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 104: U+00A9 COPYRIGHT SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x078, 0x186, 0x17A, 0x2C1, 0x281, 0x281, 0x2C1, 0x17A, 
-     0x186, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00AA FEMININE ORDINAL INDICATOR
-    {0x00AA, {
+     0x186, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 105: U+00AA FEMININE ORDINAL INDICATOR
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 
      0x004, 0x004, 0x07C, 0x084, 0x08C, 0x074, 0x000, 0x0FC, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00AB LEFT-POINTING DOUBLE ANGLE QUOTATION MARK
-    {0x00AB, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 106: U+00AB LEFT-POINTING DOUBLE ANGLE QUOTATION MARK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x022, 0x066, 0x0CC, 0x198, 0x198, 0x0CC, 
-     0x066, 0x022, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00AC NOT SIGN
-    {0x00AC, {
+     0x066, 0x022, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 107: U+00AC NOT SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x1FF, 0x1FF, 0x003, 0x003, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00AD SOFT HYPHEN
-    {0x00AD, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 108: U+00AD SOFT HYPHEN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 0x078, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00AE REGISTERED SIGN
-    {0x00AE, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 109: U+00AE REGISTERED SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x078, 0x186, 0x17A, 0x249, 0x271, 0x251, 0x249, 0x14E, 
-     0x186, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00AF MACRON
-    {0x00AF, {
+     0x186, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 110: U+00AF MACRON
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07C, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00B0 DEGREE SIGN
-    {0x00B0, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 111: U+00B0 DEGREE SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x070, 
      0x088, 0x088, 0x088, 0x070, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00B1 PLUS-MINUS SIGN
-    {0x00B1, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 112: U+00B1 PLUS-MINUS SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x030, 0x030, 0x030, 0x3FF, 0x3FF, 0x030, 0x030, 
-     0x030, 0x3FF, 0x3FF, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00B2 SUPERSCRIPT TWO
-    {0x00B2, {
+     0x030, 0x3FF, 0x3FF, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 113: U+00B2 SUPERSCRIPT TWO
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 
      0x004, 0x004, 0x008, 0x010, 0x020, 0x07C, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00B3 SUPERSCRIPT THREE
-    {0x00B3, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 114: U+00B3 SUPERSCRIPT THREE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 
      0x004, 0x004, 0x038, 0x004, 0x004, 0x078, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00B4 ACUTE ACCENT
-    {0x00B4, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 115: U+00B4 ACUTE ACCENT
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x00C, 0x018, 0x030, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00B5 MICRO SIGN
-    {0x00B5, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 116: U+00B5 MICRO SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x1CE, 0x1FF, 0x180, 0x180, 0x180, 0x180, 0x000, }},
-    // U+00B6 PILCROW SIGN
-    {0x00B6, {
+     0x186, 0x1CE, 0x1FF, 0x180, 0x180, 0x180, 0x180, 0x000, },
+    // 117: U+00B6 PILCROW SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07E, 
      0x0F2, 0x1F2, 0x1F2, 0x1F2, 0x0F2, 0x072, 0x012, 0x012, 
-     0x012, 0x012, 0x012, 0x012, 0x012, 0x000, 0x000, 0x000, }},
-    // U+00B7 MIDDLE DOT
-    {0x00B7, {
+     0x012, 0x012, 0x012, 0x012, 0x012, 0x000, 0x000, 0x000, },
+    // 118: U+00B7 MIDDLE DOT
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x030, 0x030, 0x030, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00B8 CEDILLA
-    {0x00B8, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 119: U+00B8 CEDILLA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x008, 0x008, 0x038, 0x000, 0x000, }},
-    // U+00B9 SUPERSCRIPT ONE
-    {0x00B9, {
+     0x000, 0x000, 0x000, 0x008, 0x008, 0x038, 0x000, 0x000, },
+    // 120: U+00B9 SUPERSCRIPT ONE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x070, 
      0x010, 0x010, 0x010, 0x010, 0x010, 0x07C, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00BA MASCULINE ORDINAL INDICATOR
-    {0x00BA, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 121: U+00BA MASCULINE ORDINAL INDICATOR
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 
      0x0CC, 0x084, 0x084, 0x084, 0x0CC, 0x078, 0x000, 0x0FC, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00BB RIGHT-POINTING DOUBLE ANGLE QUOTATION MARK
-    {0x00BB, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 122: U+00BB RIGHT-POINTING DOUBLE ANGLE QUOTATION MARK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x088, 0x0CC, 0x066, 0x033, 0x033, 0x066, 
-     0x0CC, 0x088, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00BC VULGAR FRACTION ONE QUARTER
-    {0x00BC, {
+     0x0CC, 0x088, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 123: U+00BC VULGAR FRACTION ONE QUARTER
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1C0, 0x040, 
      0x040, 0x040, 0x040, 0x040, 0x1F6, 0x0F8, 0x300, 0x00C, 
-     0x014, 0x024, 0x024, 0x03E, 0x004, 0x004, 0x000, 0x000, }},
-    // U+00BD VULGAR FRACTION ONE HALF
-    {0x00BD, {
+     0x014, 0x024, 0x024, 0x03E, 0x004, 0x004, 0x000, 0x000, },
+    // 124: U+00BD VULGAR FRACTION ONE HALF
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1C0, 0x040, 
      0x040, 0x040, 0x040, 0x040, 0x1F6, 0x0F8, 0x300, 0x01E, 
-     0x003, 0x001, 0x002, 0x00C, 0x018, 0x01F, 0x000, 0x000, }},
-    // U+00BE VULGAR FRACTION THREE QUARTERS
-    {0x00BE, {
+     0x003, 0x001, 0x002, 0x00C, 0x018, 0x01F, 0x000, 0x000, },
+    // 125: U+00BE VULGAR FRACTION THREE QUARTERS
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1E0, 0x010, 
      0x010, 0x0E0, 0x010, 0x010, 0x1E6, 0x0F8, 0x300, 0x00C, 
-     0x014, 0x024, 0x024, 0x03E, 0x004, 0x004, 0x000, 0x000, }},
-    // U+00BF INVERTED QUESTION MARK
-    {0x00BF, {
+     0x014, 0x024, 0x024, 0x03E, 0x004, 0x004, 0x000, 0x000, },
+    // 126: U+00BF INVERTED QUESTION MARK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x018, 
      0x018, 0x000, 0x018, 0x018, 0x018, 0x038, 0x070, 0x0E0, 
-     0x0C0, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00C0 LATIN CAPITAL LETTER A WITH GRAVE
-    {0x00C0, {
+     0x0C0, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 127: U+00C0 LATIN CAPITAL LETTER A WITH GRAVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x060, 0x030, 0x000, 0x030, 
      0x030, 0x078, 0x078, 0x078, 0x048, 0x0CC, 0x0CC, 0x0FC, 
-     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00C1 LATIN CAPITAL LETTER A WITH ACUTE
-    {0x00C1, {
+     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 128: U+00C1 LATIN CAPITAL LETTER A WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x018, 0x030, 0x000, 0x030, 
      0x030, 0x078, 0x078, 0x078, 0x048, 0x0CC, 0x0CC, 0x0FC, 
-     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00C2 LATIN CAPITAL LETTER A WITH CIRCUMFLEX
-    {0x00C2, {
+     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 129: U+00C2 LATIN CAPITAL LETTER A WITH CIRCUMFLEX
+    {
      0x000, 0x000, 0x000, 0x000, 0x030, 0x048, 0x000, 0x030, 
      0x030, 0x078, 0x078, 0x078, 0x048, 0x0CC, 0x0CC, 0x0FC, 
-     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00C3 LATIN CAPITAL LETTER A WITH TILDE
-    {0x00C3, {
+     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 130: U+00C3 LATIN CAPITAL LETTER A WITH TILDE
+    {
      0x000, 0x000, 0x000, 0x000, 0x068, 0x058, 0x000, 0x030, 
      0x030, 0x078, 0x078, 0x078, 0x048, 0x0CC, 0x0CC, 0x0FC, 
-     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00C4 LATIN CAPITAL LETTER A WITH DIAERESIS
-    {0x00C4, {
+     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 131: U+00C4 LATIN CAPITAL LETTER A WITH DIAERESIS
+    {
      0x000, 0x000, 0x000, 0x0CC, 0x0CC, 0x000, 0x000, 0x030, 
      0x030, 0x078, 0x078, 0x078, 0x048, 0x0CC, 0x0CC, 0x0FC, 
-     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00C5 LATIN CAPITAL LETTER A WITH RING ABOVE
-    {0x00C5, {
+     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 132: U+00C5 LATIN CAPITAL LETTER A WITH RING ABOVE
+    {
      0x000, 0x000, 0x000, 0x030, 0x048, 0x048, 0x048, 0x030, 
      0x030, 0x078, 0x078, 0x078, 0x048, 0x0CC, 0x0CC, 0x0FC, 
-     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00C6 LATIN CAPITAL LETTER AE
-    {0x00C6, {
+     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 133: U+00C6 LATIN CAPITAL LETTER AE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07F, 
      0x078, 0x078, 0x0D8, 0x0D8, 0x0DF, 0x1D8, 0x198, 0x1F8, 
-     0x198, 0x318, 0x31F, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00C7 LATIN CAPITAL LETTER C WITH CEDILLA
-    {0x00C7, {
+     0x198, 0x318, 0x31F, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 134: U+00C7 LATIN CAPITAL LETTER C WITH CEDILLA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x03C, 
      0x0E2, 0x0C0, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 
-     0x0C0, 0x0E2, 0x03C, 0x008, 0x004, 0x01C, 0x000, 0x000, }},
-    // U+00C8 LATIN CAPITAL LETTER E WITH GRAVE
-    {0x00C8, {
+     0x0C0, 0x0E2, 0x03C, 0x008, 0x004, 0x01C, 0x000, 0x000, },
+    // 135: U+00C8 LATIN CAPITAL LETTER E WITH GRAVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x020, 0x030, 0x000, 0x1FE, 
      0x180, 0x180, 0x180, 0x180, 0x1FE, 0x180, 0x180, 0x180, 
-     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00C9 LATIN CAPITAL LETTER E WITH ACUTE
-    {0x00C9, {
+     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 136: U+00C9 LATIN CAPITAL LETTER E WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x018, 0x010, 0x000, 0x1FE, 
      0x180, 0x180, 0x180, 0x180, 0x1FE, 0x180, 0x180, 0x180, 
-     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00CA LATIN CAPITAL LETTER E WITH CIRCUMFLEX
-    {0x00CA, {
+     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 137: U+00CA LATIN CAPITAL LETTER E WITH CIRCUMFLEX
+    {
      0x000, 0x000, 0x000, 0x000, 0x038, 0x024, 0x000, 0x1FE, 
      0x180, 0x180, 0x180, 0x180, 0x1FE, 0x180, 0x180, 0x180, 
-     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00CB LATIN CAPITAL LETTER E WITH DIAERESIS
-    {0x00CB, {
+     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 138: U+00CB LATIN CAPITAL LETTER E WITH DIAERESIS
+    {
      0x000, 0x000, 0x000, 0x066, 0x066, 0x000, 0x000, 0x1FE, 
      0x180, 0x180, 0x180, 0x180, 0x1FE, 0x180, 0x180, 0x180, 
-     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00CC LATIN CAPITAL LETTER I WITH GRAVE
-    {0x00CC, {
+     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 139: U+00CC LATIN CAPITAL LETTER I WITH GRAVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x060, 0x030, 0x000, 0x1FE, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00CD LATIN CAPITAL LETTER I WITH ACUTE
-    {0x00CD, {
+     0x030, 0x030, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 140: U+00CD LATIN CAPITAL LETTER I WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x018, 0x030, 0x000, 0x1FE, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00CE LATIN CAPITAL LETTER I WITH CIRCUMFLEX
-    {0x00CE, {
+     0x030, 0x030, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 141: U+00CE LATIN CAPITAL LETTER I WITH CIRCUMFLEX
+    {
      0x000, 0x000, 0x000, 0x000, 0x030, 0x048, 0x000, 0x1FE, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00CF LATIN CAPITAL LETTER I WITH DIAERESIS
-    {0x00CF, {
+     0x030, 0x030, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 142: U+00CF LATIN CAPITAL LETTER I WITH DIAERESIS
+    {
      0x000, 0x000, 0x000, 0x0CC, 0x0CC, 0x000, 0x000, 0x1FE, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00D0 LATIN CAPITAL LETTER ETH
-    {0x00D0, {
+     0x030, 0x030, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 143: U+00D0 LATIN CAPITAL LETTER ETH
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1F0, 
      0x18C, 0x184, 0x186, 0x186, 0x3E6, 0x186, 0x186, 0x186, 
-     0x184, 0x18C, 0x1F0, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00D1 LATIN CAPITAL LETTER N WITH TILDE
-    {0x00D1, {
+     0x184, 0x18C, 0x1F0, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 144: U+00D1 LATIN CAPITAL LETTER N WITH TILDE
+    {
      0x000, 0x000, 0x000, 0x000, 0x068, 0x058, 0x000, 0x1C6, 
      0x1C6, 0x1C6, 0x1E6, 0x1A6, 0x1A6, 0x196, 0x196, 0x19E, 
-     0x18E, 0x18E, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00D2 LATIN CAPITAL LETTER O WITH GRAVE
-    {0x00D2, {
+     0x18E, 0x18E, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 145: U+00D2 LATIN CAPITAL LETTER O WITH GRAVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x060, 0x030, 0x000, 0x078, 
      0x0CC, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00D3 LATIN CAPITAL LETTER O WITH ACUTE
-    {0x00D3, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 146: U+00D3 LATIN CAPITAL LETTER O WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x018, 0x030, 0x000, 0x078, 
      0x0CC, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00D4 LATIN CAPITAL LETTER O WITH CIRCUMFLEX
-    {0x00D4, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 147: U+00D4 LATIN CAPITAL LETTER O WITH CIRCUMFLEX
+    {
      0x000, 0x000, 0x000, 0x000, 0x030, 0x048, 0x000, 0x078, 
      0x0CC, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00D5 LATIN CAPITAL LETTER O WITH TILDE
-    {0x00D5, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 148: U+00D5 LATIN CAPITAL LETTER O WITH TILDE
+    {
      0x000, 0x000, 0x000, 0x000, 0x068, 0x058, 0x000, 0x078, 
      0x0CC, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00D6 LATIN CAPITAL LETTER O WITH DIAERESIS
-    {0x00D6, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 149: U+00D6 LATIN CAPITAL LETTER O WITH DIAERESIS
+    {
      0x000, 0x000, 0x000, 0x0CC, 0x0CC, 0x000, 0x000, 0x078, 
      0x0CC, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00D7 MULTIPLICATION SIGN
-    {0x00D7, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 150: U+00D7 MULTIPLICATION SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x186, 0x1CE, 0x0FC, 0x078, 0x078, 0x0FC, 
-     0x1CE, 0x084, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00D8 LATIN CAPITAL LETTER O WITH STROKE
-    {0x00D8, {
+     0x1CE, 0x084, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 151: U+00D8 LATIN CAPITAL LETTER O WITH STROKE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07A, 0x0CE, 
      0x18C, 0x18E, 0x196, 0x196, 0x1A6, 0x1A6, 0x1C6, 0x186, 
-     0x1CC, 0x378, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00D9 LATIN CAPITAL LETTER U WITH GRAVE
-    {0x00D9, {
+     0x1CC, 0x378, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 152: U+00D9 LATIN CAPITAL LETTER U WITH GRAVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x060, 0x030, 0x000, 0x186, 
      0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00DA LATIN CAPITAL LETTER U WITH ACUTE
-    {0x00DA, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 153: U+00DA LATIN CAPITAL LETTER U WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x018, 0x030, 0x000, 0x186, 
      0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00DB LATIN CAPITAL LETTER U WITH CIRCUMFLEX
-    {0x00DB, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 154: U+00DB LATIN CAPITAL LETTER U WITH CIRCUMFLEX
+    {
      0x000, 0x000, 0x000, 0x000, 0x030, 0x048, 0x000, 0x186, 
      0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00DC LATIN CAPITAL LETTER U WITH DIAERESIS
-    {0x00DC, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 155: U+00DC LATIN CAPITAL LETTER U WITH DIAERESIS
+    {
      0x000, 0x000, 0x000, 0x0CC, 0x0CC, 0x000, 0x000, 0x186, 
      0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00DD LATIN CAPITAL LETTER Y WITH ACUTE
-    {0x00DD, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 156: U+00DD LATIN CAPITAL LETTER Y WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x018, 0x030, 0x000, 0x387, 
      0x186, 0x0CC, 0x0CC, 0x078, 0x078, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00DE LATIN CAPITAL LETTER THORN
-    {0x00DE, {
+     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 157: U+00DE LATIN CAPITAL LETTER THORN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x180, 
      0x180, 0x1F8, 0x18E, 0x186, 0x186, 0x186, 0x18E, 0x1F8, 
-     0x180, 0x180, 0x180, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00DF LATIN SMALL LETTER SHARP S
-    {0x00DF, {
+     0x180, 0x180, 0x180, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 158: U+00DF LATIN SMALL LETTER SHARP S
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0F8, 0x18C, 
      0x18C, 0x198, 0x1B0, 0x1B0, 0x1B0, 0x198, 0x18C, 0x186, 
-     0x186, 0x1A6, 0x19C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00E0 LATIN SMALL LETTER A WITH GRAVE
-    {0x00E0, {
+     0x186, 0x1A6, 0x19C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 159: U+00E0 LATIN SMALL LETTER A WITH GRAVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x0C0, 0x060, 0x030, 
      0x000, 0x000, 0x07C, 0x086, 0x006, 0x07E, 0x1C6, 0x186, 
-     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00E1 LATIN SMALL LETTER A WITH ACUTE
-    {0x00E1, {
+     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 160: U+00E1 LATIN SMALL LETTER A WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x00C, 0x018, 0x030, 
      0x000, 0x000, 0x07C, 0x086, 0x006, 0x07E, 0x1C6, 0x186, 
-     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00E2 LATIN SMALL LETTER A WITH CIRCUMFLEX
-    {0x00E2, {
+     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 161: U+00E2 LATIN SMALL LETTER A WITH CIRCUMFLEX
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x020, 0x050, 0x088, 
      0x000, 0x000, 0x07C, 0x086, 0x006, 0x07E, 0x1C6, 0x186, 
-     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00E3 LATIN SMALL LETTER A WITH TILDE
-    {0x00E3, {
+     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 162: U+00E3 LATIN SMALL LETTER A WITH TILDE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E8, 0x0B8, 
      0x000, 0x000, 0x07C, 0x086, 0x006, 0x07E, 0x1C6, 0x186, 
-     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00E4 LATIN SMALL LETTER A WITH DIAERESIS
-    {0x00E4, {
+     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 163: U+00E4 LATIN SMALL LETTER A WITH DIAERESIS
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x066, 0x066, 
      0x000, 0x000, 0x07C, 0x086, 0x006, 0x07E, 0x1C6, 0x186, 
-     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00E5 LATIN SMALL LETTER A WITH RING ABOVE
-    {0x00E5, {
+     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 164: U+00E5 LATIN SMALL LETTER A WITH RING ABOVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x038, 0x044, 0x044, 0x044, 
      0x038, 0x000, 0x07C, 0x086, 0x006, 0x07E, 0x1C6, 0x186, 
-     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00E6 LATIN SMALL LETTER AE
-    {0x00E6, {
+     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 165: U+00E6 LATIN SMALL LETTER AE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x0FC, 0x036, 0x036, 0x036, 0x0FE, 0x1B0, 
-     0x1B0, 0x1B0, 0x0FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00E7 LATIN SMALL LETTER C WITH CEDILLA
-    {0x00E7, {
+     0x1B0, 0x1B0, 0x0FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 166: U+00E7 LATIN SMALL LETTER C WITH CEDILLA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x078, 0x0C4, 0x180, 0x180, 0x180, 0x180, 
-     0x180, 0x0C4, 0x078, 0x00C, 0x004, 0x01C, 0x000, 0x000, }},
-    // U+00E8 LATIN SMALL LETTER E WITH GRAVE
-    {0x00E8, {
+     0x180, 0x0C4, 0x078, 0x00C, 0x004, 0x01C, 0x000, 0x000, },
+    // 167: U+00E8 LATIN SMALL LETTER E WITH GRAVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x040, 0x060, 0x030, 
      0x000, 0x000, 0x078, 0x0CC, 0x186, 0x186, 0x1FE, 0x180, 
-     0x180, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00E9 LATIN SMALL LETTER E WITH ACUTE
-    {0x00E9, {
+     0x180, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 168: U+00E9 LATIN SMALL LETTER E WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x00C, 0x018, 0x030, 
      0x000, 0x000, 0x078, 0x0CC, 0x186, 0x186, 0x1FE, 0x180, 
-     0x180, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00EA LATIN SMALL LETTER E WITH CIRCUMFLEX
-    {0x00EA, {
+     0x180, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 169: U+00EA LATIN SMALL LETTER E WITH CIRCUMFLEX
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x030, 0x050, 0x0C8, 
      0x000, 0x000, 0x078, 0x0CC, 0x186, 0x186, 0x1FE, 0x180, 
-     0x180, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00EB LATIN SMALL LETTER E WITH DIAERESIS
-    {0x00EB, {
+     0x180, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 170: U+00EB LATIN SMALL LETTER E WITH DIAERESIS
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x066, 0x066, 
      0x000, 0x000, 0x078, 0x0CC, 0x186, 0x186, 0x1FE, 0x180, 
-     0x180, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00EC LATIN SMALL LETTER I WITH GRAVE
-    {0x00EC, {
+     0x180, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 171: U+00EC LATIN SMALL LETTER I WITH GRAVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x0C0, 0x060, 0x030, 
      0x000, 0x000, 0x078, 0x018, 0x018, 0x018, 0x018, 0x018, 
-     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00ED LATIN SMALL LETTER I WITH ACUTE
-    {0x00ED, {
+     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 172: U+00ED LATIN SMALL LETTER I WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x00C, 0x018, 0x030, 
      0x000, 0x000, 0x078, 0x018, 0x018, 0x018, 0x018, 0x018, 
-     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00EE LATIN SMALL LETTER I WITH CIRCUMFLEX
-    {0x00EE, {
+     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 173: U+00EE LATIN SMALL LETTER I WITH CIRCUMFLEX
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x020, 0x050, 0x088, 
      0x000, 0x000, 0x078, 0x018, 0x018, 0x018, 0x018, 0x018, 
-     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00EF LATIN SMALL LETTER I WITH DIAERESIS
-    {0x00EF, {
+     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 174: U+00EF LATIN SMALL LETTER I WITH DIAERESIS
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x066, 0x066, 
      0x000, 0x000, 0x078, 0x018, 0x018, 0x018, 0x018, 0x018, 
-     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00F0 LATIN SMALL LETTER ETH
-    {0x00F0, {
+     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 175: U+00F0 LATIN SMALL LETTER ETH
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E0, 0x078, 
      0x0F0, 0x038, 0x07C, 0x0CC, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00F1 LATIN SMALL LETTER N WITH TILDE
-    {0x00F1, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 176: U+00F1 LATIN SMALL LETTER N WITH TILDE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E8, 0x0B8, 
      0x000, 0x000, 0x1BC, 0x1CE, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00F2 LATIN SMALL LETTER O WITH GRAVE
-    {0x00F2, {
+     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 177: U+00F2 LATIN SMALL LETTER O WITH GRAVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x0C0, 0x060, 0x030, 
      0x000, 0x000, 0x078, 0x0CC, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00F3 LATIN SMALL LETTER O WITH ACUTE
-    {0x00F3, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 178: U+00F3 LATIN SMALL LETTER O WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x00C, 0x018, 0x030, 
      0x000, 0x000, 0x078, 0x0CC, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00F4 LATIN SMALL LETTER O WITH CIRCUMFLEX
-    {0x00F4, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 179: U+00F4 LATIN SMALL LETTER O WITH CIRCUMFLEX
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x030, 0x030, 0x048, 
      0x000, 0x000, 0x078, 0x0CC, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00F5 LATIN SMALL LETTER O WITH TILDE
-    {0x00F5, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 180: U+00F5 LATIN SMALL LETTER O WITH TILDE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x068, 0x058, 
      0x000, 0x000, 0x078, 0x0CC, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00F6 LATIN SMALL LETTER O WITH DIAERESIS
-    {0x00F6, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 181: U+00F6 LATIN SMALL LETTER O WITH DIAERESIS
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0CC, 0x0CC, 
      0x000, 0x000, 0x078, 0x0CC, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00F7 DIVISION SIGN
-    {0x00F7, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 182: U+00F7 DIVISION SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x030, 0x030, 0x000, 0x1FE, 0x1FE, 0x000, 0x030, 
-     0x030, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00F8 LATIN SMALL LETTER O WITH STROKE
-    {0x00F8, {
+     0x030, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 183: U+00F8 LATIN SMALL LETTER O WITH STROKE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x07A, 0x0CC, 0x18E, 0x196, 0x1B6, 0x1A6, 
-     0x1C6, 0x0CC, 0x178, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00F9 LATIN SMALL LETTER U WITH GRAVE
-    {0x00F9, {
+     0x1C6, 0x0CC, 0x178, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 184: U+00F9 LATIN SMALL LETTER U WITH GRAVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x0C0, 0x060, 0x030, 
      0x000, 0x000, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x1CE, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00FA LATIN SMALL LETTER U WITH ACUTE
-    {0x00FA, {
+     0x186, 0x1CE, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 185: U+00FA LATIN SMALL LETTER U WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x00C, 0x018, 0x030, 
      0x000, 0x000, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x1CE, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00FB LATIN SMALL LETTER U WITH CIRCUMFLEX
-    {0x00FB, {
+     0x186, 0x1CE, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 186: U+00FB LATIN SMALL LETTER U WITH CIRCUMFLEX
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x030, 0x030, 0x048, 
      0x000, 0x000, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x1CE, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00FC LATIN SMALL LETTER U WITH DIAERESIS
-    {0x00FC, {
+     0x186, 0x1CE, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 187: U+00FC LATIN SMALL LETTER U WITH DIAERESIS
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0CC, 0x0CC, 
      0x000, 0x000, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x1CE, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+00FD LATIN SMALL LETTER Y WITH ACUTE
-    {0x00FD, {
+     0x186, 0x1CE, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 188: U+00FD LATIN SMALL LETTER Y WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x00C, 0x018, 0x030, 
      0x000, 0x000, 0x186, 0x0CE, 0x0CC, 0x0CC, 0x07C, 0x078, 
-     0x078, 0x038, 0x030, 0x030, 0x070, 0x060, 0x0C0, 0x000, }},
-    // U+00FE LATIN SMALL LETTER THORN
-    {0x00FE, {
+     0x078, 0x038, 0x030, 0x030, 0x070, 0x060, 0x0C0, 0x000, },
+    // 189: U+00FE LATIN SMALL LETTER THORN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x180, 0x180, 
      0x180, 0x180, 0x1B8, 0x1CC, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x1CC, 0x1B8, 0x180, 0x180, 0x180, 0x180, 0x000, }},
-    // U+00FF LATIN SMALL LETTER Y WITH DIAERESIS
-    {0x00FF, {
+     0x186, 0x1CC, 0x1B8, 0x180, 0x180, 0x180, 0x180, 0x000, },
+    // 190: U+00FF LATIN SMALL LETTER Y WITH DIAERESIS
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x066, 0x066, 
      0x000, 0x000, 0x186, 0x0CE, 0x0CC, 0x0CC, 0x07C, 0x078, 
-     0x078, 0x038, 0x030, 0x030, 0x070, 0x060, 0x0C0, 0x000, }},
-    // U+0102 LATIN CAPITAL LETTER A WITH BREVE
-    {0x0102, {
+     0x078, 0x038, 0x030, 0x030, 0x070, 0x060, 0x0C0, 0x000, },
+    // 191: U+0102 LATIN CAPITAL LETTER A WITH BREVE
+    {
      0x000, 0x000, 0x000, 0x048, 0x030, 0x000, 0x000, 0x030, 
      0x030, 0x078, 0x078, 0x078, 0x048, 0x0CC, 0x0CC, 0x0FC, 
-     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0103 LATIN SMALL LETTER A WITH BREVE
-    {0x0103, {
+     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 192: U+0103 LATIN SMALL LETTER A WITH BREVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x044, 0x038, 0x000, 
      0x000, 0x000, 0x07C, 0x086, 0x006, 0x07E, 0x1C6, 0x186, 
-     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0104 LATIN CAPITAL LETTER A WITH OGONEK
-    {0x0104, {
+     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 193: U+0104 LATIN CAPITAL LETTER A WITH OGONEK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x030, 
      0x030, 0x078, 0x078, 0x078, 0x048, 0x0CC, 0x0CC, 0x0FC, 
-     0x0CC, 0x186, 0x186, 0x004, 0x004, 0x007, 0x000, 0x000, }},
-    // U+0105 LATIN SMALL LETTER A WITH OGONEK
-    {0x0105, {
+     0x0CC, 0x186, 0x186, 0x004, 0x004, 0x007, 0x000, 0x000, },
+    // 194: U+0105 LATIN SMALL LETTER A WITH OGONEK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x07C, 0x086, 0x006, 0x07E, 0x1C6, 0x186, 
-     0x186, 0x18E, 0x0F6, 0x008, 0x008, 0x00E, 0x000, 0x000, }},
-    // U+0106 LATIN CAPITAL LETTER C WITH ACUTE
-    {0x0106, {
+     0x186, 0x18E, 0x0F6, 0x008, 0x008, 0x00E, 0x000, 0x000, },
+    // 195: U+0106 LATIN CAPITAL LETTER C WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x008, 0x010, 0x000, 0x03C, 
      0x0E2, 0x0C0, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 
-     0x0C0, 0x0E2, 0x03C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0107 LATIN SMALL LETTER C WITH ACUTE
-    {0x0107, {
+     0x0C0, 0x0E2, 0x03C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 196: U+0107 LATIN SMALL LETTER C WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x004, 0x008, 0x010, 
      0x000, 0x000, 0x078, 0x0C4, 0x180, 0x180, 0x180, 0x180, 
-     0x180, 0x0C4, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+010C LATIN CAPITAL LETTER C WITH CARON
-    {0x010C, {
+     0x180, 0x0C4, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 197: U+010C LATIN CAPITAL LETTER C WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x024, 0x018, 0x000, 0x03C, 
      0x0E2, 0x0C0, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 
-     0x0C0, 0x0E2, 0x03C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+010D LATIN SMALL LETTER C WITH CARON
-    {0x010D, {
+     0x0C0, 0x0E2, 0x03C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 198: U+010D LATIN SMALL LETTER C WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x048, 0x028, 0x030, 
      0x000, 0x000, 0x078, 0x0C4, 0x180, 0x180, 0x180, 0x180, 
-     0x180, 0x0C4, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+010E LATIN CAPITAL LETTER D WITH CARON
-    {0x010E, {
+     0x180, 0x0C4, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 199: U+010E LATIN CAPITAL LETTER D WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x048, 0x030, 0x000, 0x1F0, 
      0x18C, 0x184, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x18C, 0x18C, 0x1F0, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+010F LATIN SMALL LETTER D WITH CARON
-    {0x010F, {
+     0x18C, 0x18C, 0x1F0, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 200: U+010F LATIN SMALL LETTER D WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x00C, 0x00D, 
      0x00D, 0x00D, 0x0EC, 0x19C, 0x30C, 0x30C, 0x30C, 0x30C, 
-     0x30C, 0x19C, 0x0EC, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0110 LATIN CAPITAL LETTER D WITH STROKE
-    {0x0110, {
+     0x30C, 0x19C, 0x0EC, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 201: U+0110 LATIN CAPITAL LETTER D WITH STROKE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1F0, 
      0x18C, 0x184, 0x186, 0x186, 0x3E6, 0x186, 0x186, 0x186, 
-     0x184, 0x18C, 0x1F0, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0111 LATIN SMALL LETTER D WITH STROKE
-    {0x0111, {
+     0x184, 0x18C, 0x1F0, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 202: U+0111 LATIN SMALL LETTER D WITH STROKE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x00C, 0x00C, 
      0x07F, 0x00C, 0x0EC, 0x19C, 0x30C, 0x30C, 0x30C, 0x30C, 
-     0x30C, 0x19C, 0x0EC, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0118 LATIN CAPITAL LETTER E WITH OGONEK
-    {0x0118, {
+     0x30C, 0x19C, 0x0EC, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 203: U+0118 LATIN CAPITAL LETTER E WITH OGONEK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1FE, 
      0x180, 0x180, 0x180, 0x180, 0x1FE, 0x180, 0x180, 0x180, 
-     0x180, 0x180, 0x1FE, 0x008, 0x008, 0x00E, 0x000, 0x000, }},
-    // U+0119 LATIN SMALL LETTER E WITH OGONEK
-    {0x0119, {
+     0x180, 0x180, 0x1FE, 0x008, 0x008, 0x00E, 0x000, 0x000, },
+    // 204: U+0119 LATIN SMALL LETTER E WITH OGONEK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x078, 0x0CC, 0x186, 0x186, 0x1FE, 0x180, 
-     0x180, 0x0C2, 0x07C, 0x008, 0x010, 0x01C, 0x000, 0x000, }},
-    // U+011A LATIN CAPITAL LETTER E WITH CARON
-    {0x011A, {
+     0x180, 0x0C2, 0x07C, 0x008, 0x010, 0x01C, 0x000, 0x000, },
+    // 205: U+011A LATIN CAPITAL LETTER E WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x024, 0x018, 0x000, 0x1FE, 
      0x180, 0x180, 0x180, 0x180, 0x1FE, 0x180, 0x180, 0x180, 
-     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+011B LATIN SMALL LETTER E WITH CARON
-    {0x011B, {
+     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 206: U+011B LATIN SMALL LETTER E WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x048, 0x050, 0x030, 
      0x000, 0x000, 0x078, 0x0CC, 0x186, 0x186, 0x1FE, 0x180, 
-     0x180, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+011E LATIN CAPITAL LETTER G WITH BREVE
-    {0x011E, {
+     0x180, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 207: U+011E LATIN CAPITAL LETTER G WITH BREVE
+    {
      0x000, 0x000, 0x000, 0x024, 0x03C, 0x000, 0x000, 0x03C, 
      0x0C2, 0x0C0, 0x180, 0x180, 0x180, 0x19E, 0x186, 0x186, 
-     0x0C6, 0x0C6, 0x03C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+011F LATIN SMALL LETTER G WITH BREVE
-    {0x011F, {
+     0x0C6, 0x0C6, 0x03C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 208: U+011F LATIN SMALL LETTER G WITH BREVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x044, 0x038, 0x000, 
      0x000, 0x000, 0x076, 0x0CE, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CE, 0x076, 0x006, 0x006, 0x08C, 0x078, 0x000, }},
-    // U+0130 LATIN CAPITAL LETTER I WITH DOT ABOVE
-    {0x0130, {
+     0x186, 0x0CE, 0x076, 0x006, 0x006, 0x08C, 0x078, 0x000, },
+    // 209: U+0130 LATIN CAPITAL LETTER I WITH DOT ABOVE
+    {
      0x000, 0x000, 0x000, 0x030, 0x030, 0x000, 0x000, 0x1FE, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0131 LATIN SMALL LETTER DOTLESS I
-    {0x0131, {
+     0x030, 0x030, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 210: U+0131 LATIN SMALL LETTER DOTLESS I
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x078, 0x018, 0x018, 0x018, 0x018, 0x018, 
-     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0139 LATIN CAPITAL LETTER L WITH ACUTE
-    {0x0139, {
+     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 211: U+0139 LATIN CAPITAL LETTER L WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x040, 0x080, 0x000, 0x180, 
      0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 
-     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+013A LATIN SMALL LETTER L WITH ACUTE
-    {0x013A, {
+     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 212: U+013A LATIN SMALL LETTER L WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x030, 0x020, 0x000, 0x1F0, 0x030, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x01E, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+013D LATIN CAPITAL LETTER L WITH CARON
-    {0x013D, {
+     0x030, 0x030, 0x01E, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 213: U+013D LATIN CAPITAL LETTER L WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x188, 
      0x188, 0x188, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 
-     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+013E LATIN SMALL LETTER L WITH CARON
-    {0x013E, {
+     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 214: U+013E LATIN SMALL LETTER L WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1F0, 0x032, 
      0x032, 0x032, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x01E, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0141 LATIN CAPITAL LETTER L WITH STROKE
-    {0x0141, {
+     0x030, 0x030, 0x01E, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 215: U+0141 LATIN CAPITAL LETTER L WITH STROKE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x180, 
      0x180, 0x180, 0x190, 0x1B0, 0x1C0, 0x180, 0x380, 0x180, 
-     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0142 LATIN SMALL LETTER L WITH STROKE
-    {0x0142, {
+     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 216: U+0142 LATIN SMALL LETTER L WITH STROKE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0F0, 0x030, 
      0x030, 0x032, 0x03C, 0x038, 0x070, 0x0F0, 0x1B0, 0x030, 
-     0x030, 0x030, 0x01E, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0143 LATIN CAPITAL LETTER N WITH ACUTE
-    {0x0143, {
+     0x030, 0x030, 0x01E, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 217: U+0143 LATIN CAPITAL LETTER N WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x018, 0x010, 0x000, 0x1C6, 
      0x1C6, 0x1C6, 0x1E6, 0x1A6, 0x1A6, 0x196, 0x196, 0x19E, 
-     0x18E, 0x18E, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0144 LATIN SMALL LETTER N WITH ACUTE
-    {0x0144, {
+     0x18E, 0x18E, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 218: U+0144 LATIN SMALL LETTER N WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x00C, 0x018, 0x010, 
      0x000, 0x000, 0x1BC, 0x1CE, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0147 LATIN CAPITAL LETTER N WITH CARON
-    {0x0147, {
+     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 219: U+0147 LATIN CAPITAL LETTER N WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x024, 0x018, 0x000, 0x1C6, 
      0x1C6, 0x1C6, 0x1E6, 0x1A6, 0x1A6, 0x196, 0x196, 0x19E, 
-     0x18E, 0x18E, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0148 LATIN SMALL LETTER N WITH CARON
-    {0x0148, {
+     0x18E, 0x18E, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 220: U+0148 LATIN SMALL LETTER N WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x098, 0x050, 0x020, 
      0x000, 0x000, 0x1BC, 0x1CE, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0150 LATIN CAPITAL LETTER O WITH DOUBLE ACUTE
-    {0x0150, {
+     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 221: U+0150 LATIN CAPITAL LETTER O WITH DOUBLE ACUTE
+    {
      0x000, 0x000, 0x000, 0x036, 0x06C, 0x000, 0x000, 0x078, 
      0x0CC, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0151 LATIN SMALL LETTER O WITH DOUBLE ACUTE
-    {0x0151, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 222: U+0151 LATIN SMALL LETTER O WITH DOUBLE ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x036, 0x024, 0x048, 
      0x000, 0x000, 0x078, 0x0CC, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0152 LATIN CAPITAL LIGATURE OE
-    {0x0152, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 223: U+0152 LATIN CAPITAL LIGATURE OE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0FE, 
      0x0B0, 0x1B0, 0x1B0, 0x1B0, 0x1BE, 0x1B0, 0x1B0, 0x1B0, 
-     0x1B0, 0x0B0, 0x0FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0153 LATIN SMALL LIGATURE OE
-    {0x0153, {
+     0x1B0, 0x0B0, 0x0FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 224: U+0153 LATIN SMALL LIGATURE OE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x0FC, 0x1B6, 0x1B6, 0x1B6, 0x1BE, 0x1B0, 
-     0x1B0, 0x1B0, 0x0FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0154 LATIN CAPITAL LETTER R WITH ACUTE
-    {0x0154, {
+     0x1B0, 0x1B0, 0x0FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 225: U+0154 LATIN CAPITAL LETTER R WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x010, 0x020, 0x000, 0x1F8, 
      0x18C, 0x186, 0x186, 0x186, 0x18C, 0x1F8, 0x18C, 0x18C, 
-     0x186, 0x186, 0x183, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0155 LATIN SMALL LETTER R WITH ACUTE
-    {0x0155, {
+     0x186, 0x186, 0x183, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 226: U+0155 LATIN SMALL LETTER R WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x002, 0x004, 0x008, 
      0x000, 0x000, 0x06E, 0x071, 0x070, 0x060, 0x060, 0x060, 
-     0x060, 0x060, 0x060, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0158 LATIN CAPITAL LETTER R WITH CARON
-    {0x0158, {
+     0x060, 0x060, 0x060, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 227: U+0158 LATIN CAPITAL LETTER R WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x048, 0x030, 0x000, 0x1F8, 
      0x18C, 0x186, 0x186, 0x186, 0x18C, 0x1F8, 0x18C, 0x18C, 
-     0x186, 0x186, 0x183, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0159 LATIN SMALL LETTER R WITH CARON
-    {0x0159, {
+     0x186, 0x186, 0x183, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 228: U+0159 LATIN SMALL LETTER R WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x048, 0x028, 0x030, 
      0x000, 0x000, 0x06E, 0x071, 0x070, 0x060, 0x060, 0x060, 
-     0x060, 0x060, 0x060, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+015A LATIN CAPITAL LETTER S WITH ACUTE
-    {0x015A, {
+     0x060, 0x060, 0x060, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 229: U+015A LATIN CAPITAL LETTER S WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x018, 0x010, 0x000, 0x078, 
      0x0C4, 0x180, 0x180, 0x1E0, 0x0FC, 0x01E, 0x006, 0x006, 
-     0x006, 0x18E, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+015B LATIN SMALL LETTER S WITH ACUTE
-    {0x015B, {
+     0x006, 0x18E, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 230: U+015B LATIN SMALL LETTER S WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x00C, 0x018, 0x010, 
      0x000, 0x000, 0x07C, 0x182, 0x180, 0x1F8, 0x0FE, 0x00E, 
-     0x006, 0x106, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+015E LATIN CAPITAL LETTER S WITH CEDILLA
-    {0x015E, {
+     0x006, 0x106, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 231: U+015E LATIN CAPITAL LETTER S WITH CEDILLA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 
      0x0C4, 0x180, 0x180, 0x1E0, 0x0FC, 0x01E, 0x006, 0x006, 
-     0x006, 0x18E, 0x0F8, 0x008, 0x008, 0x038, 0x000, 0x000, }},
-    // U+015F LATIN SMALL LETTER S WITH CEDILLA
-    {0x015F, {
+     0x006, 0x18E, 0x0F8, 0x008, 0x008, 0x038, 0x000, 0x000, },
+    // 232: U+015F LATIN SMALL LETTER S WITH CEDILLA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x07C, 0x182, 0x180, 0x1F8, 0x0FE, 0x00E, 
-     0x006, 0x106, 0x0F8, 0x008, 0x008, 0x038, 0x000, 0x000, }},
-    // U+0160 LATIN CAPITAL LETTER S WITH CARON
-    {0x0160, {
+     0x006, 0x106, 0x0F8, 0x008, 0x008, 0x038, 0x000, 0x000, },
+    // 233: U+0160 LATIN CAPITAL LETTER S WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x06C, 0x038, 0x000, 0x078, 
      0x0C4, 0x180, 0x180, 0x1E0, 0x0FC, 0x01E, 0x006, 0x006, 
-     0x006, 0x18E, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0161 LATIN SMALL LETTER S WITH CARON
-    {0x0161, {
+     0x006, 0x18E, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 234: U+0161 LATIN SMALL LETTER S WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x088, 0x050, 0x020, 
      0x000, 0x000, 0x07C, 0x182, 0x180, 0x1F8, 0x0FE, 0x00E, 
-     0x006, 0x106, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0162 LATIN CAPITAL LETTER T WITH CEDILLA
-    {0x0162, {
+     0x006, 0x106, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 235: U+0162 LATIN CAPITAL LETTER T WITH CEDILLA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x3FF, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x008, 0x008, 0x038, 0x000, 0x000, }},
-    // U+0163 LATIN SMALL LETTER T WITH CEDILLA
-    {0x0163, {
+     0x030, 0x030, 0x030, 0x008, 0x008, 0x038, 0x000, 0x000, },
+    // 236: U+0163 LATIN SMALL LETTER T WITH CEDILLA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x030, 
      0x030, 0x030, 0x0FE, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x01E, 0x004, 0x004, 0x01C, 0x000, 0x000, }},
-    // U+0164 LATIN CAPITAL LETTER T WITH CARON
-    {0x0164, {
+     0x030, 0x030, 0x01E, 0x004, 0x004, 0x01C, 0x000, 0x000, },
+    // 237: U+0164 LATIN CAPITAL LETTER T WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x048, 0x030, 0x000, 0x3FF, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0165 LATIN SMALL LETTER T WITH CARON
-    {0x0165, {
+     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 238: U+0165 LATIN SMALL LETTER T WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x004, 0x034, 
      0x03C, 0x030, 0x0FE, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x01E, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+016E LATIN CAPITAL LETTER U WITH RING ABOVE
-    {0x016E, {
+     0x030, 0x030, 0x01E, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 239: U+016E LATIN CAPITAL LETTER U WITH RING ABOVE
+    {
      0x000, 0x038, 0x044, 0x044, 0x044, 0x038, 0x000, 0x186, 
      0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+016F LATIN SMALL LETTER U WITH RING ABOVE
-    {0x016F, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 240: U+016F LATIN SMALL LETTER U WITH RING ABOVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x038, 0x044, 0x044, 0x044, 
      0x038, 0x000, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x1CE, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0170 LATIN CAPITAL LETTER U WITH DOUBLE ACUTE
-    {0x0170, {
+     0x186, 0x1CE, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 241: U+0170 LATIN CAPITAL LETTER U WITH DOUBLE ACUTE
+    {
      0x000, 0x000, 0x000, 0x036, 0x06C, 0x000, 0x000, 0x186, 
      0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0171 LATIN SMALL LETTER U WITH DOUBLE ACUTE
-    {0x0171, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 242: U+0171 LATIN SMALL LETTER U WITH DOUBLE ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x036, 0x024, 0x048, 
      0x000, 0x000, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x1CE, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0178 LATIN CAPITAL LETTER Y WITH DIAERESIS
-    {0x0178, {
+     0x186, 0x1CE, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 243: U+0178 LATIN CAPITAL LETTER Y WITH DIAERESIS
+    {
      0x000, 0x000, 0x000, 0x0CC, 0x0CC, 0x000, 0x000, 0x387, 
      0x186, 0x0CC, 0x0CC, 0x078, 0x078, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0179 LATIN CAPITAL LETTER Z WITH ACUTE
-    {0x0179, {
+     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 244: U+0179 LATIN CAPITAL LETTER Z WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x018, 0x010, 0x000, 0x1FE, 
      0x006, 0x00C, 0x01C, 0x018, 0x030, 0x030, 0x060, 0x0E0, 
-     0x0C0, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+017A LATIN SMALL LETTER Z WITH ACUTE
-    {0x017A, {
+     0x0C0, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 245: U+017A LATIN SMALL LETTER Z WITH ACUTE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x004, 0x008, 0x010, 
      0x000, 0x000, 0x1FE, 0x00E, 0x01C, 0x038, 0x030, 0x060, 
-     0x0E0, 0x1C0, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+017B LATIN CAPITAL LETTER Z WITH DOT ABOVE
-    {0x017B, {
+     0x0E0, 0x1C0, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 246: U+017B LATIN CAPITAL LETTER Z WITH DOT ABOVE
+    {
      0x000, 0x000, 0x000, 0x030, 0x030, 0x000, 0x000, 0x1FE, 
      0x006, 0x00C, 0x01C, 0x018, 0x030, 0x030, 0x060, 0x0E0, 
-     0x0C0, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+017C LATIN SMALL LETTER Z WITH DOT ABOVE
-    {0x017C, {
+     0x0C0, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 247: U+017C LATIN SMALL LETTER Z WITH DOT ABOVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x030, 0x030, 
      0x000, 0x000, 0x1FE, 0x00E, 0x01C, 0x038, 0x030, 0x060, 
-     0x0E0, 0x1C0, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+017D LATIN CAPITAL LETTER Z WITH CARON
-    {0x017D, {
+     0x0E0, 0x1C0, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 248: U+017D LATIN CAPITAL LETTER Z WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x06C, 0x038, 0x000, 0x1FE, 
      0x006, 0x00C, 0x01C, 0x018, 0x030, 0x030, 0x060, 0x0E0, 
-     0x0C0, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+017E LATIN SMALL LETTER Z WITH CARON
-    {0x017E, {
+     0x0C0, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 249: U+017E LATIN SMALL LETTER Z WITH CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x088, 0x050, 0x020, 
      0x000, 0x000, 0x1FE, 0x00E, 0x01C, 0x038, 0x030, 0x060, 
-     0x0E0, 0x1C0, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0192 LATIN SMALL LETTER F WITH HOOK
-    {0x0192, {
+     0x0E0, 0x1C0, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 250: U+0192 LATIN SMALL LETTER F WITH HOOK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x01E, 0x030, 
      0x030, 0x030, 0x0FE, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x0E0, 0x080, 0x000, }},
-    // U+02C6 MODIFIER LETTER CIRCUMFLEX ACCENT
-    {0x02C6, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x0E0, 0x080, 0x000, },
+    // 251: U+02C6 MODIFIER LETTER CIRCUMFLEX ACCENT
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x020, 0x050, 0x088, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+02C7 CARON
-    {0x02C7, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 252: U+02C7 CARON
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x088, 0x050, 0x020, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+02D8 BREVE
-    {0x02D8, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 253: U+02D8 BREVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x044, 0x038, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+02D9 DOT ABOVE
-    {0x02D9, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 254: U+02D9 DOT ABOVE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x030, 0x030, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+02DB OGONEK
-    {0x02DB, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 255: U+02DB OGONEK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x040, 0x040, 0x070, 0x000, 0x000, }},
-    // U+02DC SMALL TILDE
-    {0x02DC, {
+     0x000, 0x000, 0x000, 0x040, 0x040, 0x070, 0x000, 0x000, },
+    // 256: U+02DC SMALL TILDE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0E8, 0x0B8, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+02DD DOUBLE ACUTE ACCENT
-    {0x02DD, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 257: U+02DD DOUBLE ACUTE ACCENT
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x036, 0x024, 0x048, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0393 GREEK CAPITAL LETTER GAMMA
-    {0x0393, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 258: U+0393 GREEK CAPITAL LETTER GAMMA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1FE, 
      0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 
-     0x180, 0x180, 0x180, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0398 GREEK CAPITAL LETTER THETA
-    {0x0398, {
+     0x180, 0x180, 0x180, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 259: U+0398 GREEK CAPITAL LETTER THETA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 
      0x0CC, 0x186, 0x186, 0x186, 0x1F6, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+03A3 GREEK CAPITAL LETTER SIGMA
-    {0x03A3, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 260: U+03A3 GREEK CAPITAL LETTER SIGMA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1FE, 
      0x1C0, 0x0E0, 0x060, 0x030, 0x038, 0x038, 0x030, 0x060, 
-     0x0E0, 0x1C0, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+03A6 GREEK CAPITAL LETTER PHI
-    {0x03A6, {
+     0x0E0, 0x1C0, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 261: U+03A6 GREEK CAPITAL LETTER PHI
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 
      0x030, 0x0FC, 0x0B4, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 0x0B4, 
-     0x0FC, 0x030, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+03A9 GREEK CAPITAL LETTER OMEGA
-    {0x03A9, {
+     0x0FC, 0x030, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 262: U+03A9 GREEK CAPITAL LETTER OMEGA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07C, 
      0x0C6, 0x0C6, 0x183, 0x183, 0x183, 0x183, 0x183, 0x183, 
-     0x0C6, 0x044, 0x1EF, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+03B1 GREEK SMALL LETTER ALPHA
-    {0x03B1, {
+     0x0C6, 0x044, 0x1EF, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 263: U+03B1 GREEK SMALL LETTER ALPHA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x0FA, 0x18E, 0x10C, 0x10C, 0x10C, 0x10C, 
-     0x18C, 0x19E, 0x0F3, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+03B4 GREEK SMALL LETTER DELTA
-    {0x03B4, {
+     0x18C, 0x19E, 0x0F3, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 264: U+03B4 GREEK SMALL LETTER DELTA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x07C, 0x0C4, 0x080, 
      0x0E0, 0x0FC, 0x086, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x0CC, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+03B5 GREEK SMALL LETTER EPSILON
-    {0x03B5, {
+     0x0CC, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 265: U+03B5 GREEK SMALL LETTER EPSILON
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x0F8, 0x184, 0x180, 0x0F0, 0x0C0, 0x180, 
-     0x180, 0x1C4, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+03C0 GREEK SMALL LETTER PI
-    {0x03C0, {
+     0x180, 0x1C4, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 266: U+03C0 GREEK SMALL LETTER PI
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x1FF, 0x084, 0x084, 0x084, 0x084, 0x084, 0x084, 
-     0x084, 0x087, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+03C3 GREEK SMALL LETTER SIGMA
-    {0x03C3, {
+     0x084, 0x087, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 267: U+03C3 GREEK SMALL LETTER SIGMA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x07E, 0x0CC, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+03C4 GREEK SMALL LETTER TAU
-    {0x03C4, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 268: U+03C4 GREEK SMALL LETTER TAU
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x1FE, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x01C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+03C6 GREEK SMALL LETTER PHI
-    {0x03C6, {
+     0x030, 0x030, 0x01C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 269: U+03C6 GREEK SMALL LETTER PHI
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x098, 0x1B4, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 
-     0x1B6, 0x0B4, 0x0F8, 0x030, 0x030, 0x030, 0x030, 0x000, }},
-    // U+0401 CYRILLIC CAPITAL LETTER IO
-    {0x0401, {
+     0x1B6, 0x0B4, 0x0F8, 0x030, 0x030, 0x030, 0x030, 0x000, },
+    // 270: U+0401 CYRILLIC CAPITAL LETTER IO
+    {
      0x000, 0x000, 0x000, 0x066, 0x066, 0x000, 0x000, 0x1FE, 
      0x180, 0x180, 0x180, 0x180, 0x1FE, 0x180, 0x180, 0x180, 
-     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0402 CYRILLIC CAPITAL LETTER DJE
-    {0x0402, {
+     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 271: U+0402 CYRILLIC CAPITAL LETTER DJE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x3FC, 0x0C0, 
      0x0C0, 0x0C0, 0x0DE, 0x0FF, 0x0E3, 0x0C1, 0x0C1, 0x0C1, 
-     0x0C1, 0x0C1, 0x001, 0x003, 0x007, 0x00E, 0x000, 0x000, }},
-    // U+0403 CYRILLIC CAPITAL LETTER GJE
-    {0x0403, {
+     0x0C1, 0x0C1, 0x001, 0x003, 0x007, 0x00E, 0x000, 0x000, },
+    // 272: U+0403 CYRILLIC CAPITAL LETTER GJE
+    {
      0x000, 0x000, 0x000, 0x000, 0x008, 0x010, 0x000, 0x1FE, 
      0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 
-     0x180, 0x180, 0x180, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0404 CYRILLIC CAPITAL LETTER UKRAINIAN IE
-    {0x0404, {
+     0x180, 0x180, 0x180, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 273: U+0404 CYRILLIC CAPITAL LETTER UKRAINIAN IE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x03C, 
      0x0C2, 0x0C0, 0x180, 0x180, 0x1FC, 0x180, 0x180, 0x180, 
-     0x0C0, 0x0E2, 0x03C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0405 CYRILLIC CAPITAL LETTER DZE
-    {0x0405, {
+     0x0C0, 0x0E2, 0x03C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 274: U+0405 CYRILLIC CAPITAL LETTER DZE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 
      0x0C4, 0x180, 0x180, 0x1E0, 0x0FC, 0x01E, 0x006, 0x006, 
-     0x006, 0x18E, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0406 CYRILLIC CAPITAL LETTER BYELORUSSIAN-UKRAINIAN I
-    {0x0406, {
+     0x006, 0x18E, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 275: U+0406 CYRILLIC CAPITAL LETTER BYELORUSSIAN-UKRAINIAN I
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1FE, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0407 CYRILLIC CAPITAL LETTER YI
-    {0x0407, {
+     0x030, 0x030, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 276: U+0407 CYRILLIC CAPITAL LETTER YI
+    {
      0x000, 0x000, 0x000, 0x0CC, 0x0CC, 0x000, 0x000, 0x1FE, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0408 CYRILLIC CAPITAL LETTER JE
-    {0x0408, {
+     0x030, 0x030, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 277: U+0408 CYRILLIC CAPITAL LETTER JE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x07C, 
      0x00C, 0x00C, 0x00C, 0x00C, 0x00C, 0x00C, 0x00C, 0x00C, 
-     0x00C, 0x118, 0x0F0, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0409 CYRILLIC CAPITAL LETTER LJE
-    {0x0409, {
+     0x00C, 0x118, 0x0F0, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 278: U+0409 CYRILLIC CAPITAL LETTER LJE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0F8, 0x0D8, 
      0x0D8, 0x0D8, 0x0D8, 0x0DE, 0x0DB, 0x0D9, 0x0D9, 0x09B, 
-     0x19F, 0x31C, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+040A CYRILLIC CAPITAL LETTER NJE
-    {0x040A, {
+     0x19F, 0x31C, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 279: U+040A CYRILLIC CAPITAL LETTER NJE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x318, 0x318, 
      0x318, 0x318, 0x318, 0x3FE, 0x31B, 0x319, 0x319, 0x31B, 
-     0x31F, 0x31C, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+040B CYRILLIC CAPITAL LETTER TSHE
-    {0x040B, {
+     0x31F, 0x31C, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 280: U+040B CYRILLIC CAPITAL LETTER TSHE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x3FC, 0x0C0, 
      0x0C0, 0x0C0, 0x0DE, 0x0FF, 0x0E3, 0x0C1, 0x0C1, 0x0C1, 
-     0x0C1, 0x0C1, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+040C CYRILLIC CAPITAL LETTER KJE
-    {0x040C, {
+     0x0C1, 0x0C1, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 281: U+040C CYRILLIC CAPITAL LETTER KJE
+    {
      0x000, 0x000, 0x000, 0x000, 0x018, 0x010, 0x000, 0x183, 
      0x186, 0x18C, 0x198, 0x1B0, 0x1F0, 0x1F0, 0x198, 0x19C, 
-     0x18E, 0x186, 0x183, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+040E CYRILLIC CAPITAL LETTER SHORT U
-    {0x040E, {
+     0x18E, 0x186, 0x183, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 282: U+040E CYRILLIC CAPITAL LETTER SHORT U
+    {
      0x000, 0x000, 0x000, 0x044, 0x038, 0x000, 0x000, 0x183, 
      0x0C6, 0x0C6, 0x06E, 0x06C, 0x07C, 0x038, 0x038, 0x018, 
-     0x010, 0x030, 0x0E0, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+040F CYRILLIC CAPITAL LETTER DZHE
-    {0x040F, {
+     0x010, 0x030, 0x0E0, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 283: U+040F CYRILLIC CAPITAL LETTER DZHE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x186, 0x186, 
      0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x1FE, 0x030, 0x030, 0x030, 0x000, 0x000, 0x000, }},
-    // U+0410 CYRILLIC CAPITAL LETTER A
-    {0x0410, {
+     0x186, 0x1FE, 0x030, 0x030, 0x030, 0x000, 0x000, 0x000, },
+    // 284: U+0410 CYRILLIC CAPITAL LETTER A
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x030, 
      0x030, 0x078, 0x078, 0x078, 0x048, 0x0CC, 0x0CC, 0x0FC, 
-     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0411 CYRILLIC CAPITAL LETTER BE
-    {0x0411, {
+     0x0CC, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 285: U+0411 CYRILLIC CAPITAL LETTER BE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1FC, 
      0x180, 0x180, 0x180, 0x180, 0x1F8, 0x18C, 0x186, 0x186, 
-     0x186, 0x18E, 0x1F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0412 CYRILLIC CAPITAL LETTER VE
-    {0x0412, {
+     0x186, 0x18E, 0x1F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 286: U+0412 CYRILLIC CAPITAL LETTER VE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1F8, 
      0x186, 0x186, 0x186, 0x18E, 0x1F8, 0x18C, 0x186, 0x186, 
-     0x186, 0x18E, 0x1F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0413 CYRILLIC CAPITAL LETTER GHE
-    {0x0413, {
+     0x186, 0x18E, 0x1F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 287: U+0413 CYRILLIC CAPITAL LETTER GHE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1FE, 
      0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 
-     0x180, 0x180, 0x180, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0414 CYRILLIC CAPITAL LETTER DE
-    {0x0414, {
+     0x180, 0x180, 0x180, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 288: U+0414 CYRILLIC CAPITAL LETTER DE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0FE, 
      0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 
-     0x1C6, 0x1C6, 0x3FF, 0x303, 0x303, 0x303, 0x000, 0x000, }},
-    // U+0415 CYRILLIC CAPITAL LETTER IE
-    {0x0415, {
+     0x1C6, 0x1C6, 0x3FF, 0x303, 0x303, 0x303, 0x000, 0x000, },
+    // 289: U+0415 CYRILLIC CAPITAL LETTER IE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1FE, 
      0x180, 0x180, 0x180, 0x180, 0x1FE, 0x180, 0x180, 0x180, 
-     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0416 CYRILLIC CAPITAL LETTER ZHE
-    {0x0416, {
+     0x180, 0x180, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 290: U+0416 CYRILLIC CAPITAL LETTER ZHE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x333, 
      0x132, 0x1B6, 0x0B4, 0x0FC, 0x0FC, 0x0FC, 0x1B6, 0x1B6, 
-     0x1B6, 0x333, 0x333, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0417 CYRILLIC CAPITAL LETTER ZE
-    {0x0417, {
+     0x1B6, 0x333, 0x333, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 291: U+0417 CYRILLIC CAPITAL LETTER ZE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0F8, 
      0x10C, 0x006, 0x006, 0x00C, 0x070, 0x00C, 0x006, 0x006, 
-     0x006, 0x10C, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0418 CYRILLIC CAPITAL LETTER I
-    {0x0418, {
+     0x006, 0x10C, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 292: U+0418 CYRILLIC CAPITAL LETTER I
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x18E, 
      0x18E, 0x18E, 0x19E, 0x196, 0x196, 0x1A6, 0x1A6, 0x1E6, 
-     0x1C6, 0x1C6, 0x1C6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0419 CYRILLIC CAPITAL LETTER SHORT I
-    {0x0419, {
+     0x1C6, 0x1C6, 0x1C6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 293: U+0419 CYRILLIC CAPITAL LETTER SHORT I
+    {
      0x000, 0x000, 0x000, 0x044, 0x038, 0x000, 0x000, 0x18E, 
      0x18E, 0x18E, 0x19E, 0x196, 0x196, 0x1A6, 0x1A6, 0x1E6, 
-     0x1C6, 0x1C6, 0x1C6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+041A CYRILLIC CAPITAL LETTER KA
-    {0x041A, {
+     0x1C6, 0x1C6, 0x1C6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 294: U+041A CYRILLIC CAPITAL LETTER KA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x183, 
      0x186, 0x18C, 0x198, 0x1B0, 0x1F0, 0x1F0, 0x198, 0x19C, 
-     0x18E, 0x186, 0x183, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+041B CYRILLIC CAPITAL LETTER EL
-    {0x041B, {
+     0x18E, 0x186, 0x183, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 295: U+041B CYRILLIC CAPITAL LETTER EL
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0FE, 
      0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 
-     0x0C6, 0x186, 0x306, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+041C CYRILLIC CAPITAL LETTER EM
-    {0x041C, {
+     0x0C6, 0x186, 0x306, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 296: U+041C CYRILLIC CAPITAL LETTER EM
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1CE, 
      0x1CE, 0x1CE, 0x1CE, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 0x186, 
-     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+041D CYRILLIC CAPITAL LETTER EN
-    {0x041D, {
+     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 297: U+041D CYRILLIC CAPITAL LETTER EN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x186, 
      0x186, 0x186, 0x186, 0x186, 0x1FE, 0x186, 0x186, 0x186, 
-     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+041E CYRILLIC CAPITAL LETTER O
-    {0x041E, {
+     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 298: U+041E CYRILLIC CAPITAL LETTER O
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x078, 
      0x0CC, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+041F CYRILLIC CAPITAL LETTER PE
-    {0x041F, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 299: U+041F CYRILLIC CAPITAL LETTER PE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1FE, 
      0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0420 CYRILLIC CAPITAL LETTER ER
-    {0x0420, {
+     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 300: U+0420 CYRILLIC CAPITAL LETTER ER
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1F8, 
      0x18C, 0x186, 0x186, 0x186, 0x18C, 0x1F8, 0x180, 0x180, 
-     0x180, 0x180, 0x180, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0421 CYRILLIC CAPITAL LETTER ES
-    {0x0421, {
+     0x180, 0x180, 0x180, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 301: U+0421 CYRILLIC CAPITAL LETTER ES
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x03C, 
      0x0E2, 0x0C0, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 
-     0x0C0, 0x0E2, 0x03C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0422 CYRILLIC CAPITAL LETTER TE
-    {0x0422, {
+     0x0C0, 0x0E2, 0x03C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 302: U+0422 CYRILLIC CAPITAL LETTER TE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x3FF, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0423 CYRILLIC CAPITAL LETTER U
-    {0x0423, {
+     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 303: U+0423 CYRILLIC CAPITAL LETTER U
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x183, 
      0x0C6, 0x0C6, 0x06E, 0x06C, 0x07C, 0x038, 0x038, 0x018, 
-     0x010, 0x030, 0x0E0, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0424 CYRILLIC CAPITAL LETTER EF
-    {0x0424, {
+     0x010, 0x030, 0x0E0, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 304: U+0424 CYRILLIC CAPITAL LETTER EF
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x030, 
      0x0FC, 0x1B6, 0x333, 0x333, 0x333, 0x333, 0x333, 0x333, 
-     0x1B6, 0x0FC, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0425 CYRILLIC CAPITAL LETTER HA
-    {0x0425, {
+     0x1B6, 0x0FC, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 305: U+0425 CYRILLIC CAPITAL LETTER HA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1CE, 
      0x0CC, 0x0FC, 0x078, 0x030, 0x030, 0x030, 0x078, 0x078, 
-     0x0DC, 0x0CC, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0426 CYRILLIC CAPITAL LETTER TSE
-    {0x0426, {
+     0x0DC, 0x0CC, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 306: U+0426 CYRILLIC CAPITAL LETTER TSE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x186, 
      0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x186, 0x1FF, 0x003, 0x003, 0x003, 0x000, 0x000, }},
-    // U+0427 CYRILLIC CAPITAL LETTER CHE
-    {0x0427, {
+     0x186, 0x186, 0x1FF, 0x003, 0x003, 0x003, 0x000, 0x000, },
+    // 307: U+0427 CYRILLIC CAPITAL LETTER CHE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x186, 
      0x186, 0x186, 0x186, 0x186, 0x186, 0x0FE, 0x006, 0x006, 
-     0x006, 0x006, 0x006, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0428 CYRILLIC CAPITAL LETTER SHA
-    {0x0428, {
+     0x006, 0x006, 0x006, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 308: U+0428 CYRILLIC CAPITAL LETTER SHA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1B6, 
      0x1B6, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 
-     0x1B6, 0x1B6, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0429 CYRILLIC CAPITAL LETTER SHCHA
-    {0x0429, {
+     0x1B6, 0x1B6, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 309: U+0429 CYRILLIC CAPITAL LETTER SHCHA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1B6, 
      0x1B6, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 
-     0x1B6, 0x1B6, 0x1FF, 0x003, 0x003, 0x003, 0x000, 0x000, }},
-    // U+042A CYRILLIC CAPITAL LETTER HARD SIGN
-    {0x042A, {
+     0x1B6, 0x1B6, 0x1FF, 0x003, 0x003, 0x003, 0x000, 0x000, },
+    // 310: U+042A CYRILLIC CAPITAL LETTER HARD SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x3C0, 
      0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x0F8, 0x0CE, 0x0C6, 0x0C6, 
-     0x0C6, 0x0CC, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+042B CYRILLIC CAPITAL LETTER YERU
-    {0x042B, {
+     0x0C6, 0x0CC, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 311: U+042B CYRILLIC CAPITAL LETTER YERU
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x183, 
      0x183, 0x183, 0x183, 0x183, 0x1F3, 0x19B, 0x19B, 0x19B, 
-     0x19B, 0x193, 0x1E3, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+042C CYRILLIC CAPITAL LETTER SOFT SIGN
-    {0x042C, {
+     0x19B, 0x193, 0x1E3, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 312: U+042C CYRILLIC CAPITAL LETTER SOFT SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x180, 
      0x180, 0x180, 0x180, 0x180, 0x1F8, 0x18C, 0x186, 0x186, 
-     0x186, 0x18C, 0x1F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+042D CYRILLIC CAPITAL LETTER E
-    {0x042D, {
+     0x186, 0x18C, 0x1F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 313: U+042D CYRILLIC CAPITAL LETTER E
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x0F0, 
      0x10C, 0x00C, 0x006, 0x006, 0x0FE, 0x006, 0x006, 0x006, 
-     0x00C, 0x11C, 0x0F0, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+042E CYRILLIC CAPITAL LETTER YU
-    {0x042E, {
+     0x00C, 0x11C, 0x0F0, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 314: U+042E CYRILLIC CAPITAL LETTER YU
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x19C, 
      0x194, 0x1B6, 0x1B6, 0x1B6, 0x1F6, 0x1B6, 0x1B6, 0x1B6, 
-     0x1B6, 0x194, 0x19C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+042F CYRILLIC CAPITAL LETTER YA
-    {0x042F, {
+     0x1B6, 0x194, 0x19C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 315: U+042F CYRILLIC CAPITAL LETTER YA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x03F, 
      0x063, 0x0C3, 0x0C3, 0x0C3, 0x063, 0x03F, 0x033, 0x073, 
-     0x063, 0x0C3, 0x1C3, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0430 CYRILLIC SMALL LETTER A
-    {0x0430, {
+     0x063, 0x0C3, 0x1C3, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 316: U+0430 CYRILLIC SMALL LETTER A
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x07C, 0x086, 0x006, 0x07E, 0x1C6, 0x186, 
-     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0431 CYRILLIC SMALL LETTER BE
-    {0x0431, {
+     0x186, 0x18E, 0x0F6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 317: U+0431 CYRILLIC SMALL LETTER BE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x03C, 0x060, 
      0x0C0, 0x180, 0x1B8, 0x1CC, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0432 CYRILLIC SMALL LETTER VE
-    {0x0432, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 318: U+0432 CYRILLIC SMALL LETTER VE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x1F8, 0x18C, 0x18C, 0x1F8, 0x18C, 0x18C, 
-     0x18C, 0x18C, 0x1F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0433 CYRILLIC SMALL LETTER GHE
-    {0x0433, {
+     0x18C, 0x18C, 0x1F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 319: U+0433 CYRILLIC SMALL LETTER GHE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x0FC, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 
-     0x0C0, 0x0C0, 0x0C0, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0434 CYRILLIC SMALL LETTER DE
-    {0x0434, {
+     0x0C0, 0x0C0, 0x0C0, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 320: U+0434 CYRILLIC SMALL LETTER DE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x0FC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 
-     0x0CC, 0x0CC, 0x1FE, 0x186, 0x186, 0x000, 0x000, 0x000, }},
-    // U+0435 CYRILLIC SMALL LETTER IE
-    {0x0435, {
+     0x0CC, 0x0CC, 0x1FE, 0x186, 0x186, 0x000, 0x000, 0x000, },
+    // 321: U+0435 CYRILLIC SMALL LETTER IE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x078, 0x0CC, 0x186, 0x186, 0x1FE, 0x180, 
-     0x180, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0436 CYRILLIC SMALL LETTER ZHE
-    {0x0436, {
+     0x180, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 322: U+0436 CYRILLIC SMALL LETTER ZHE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x132, 0x1B6, 0x0B4, 0x0FC, 0x0FC, 0x1FE, 
-     0x1B6, 0x1B6, 0x333, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0437 CYRILLIC SMALL LETTER ZE
-    {0x0437, {
+     0x1B6, 0x1B6, 0x333, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 323: U+0437 CYRILLIC SMALL LETTER ZE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x0F8, 0x10C, 0x00C, 0x070, 0x01C, 0x00C, 
-     0x00C, 0x11C, 0x0F0, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0438 CYRILLIC SMALL LETTER I
-    {0x0438, {
+     0x00C, 0x11C, 0x0F0, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 324: U+0438 CYRILLIC SMALL LETTER I
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x18C, 0x19C, 0x19C, 0x19C, 0x1BC, 0x1AC, 
-     0x1EC, 0x1CC, 0x18C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0439 CYRILLIC SMALL LETTER SHORT I
-    {0x0439, {
+     0x1EC, 0x1CC, 0x18C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 325: U+0439 CYRILLIC SMALL LETTER SHORT I
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x044, 0x038, 0x000, 
      0x000, 0x000, 0x18C, 0x19C, 0x19C, 0x19C, 0x1BC, 0x1AC, 
-     0x1EC, 0x1CC, 0x18C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+043A CYRILLIC SMALL LETTER KA
-    {0x043A, {
+     0x1EC, 0x1CC, 0x18C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 326: U+043A CYRILLIC SMALL LETTER KA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x18E, 0x19C, 0x1B8, 0x1F0, 0x1F0, 0x1F8, 
-     0x198, 0x19C, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+043B CYRILLIC SMALL LETTER EL
-    {0x043B, {
+     0x198, 0x19C, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 327: U+043B CYRILLIC SMALL LETTER EL
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x0FE, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 0x0C6, 
-     0x0C6, 0x186, 0x386, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+043C CYRILLIC SMALL LETTER EM
-    {0x043C, {
+     0x0C6, 0x186, 0x386, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 328: U+043C CYRILLIC SMALL LETTER EM
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x183, 0x1C7, 0x1C7, 0x1EF, 0x1EF, 0x1EF, 
-     0x1BB, 0x183, 0x183, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+043D CYRILLIC SMALL LETTER EN
-    {0x043D, {
+     0x1BB, 0x183, 0x183, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 329: U+043D CYRILLIC SMALL LETTER EN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x18C, 0x18C, 0x18C, 0x1FC, 0x18C, 0x18C, 
-     0x18C, 0x18C, 0x18C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+043E CYRILLIC SMALL LETTER O
-    {0x043E, {
+     0x18C, 0x18C, 0x18C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 330: U+043E CYRILLIC SMALL LETTER O
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x078, 0x0CC, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+043F CYRILLIC SMALL LETTER PE
-    {0x043F, {
+     0x186, 0x0CC, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 331: U+043F CYRILLIC SMALL LETTER PE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x1FC, 0x18C, 0x18C, 0x18C, 0x18C, 0x18C, 
-     0x18C, 0x18C, 0x18C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0440 CYRILLIC SMALL LETTER ER
-    {0x0440, {
+     0x18C, 0x18C, 0x18C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 332: U+0440 CYRILLIC SMALL LETTER ER
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x1B8, 0x1CC, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x1CC, 0x1B8, 0x180, 0x180, 0x180, 0x180, 0x000, }},
-    // U+0441 CYRILLIC SMALL LETTER ES
-    {0x0441, {
+     0x186, 0x1CC, 0x1B8, 0x180, 0x180, 0x180, 0x180, 0x000, },
+    // 333: U+0441 CYRILLIC SMALL LETTER ES
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x078, 0x0C4, 0x180, 0x180, 0x180, 0x180, 
-     0x180, 0x0C4, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0442 CYRILLIC SMALL LETTER TE
-    {0x0442, {
+     0x180, 0x0C4, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 334: U+0442 CYRILLIC SMALL LETTER TE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x1FE, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0443 CYRILLIC SMALL LETTER U
-    {0x0443, {
+     0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 335: U+0443 CYRILLIC SMALL LETTER U
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x186, 0x0CE, 0x0CC, 0x0CC, 0x07C, 0x078, 
-     0x078, 0x038, 0x030, 0x030, 0x070, 0x060, 0x0C0, 0x000, }},
-    // U+0444 CYRILLIC SMALL LETTER EF
-    {0x0444, {
+     0x078, 0x038, 0x030, 0x030, 0x070, 0x060, 0x0C0, 0x000, },
+    // 336: U+0444 CYRILLIC SMALL LETTER EF
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x030, 0x030, 
      0x030, 0x030, 0x0FC, 0x1B6, 0x333, 0x333, 0x333, 0x333, 
-     0x333, 0x1B6, 0x0FC, 0x030, 0x030, 0x030, 0x030, 0x000, }},
-    // U+0445 CYRILLIC SMALL LETTER HA
-    {0x0445, {
+     0x333, 0x1B6, 0x0FC, 0x030, 0x030, 0x030, 0x030, 0x000, },
+    // 337: U+0445 CYRILLIC SMALL LETTER HA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x1CE, 0x0FC, 0x078, 0x030, 0x030, 0x078, 
-     0x078, 0x0CC, 0x1CE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0446 CYRILLIC SMALL LETTER TSE
-    {0x0446, {
+     0x078, 0x0CC, 0x1CE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 338: U+0446 CYRILLIC SMALL LETTER TSE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x18C, 0x18C, 0x18C, 0x18C, 0x18C, 0x18C, 
-     0x18C, 0x18C, 0x1FE, 0x006, 0x006, 0x000, 0x000, 0x000, }},
-    // U+0447 CYRILLIC SMALL LETTER CHE
-    {0x0447, {
+     0x18C, 0x18C, 0x1FE, 0x006, 0x006, 0x000, 0x000, 0x000, },
+    // 339: U+0447 CYRILLIC SMALL LETTER CHE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x18C, 0x18C, 0x18C, 0x18C, 0x0FC, 0x00C, 
-     0x00C, 0x00C, 0x00C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0448 CYRILLIC SMALL LETTER SHA
-    {0x0448, {
+     0x00C, 0x00C, 0x00C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 340: U+0448 CYRILLIC SMALL LETTER SHA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 
-     0x1B6, 0x1B6, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0449 CYRILLIC SMALL LETTER SHCHA
-    {0x0449, {
+     0x1B6, 0x1B6, 0x1FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 341: U+0449 CYRILLIC SMALL LETTER SHCHA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 0x1B6, 
-     0x1B6, 0x1B6, 0x1FF, 0x003, 0x003, 0x000, 0x000, 0x000, }},
-    // U+044A CYRILLIC SMALL LETTER HARD SIGN
-    {0x044A, {
+     0x1B6, 0x1B6, 0x1FF, 0x003, 0x003, 0x000, 0x000, 0x000, },
+    // 342: U+044A CYRILLIC SMALL LETTER HARD SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x3C0, 0x0C0, 0x0C0, 0x0FE, 0x0C7, 0x0C3, 
-     0x0C3, 0x0C7, 0x0FE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+044B CYRILLIC SMALL LETTER YERU
-    {0x044B, {
+     0x0C3, 0x0C7, 0x0FE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 343: U+044B CYRILLIC SMALL LETTER YERU
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x183, 0x183, 0x183, 0x1F3, 0x19B, 0x19B, 
-     0x19B, 0x19B, 0x1F3, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+044C CYRILLIC SMALL LETTER SOFT SIGN
-    {0x044C, {
+     0x19B, 0x19B, 0x1F3, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 344: U+044C CYRILLIC SMALL LETTER SOFT SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x180, 0x180, 0x180, 0x1F8, 0x18C, 0x18C, 
-     0x18C, 0x18C, 0x1F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+044D CYRILLIC SMALL LETTER E
-    {0x044D, {
+     0x18C, 0x18C, 0x1F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 345: U+044D CYRILLIC SMALL LETTER E
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x078, 0x08C, 0x006, 0x006, 0x07E, 0x006, 
-     0x006, 0x08C, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+044E CYRILLIC SMALL LETTER YU
-    {0x044E, {
+     0x006, 0x08C, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 346: U+044E CYRILLIC SMALL LETTER YU
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x19E, 0x192, 0x1B3, 0x1B3, 0x1F3, 0x1B3, 
-     0x1B3, 0x192, 0x18C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+044F CYRILLIC SMALL LETTER YA
-    {0x044F, {
+     0x1B3, 0x192, 0x18C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 347: U+044F CYRILLIC SMALL LETTER YA
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x0F8, 0x198, 0x198, 0x198, 0x198, 0x078, 
-     0x078, 0x0D8, 0x1D8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0451 CYRILLIC SMALL LETTER IO
-    {0x0451, {
+     0x078, 0x0D8, 0x1D8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 348: U+0451 CYRILLIC SMALL LETTER IO
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x066, 
      0x066, 0x000, 0x078, 0x0CC, 0x186, 0x186, 0x1FE, 0x180, 
-     0x180, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0452 CYRILLIC SMALL LETTER DJE
-    {0x0452, {
+     0x180, 0x0C2, 0x07C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 349: U+0452 CYRILLIC SMALL LETTER DJE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x080, 0x080, 
      0x080, 0x080, 0x3F8, 0x080, 0x080, 0x0BC, 0x0C6, 0x0C2, 
-     0x082, 0x082, 0x086, 0x006, 0x00C, 0x018, 0x000, 0x000, }},
-    // U+0453 CYRILLIC SMALL LETTER GJE
-    {0x0453, {
+     0x082, 0x082, 0x086, 0x006, 0x00C, 0x018, 0x000, 0x000, },
+    // 350: U+0453 CYRILLIC SMALL LETTER GJE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x004, 0x008, 0x010, 
      0x000, 0x000, 0x0FC, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 
-     0x0C0, 0x0C0, 0x0C0, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0454 CYRILLIC SMALL LETTER UKRAINIAN IE
-    {0x0454, {
+     0x0C0, 0x0C0, 0x0C0, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 351: U+0454 CYRILLIC SMALL LETTER UKRAINIAN IE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x078, 0x0C4, 0x180, 0x180, 0x1F8, 0x180, 
-     0x180, 0x0C4, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0455 CYRILLIC SMALL LETTER DZE
-    {0x0455, {
+     0x180, 0x0C4, 0x078, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 352: U+0455 CYRILLIC SMALL LETTER DZE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x07C, 0x182, 0x180, 0x1F8, 0x0FE, 0x00E, 
-     0x006, 0x106, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0456 CYRILLIC SMALL LETTER BYELORUSSIAN-UKRAINIAN I
-    {0x0456, {
+     0x006, 0x106, 0x0F8, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 353: U+0456 CYRILLIC SMALL LETTER BYELORUSSIAN-UKRAINIAN I
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x018, 0x018, 
      0x000, 0x000, 0x078, 0x018, 0x018, 0x018, 0x018, 0x018, 
-     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0457 CYRILLIC SMALL LETTER YI
-    {0x0457, {
+     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 354: U+0457 CYRILLIC SMALL LETTER YI
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x066, 0x066, 
      0x000, 0x000, 0x078, 0x018, 0x018, 0x018, 0x018, 0x018, 
-     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0458 CYRILLIC SMALL LETTER JE
-    {0x0458, {
+     0x018, 0x018, 0x0FF, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 355: U+0458 CYRILLIC SMALL LETTER JE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x018, 0x018, 
      0x000, 0x000, 0x0F8, 0x018, 0x018, 0x018, 0x018, 0x018, 
-     0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x0F0, 0x000, }},
-    // U+0459 CYRILLIC SMALL LETTER LJE
-    {0x0459, {
+     0x018, 0x018, 0x018, 0x018, 0x018, 0x018, 0x0F0, 0x000, },
+    // 356: U+0459 CYRILLIC SMALL LETTER LJE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x0F8, 0x098, 0x098, 0x098, 0x09F, 0x09B, 0x099, 
-     0x19B, 0x31E, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+045A CYRILLIC SMALL LETTER NJE
-    {0x045A, {
+     0x19B, 0x31E, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 357: U+045A CYRILLIC SMALL LETTER NJE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x110, 0x110, 0x110, 0x1F8, 0x1FE, 0x113, 0x113, 
-     0x113, 0x11E, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+045B CYRILLIC SMALL LETTER TSHE
-    {0x045B, {
+     0x113, 0x11E, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 358: U+045B CYRILLIC SMALL LETTER TSHE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x080, 0x080, 
      0x080, 0x080, 0x3F8, 0x080, 0x080, 0x0BC, 0x0C6, 0x0C6, 
-     0x086, 0x086, 0x086, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+045C CYRILLIC SMALL LETTER KJE
-    {0x045C, {
+     0x086, 0x086, 0x086, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 359: U+045C CYRILLIC SMALL LETTER KJE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x00C, 0x008, 0x010, 
      0x000, 0x000, 0x18E, 0x19C, 0x1B8, 0x1F0, 0x1F0, 0x1F8, 
-     0x198, 0x19C, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+045E CYRILLIC SMALL LETTER SHORT U
-    {0x045E, {
+     0x198, 0x19C, 0x18E, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 360: U+045E CYRILLIC SMALL LETTER SHORT U
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x044, 0x038, 0x000, 
      0x000, 0x000, 0x186, 0x0CE, 0x0CC, 0x0CC, 0x07C, 0x078, 
-     0x078, 0x038, 0x030, 0x030, 0x070, 0x060, 0x0C0, 0x000, }},
-    // U+045F CYRILLIC SMALL LETTER DZHE
-    {0x045F, {
+     0x078, 0x038, 0x030, 0x030, 0x070, 0x060, 0x0C0, 0x000, },
+    // 361: U+045F CYRILLIC SMALL LETTER DZHE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x086, 0x086, 0x086, 0x086, 0x086, 0x086, 0x086, 
-     0x086, 0x0FE, 0x010, 0x010, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0490 CYRILLIC CAPITAL LETTER GHE WITH UPTURN
-    {0x0490, {
+     0x086, 0x0FE, 0x010, 0x010, 0x000, 0x000, 0x000, 0x000, },
+    // 362: U+0490 CYRILLIC CAPITAL LETTER GHE WITH UPTURN
+    {
      0x000, 0x000, 0x000, 0x000, 0x002, 0x002, 0x002, 0x1FE, 
      0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 0x180, 
-     0x180, 0x180, 0x180, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+0491 CYRILLIC SMALL LETTER GHE WITH UPTURN
-    {0x0491, {
+     0x180, 0x180, 0x180, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 363: U+0491 CYRILLIC SMALL LETTER GHE WITH UPTURN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x00C, 
      0x00C, 0x00C, 0x0FC, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 0x0C0, 
-     0x0C0, 0x0C0, 0x0C0, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2013 EN DASH
-    {0x2013, {
+     0x0C0, 0x0C0, 0x0C0, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 364: U+2013 EN DASH
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x3FF, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2014 EM DASH
-    {0x2014, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 365: U+2014 EM DASH
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x3FF, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2017 DOUBLE LOW LINE
-    {0x2017, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 366: U+2017 DOUBLE LOW LINE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x3FF, 0x000, 0x3FF, 0x000, }},
-    // U+2018 LEFT SINGLE QUOTATION MARK
-    {0x2018, {
+     0x000, 0x000, 0x000, 0x000, 0x3FF, 0x000, 0x3FF, 0x000, },
+    // 367: U+2018 LEFT SINGLE QUOTATION MARK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x008, 0x018, 
      0x030, 0x030, 0x030, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2019 RIGHT SINGLE QUOTATION MARK
-    {0x2019, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 368: U+2019 RIGHT SINGLE QUOTATION MARK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x018, 0x018, 
      0x018, 0x030, 0x020, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+201A SINGLE LOW-9 QUOTATION MARK
-    {0x201A, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 369: U+201A SINGLE LOW-9 QUOTATION MARK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x030, 0x030, 0x030, 0x060, 0x040, 0x000, 0x000, 0x000, }},
-    // U+201C LEFT DOUBLE QUOTATION MARK
-    {0x201C, {
+     0x030, 0x030, 0x030, 0x060, 0x040, 0x000, 0x000, 0x000, },
+    // 370: U+201C LEFT DOUBLE QUOTATION MARK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x022, 0x066, 
      0x0CC, 0x0CC, 0x0CC, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+201D RIGHT DOUBLE QUOTATION MARK
-    {0x201D, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 371: U+201D RIGHT DOUBLE QUOTATION MARK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x066, 0x066, 
      0x066, 0x0CC, 0x088, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+201E DOUBLE LOW-9 QUOTATION MARK
-    {0x201E, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 372: U+201E DOUBLE LOW-9 QUOTATION MARK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x066, 0x066, 0x066, 0x0CC, 0x088, 0x000, 0x000, 0x000, }},
-    // U+2020 DAGGER
-    {0x2020, {
+     0x066, 0x066, 0x066, 0x0CC, 0x088, 0x000, 0x000, 0x000, },
+    // 373: U+2020 DAGGER
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x030, 
      0x030, 0x030, 0x1FE, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x000, 0x000, 0x000, }},
-    // U+2021 DOUBLE DAGGER
-    {0x2021, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x000, 0x000, 0x000, },
+    // 374: U+2021 DOUBLE DAGGER
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x030, 
      0x030, 0x030, 0x1FE, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x1FE, 0x030, 0x030, 0x030, 0x000, 0x000, 0x000, }},
-    // U+2022 BULLET
-    {0x2022, {
+     0x030, 0x1FE, 0x030, 0x030, 0x030, 0x000, 0x000, 0x000, },
+    // 375: U+2022 BULLET
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x038, 0x07C, 0x07C, 0x07C, 0x038, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2026 HORIZONTAL ELLIPSIS
-    {0x2026, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 376: U+2026 HORIZONTAL ELLIPSIS
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
-     0x1B6, 0x1B6, 0x1B6, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2030 PER MILLE SIGN
-    {0x2030, {
+     0x1B6, 0x1B6, 0x1B6, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 377: U+2030 PER MILLE SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1C0, 
      0x220, 0x220, 0x222, 0x1DC, 0x0E0, 0x300, 0x1CE, 0x231, 
-     0x231, 0x231, 0x1CE, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2039 SINGLE LEFT-POINTING ANGLE QUOTATION MARK
-    {0x2039, {
+     0x231, 0x231, 0x1CE, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 378: U+2039 SINGLE LEFT-POINTING ANGLE QUOTATION MARK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x008, 0x018, 0x030, 0x060, 0x060, 0x030, 
-     0x018, 0x008, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+203A SINGLE RIGHT-POINTING ANGLE QUOTATION MARK
-    {0x203A, {
+     0x018, 0x008, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 379: U+203A SINGLE RIGHT-POINTING ANGLE QUOTATION MARK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x040, 0x060, 0x030, 0x018, 0x018, 0x030, 
-     0x060, 0x040, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+207F SUPERSCRIPT LATIN SMALL LETTER N
-    {0x207F, {
+     0x060, 0x040, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 380: U+207F SUPERSCRIPT LATIN SMALL LETTER N
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x078, 0x044, 0x044, 0x044, 0x044, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+20A7 PESETA SIGN
-    {0x20A7, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 381: U+20A7 PESETA SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x3E0, 0x260, 
      0x27A, 0x27F, 0x264, 0x2E8, 0x3A4, 0x227, 0x221, 0x221, 
-     0x219, 0x21F, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+20AC EURO SIGN
-    {0x20AC, {
+     0x219, 0x21F, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 382: U+20AC EURO SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x03C, 
      0x062, 0x0C0, 0x1FC, 0x0C0, 0x0C0, 0x1F8, 0x0C0, 0x0C0, 
-     0x060, 0x062, 0x01C, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2116 NUMERO SIGN
-    {0x2116, {
+     0x060, 0x062, 0x01C, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 383: U+2116 NUMERO SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x198, 0x190, 
      0x1D0, 0x1D0, 0x1D0, 0x1D0, 0x1D7, 0x1D5, 0x1B5, 0x1B3, 
-     0x3B0, 0x337, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2122 TRADE MARK SIGN
-    {0x2122, {
+     0x3B0, 0x337, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 384: U+2122 TRADE MARK SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x3B6, 
      0x136, 0x12A, 0x122, 0x122, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2219 BULLET OPERATOR
-    {0x2219, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 385: U+2219 BULLET OPERATOR
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x038, 0x07C, 0x07C, 0x07C, 0x038, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+221A SQUARE ROOT
-    {0x221A, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 386: U+221A SQUARE ROOT
+    {
      0x000, 0x000, 0x000, 0x000, 0x002, 0x004, 0x004, 0x004, 
      0x004, 0x008, 0x188, 0x388, 0x090, 0x050, 0x050, 0x050, 
-     0x060, 0x020, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+221E INFINITY
-    {0x221E, {
+     0x060, 0x020, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 387: U+221E INFINITY
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x1CE, 0x279, 0x231, 0x231, 0x279, 
-     0x1CE, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2229 INTERSECTION
-    {0x2229, {
+     0x1CE, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 388: U+2229 INTERSECTION
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x078, 0x0FC, 0x086, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2248 ALMOST EQUAL TO
-    {0x2248, {
+     0x186, 0x186, 0x186, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 389: U+2248 ALMOST EQUAL TO
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x0F1, 0x1FF, 0x10E, 0x000, 0x0F1, 0x1FF, 
-     0x10E, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2261 IDENTICAL TO
-    {0x2261, {
+     0x10E, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 390: U+2261 IDENTICAL TO
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x1FF, 0x000, 0x000, 0x1FF, 0x000, 0x000, 0x1FF, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2264 LESS-THAN OR EQUAL TO
-    {0x2264, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 391: U+2264 LESS-THAN OR EQUAL TO
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x003, 0x01F, 0x0F8, 0x180, 0x0F8, 0x01F, 
-     0x003, 0x1FF, 0x1FF, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2265 GREATER-THAN OR EQUAL TO
-    {0x2265, {
+     0x003, 0x1FF, 0x1FF, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 392: U+2265 GREATER-THAN OR EQUAL TO
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x180, 0x1F0, 0x03E, 0x003, 0x03E, 0x1F0, 
-     0x180, 0x1FF, 0x1FF, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2310 REVERSED NOT SIGN
-    {0x2310, {
+     0x180, 0x1FF, 0x1FF, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 393: U+2310 REVERSED NOT SIGN
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x1FF, 0x100, 0x100, 0x100, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2320 TOP HALF INTEGRAL
-    {0x2320, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 394: U+2320 TOP HALF INTEGRAL
+    {
      0x000, 0x000, 0x000, 0x00E, 0x01E, 0x010, 0x010, 0x010, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x000, }},
-    // U+2321 BOTTOM HALF INTEGRAL
-    {0x2321, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x000, },
+    // 395: U+2321 BOTTOM HALF INTEGRAL
+    {
      0x000, 0x000, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x020, 0x020, 0x1A0, 0x1C0, 0x000, 0x000, }},
-    // U+2500 BOX DRAWINGS LIGHT HORIZONTAL
-    {0x2500, {
+     0x030, 0x030, 0x020, 0x020, 0x1A0, 0x1C0, 0x000, 0x000, },
+    // 396: U+2500 BOX DRAWINGS LIGHT HORIZONTAL
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x3FF, 0x3FF, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2502 BOX DRAWINGS LIGHT VERTICAL
-    {0x2502, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 397: U+2502 BOX DRAWINGS LIGHT VERTICAL
+    {
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, }},
-    // U+250C BOX DRAWINGS LIGHT DOWN AND RIGHT
-    {0x250C, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, },
+    // 398: U+250C BOX DRAWINGS LIGHT DOWN AND RIGHT
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x03F, 0x03F, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, }},
-    // U+2510 BOX DRAWINGS LIGHT DOWN AND LEFT
-    {0x2510, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, },
+    // 399: U+2510 BOX DRAWINGS LIGHT DOWN AND LEFT
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x3F0, 0x3F0, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, }},
-    // U+2514 BOX DRAWINGS LIGHT UP AND RIGHT
-    {0x2514, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, },
+    // 400: U+2514 BOX DRAWINGS LIGHT UP AND RIGHT
+    {
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
      0x030, 0x030, 0x030, 0x03F, 0x03F, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2518 BOX DRAWINGS LIGHT UP AND LEFT
-    {0x2518, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 401: U+2518 BOX DRAWINGS LIGHT UP AND LEFT
+    {
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
      0x030, 0x030, 0x030, 0x3F0, 0x3F0, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+251C BOX DRAWINGS LIGHT VERTICAL AND RIGHT
-    {0x251C, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 402: U+251C BOX DRAWINGS LIGHT VERTICAL AND RIGHT
+    {
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
      0x030, 0x030, 0x030, 0x03F, 0x03F, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, }},
-    // U+2524 BOX DRAWINGS LIGHT VERTICAL AND LEFT
-    {0x2524, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, },
+    // 403: U+2524 BOX DRAWINGS LIGHT VERTICAL AND LEFT
+    {
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
      0x030, 0x030, 0x030, 0x3F0, 0x3F0, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, }},
-    // U+252C BOX DRAWINGS LIGHT DOWN AND HORIZONTAL
-    {0x252C, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, },
+    // 404: U+252C BOX DRAWINGS LIGHT DOWN AND HORIZONTAL
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x3FF, 0x3FF, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, }},
-    // U+2534 BOX DRAWINGS LIGHT UP AND HORIZONTAL
-    {0x2534, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, },
+    // 405: U+2534 BOX DRAWINGS LIGHT UP AND HORIZONTAL
+    {
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
      0x030, 0x030, 0x030, 0x3FF, 0x3FF, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+253C BOX DRAWINGS LIGHT VERTICAL AND HORIZONTAL
-    {0x253C, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 406: U+253C BOX DRAWINGS LIGHT VERTICAL AND HORIZONTAL
+    {
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
      0x030, 0x030, 0x030, 0x3FF, 0x3FF, 0x030, 0x030, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, }},
-    // U+2550 BOX DRAWINGS DOUBLE HORIZONTAL
-    {0x2550, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, },
+    // 407: U+2550 BOX DRAWINGS DOUBLE HORIZONTAL
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x3FF, 0x3FF, 0x000, 0x000, 0x3FF, 0x3FF, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2551 BOX DRAWINGS DOUBLE VERTICAL
-    {0x2551, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 408: U+2551 BOX DRAWINGS DOUBLE VERTICAL
+    {
      0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 
      0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 
-     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, }},
-    // U+2552 BOX DRAWINGS DOWN SINGLE AND RIGHT DOUBLE
-    {0x2552, {
+     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, },
+    // 409: U+2552 BOX DRAWINGS DOWN SINGLE AND RIGHT DOUBLE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x03F, 0x03F, 0x030, 0x030, 0x03F, 0x03F, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, }},
-    // U+2553 BOX DRAWINGS DOWN DOUBLE AND RIGHT SINGLE
-    {0x2553, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, },
+    // 410: U+2553 BOX DRAWINGS DOWN DOUBLE AND RIGHT SINGLE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x0FF, 0x0FF, 0x0CC, 0x0CC, 0x0CC, 
-     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, }},
-    // U+2554 BOX DRAWINGS DOUBLE DOWN AND RIGHT
-    {0x2554, {
+     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, },
+    // 411: U+2554 BOX DRAWINGS DOUBLE DOWN AND RIGHT
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x0FF, 0x0FF, 0x0C0, 0x0C0, 0x0CF, 0x0CF, 0x0CC, 
-     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, }},
-    // U+2555 BOX DRAWINGS DOWN SINGLE AND LEFT DOUBLE
-    {0x2555, {
+     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, },
+    // 412: U+2555 BOX DRAWINGS DOWN SINGLE AND LEFT DOUBLE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x3F0, 0x3F0, 0x030, 0x030, 0x3F0, 0x3F0, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, }},
-    // U+2556 BOX DRAWINGS DOWN DOUBLE AND LEFT SINGLE
-    {0x2556, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, },
+    // 413: U+2556 BOX DRAWINGS DOWN DOUBLE AND LEFT SINGLE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x3FC, 0x3FC, 0x0CC, 0x0CC, 0x0CC, 
-     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, }},
-    // U+2557 BOX DRAWINGS DOUBLE DOWN AND LEFT
-    {0x2557, {
+     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, },
+    // 414: U+2557 BOX DRAWINGS DOUBLE DOWN AND LEFT
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x3FC, 0x3FC, 0x00C, 0x00C, 0x3CC, 0x3CC, 0x0CC, 
-     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, }},
-    // U+2558 BOX DRAWINGS UP SINGLE AND RIGHT DOUBLE
-    {0x2558, {
+     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, },
+    // 415: U+2558 BOX DRAWINGS UP SINGLE AND RIGHT DOUBLE
+    {
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
      0x030, 0x03F, 0x03F, 0x030, 0x030, 0x03F, 0x03F, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2559 BOX DRAWINGS UP DOUBLE AND RIGHT SINGLE
-    {0x2559, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 416: U+2559 BOX DRAWINGS UP DOUBLE AND RIGHT SINGLE
+    {
      0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 
      0x0CC, 0x0CC, 0x0CC, 0x0FF, 0x0FF, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+255A BOX DRAWINGS DOUBLE UP AND RIGHT
-    {0x255A, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 417: U+255A BOX DRAWINGS DOUBLE UP AND RIGHT
+    {
      0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 
      0x0CC, 0x0CF, 0x0CF, 0x0C0, 0x0C0, 0x0FF, 0x0FF, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+255B BOX DRAWINGS UP SINGLE AND LEFT DOUBLE
-    {0x255B, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 418: U+255B BOX DRAWINGS UP SINGLE AND LEFT DOUBLE
+    {
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
      0x030, 0x3F0, 0x3F0, 0x030, 0x030, 0x3F0, 0x3F0, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+255C BOX DRAWINGS UP DOUBLE AND LEFT SINGLE
-    {0x255C, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 419: U+255C BOX DRAWINGS UP DOUBLE AND LEFT SINGLE
+    {
      0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 
      0x0CC, 0x0CC, 0x0CC, 0x3FC, 0x3FC, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+255D BOX DRAWINGS DOUBLE UP AND LEFT
-    {0x255D, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 420: U+255D BOX DRAWINGS DOUBLE UP AND LEFT
+    {
      0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 
      0x0CC, 0x3CC, 0x3CC, 0x00C, 0x00C, 0x3FC, 0x3FC, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+255E BOX DRAWINGS VERTICAL SINGLE AND RIGHT DOUBLE
-    {0x255E, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 421: U+255E BOX DRAWINGS VERTICAL SINGLE AND RIGHT DOUBLE
+    {
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
      0x030, 0x03F, 0x03F, 0x030, 0x030, 0x03F, 0x03F, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, }},
-    // U+255F BOX DRAWINGS VERTICAL DOUBLE AND RIGHT SINGLE
-    {0x255F, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, },
+    // 422: U+255F BOX DRAWINGS VERTICAL DOUBLE AND RIGHT SINGLE
+    {
      0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 
      0x0CC, 0x0CC, 0x0CC, 0x0CF, 0x0CF, 0x0CC, 0x0CC, 0x0CC, 
-     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, }},
-    // U+2560 BOX DRAWINGS DOUBLE VERTICAL AND RIGHT
-    {0x2560, {
+     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, },
+    // 423: U+2560 BOX DRAWINGS DOUBLE VERTICAL AND RIGHT
+    {
      0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 
      0x0CC, 0x0CF, 0x0CF, 0x0C0, 0x0C0, 0x0CF, 0x0CF, 0x0CC, 
-     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, }},
-    // U+2561 BOX DRAWINGS VERTICAL SINGLE AND LEFT DOUBLE
-    {0x2561, {
+     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, },
+    // 424: U+2561 BOX DRAWINGS VERTICAL SINGLE AND LEFT DOUBLE
+    {
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
      0x030, 0x3F0, 0x3F0, 0x030, 0x030, 0x3F0, 0x3F0, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, }},
-    // U+2562 BOX DRAWINGS VERTICAL DOUBLE AND LEFT SINGLE
-    {0x2562, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, },
+    // 425: U+2562 BOX DRAWINGS VERTICAL DOUBLE AND LEFT SINGLE
+    {
      0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 
      0x0CC, 0x0CC, 0x0CC, 0x3CC, 0x3CC, 0x0CC, 0x0CC, 0x0CC, 
-     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, }},
-    // U+2563 BOX DRAWINGS DOUBLE VERTICAL AND LEFT
-    {0x2563, {
+     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, },
+    // 426: U+2563 BOX DRAWINGS DOUBLE VERTICAL AND LEFT
+    {
      0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 
      0x0CC, 0x3CC, 0x3CC, 0x00C, 0x00C, 0x3CC, 0x3CC, 0x0CC, 
-     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, }},
-    // U+2564 BOX DRAWINGS DOWN SINGLE AND HORIZONTAL DOUBLE
-    {0x2564, {
+     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, },
+    // 427: U+2564 BOX DRAWINGS DOWN SINGLE AND HORIZONTAL DOUBLE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x3FF, 0x3FF, 0x000, 0x000, 0x3FF, 0x3FF, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, }},
-    // U+2565 BOX DRAWINGS DOWN DOUBLE AND HORIZONTAL SINGLE
-    {0x2565, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, },
+    // 428: U+2565 BOX DRAWINGS DOWN DOUBLE AND HORIZONTAL SINGLE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x3FF, 0x3FF, 0x0CC, 0x0CC, 0x0CC, 
-     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, }},
-    // U+2566 BOX DRAWINGS DOUBLE DOWN AND HORIZONTAL
-    {0x2566, {
+     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, },
+    // 429: U+2566 BOX DRAWINGS DOUBLE DOWN AND HORIZONTAL
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x3FF, 0x3FF, 0x000, 0x000, 0x3CF, 0x3CF, 0x0CC, 
-     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, }},
-    // U+2567 BOX DRAWINGS UP SINGLE AND HORIZONTAL DOUBLE
-    {0x2567, {
+     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, },
+    // 430: U+2567 BOX DRAWINGS UP SINGLE AND HORIZONTAL DOUBLE
+    {
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
      0x030, 0x3FF, 0x3FF, 0x000, 0x000, 0x3FF, 0x3FF, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2568 BOX DRAWINGS UP DOUBLE AND HORIZONTAL SINGLE
-    {0x2568, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 431: U+2568 BOX DRAWINGS UP DOUBLE AND HORIZONTAL SINGLE
+    {
      0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 
      0x0CC, 0x0CC, 0x0CC, 0x3FF, 0x3FF, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2569 BOX DRAWINGS DOUBLE UP AND HORIZONTAL
-    {0x2569, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 432: U+2569 BOX DRAWINGS DOUBLE UP AND HORIZONTAL
+    {
      0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 
      0x0CC, 0x3CF, 0x3CF, 0x000, 0x000, 0x3FF, 0x3FF, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+256A BOX DRAWINGS VERTICAL SINGLE AND HORIZONTAL DOUBLE
-    {0x256A, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 433: U+256A BOX DRAWINGS VERTICAL SINGLE AND HORIZONTAL DOUBLE
+    {
      0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 
      0x030, 0x3FF, 0x3FF, 0x030, 0x030, 0x3FF, 0x3FF, 0x030, 
-     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, }},
-    // U+256B BOX DRAWINGS VERTICAL DOUBLE AND HORIZONTAL SINGLE
-    {0x256B, {
+     0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, 0x030, },
+    // 434: U+256B BOX DRAWINGS VERTICAL DOUBLE AND HORIZONTAL SINGLE
+    {
      0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 
      0x0CC, 0x0CC, 0x0CC, 0x3FF, 0x3FF, 0x0CC, 0x0CC, 0x0CC, 
-     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, }},
-    // U+256C BOX DRAWINGS DOUBLE VERTICAL AND HORIZONTAL
-    {0x256C, {
+     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, },
+    // 435: U+256C BOX DRAWINGS DOUBLE VERTICAL AND HORIZONTAL
+    {
      0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 
      0x0CC, 0x3CF, 0x3CF, 0x000, 0x000, 0x3CF, 0x3CF, 0x0CC, 
-     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, }},
-    // U+2580 UPPER HALF BLOCK
-    {0x2580, {
+     0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, 0x0CC, },
+    // 436: U+2580 UPPER HALF BLOCK
+    {
      0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 
      0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x000, 0x000, 0x000, 0x000, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+2584 LOWER HALF BLOCK
-    {0x2584, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 437: U+2584 LOWER HALF BLOCK
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x000, 0x000, 0x000, 0x000, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 
-     0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, }},
-    // U+2588 FULL BLOCK
-    {0x2588, {
+     0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, },
+    // 438: U+2588 FULL BLOCK
+    {
      0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 
      0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 
-     0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, }},
-    // U+258C LEFT HALF BLOCK
-    {0x258C, {
+     0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, 0x3FF, },
+    // 439: U+258C LEFT HALF BLOCK
+    {
      0x3E0, 0x3E0, 0x3E0, 0x3E0, 0x3E0, 0x3E0, 0x3E0, 0x3E0, 
      0x3E0, 0x3E0, 0x3E0, 0x3E0, 0x3E0, 0x3E0, 0x3E0, 0x3E0, 
-     0x3E0, 0x3E0, 0x3E0, 0x3E0, 0x3E0, 0x3E0, 0x3E0, 0x3E0, }},
-    // U+2590 RIGHT HALF BLOCK
-    {0x2590, {
+     0x3E0, 0x3E0, 0x3E0, 0x3E0, 0x3E0, 0x3E0, 0x3E0, 0x3E0, },
+    // 440: U+2590 RIGHT HALF BLOCK
+    {
      0x01F, 0x01F, 0x01F, 0x01F, 0x01F, 0x01F, 0x01F, 0x01F, 
      0x01F, 0x01F, 0x01F, 0x01F, 0x01F, 0x01F, 0x01F, 0x01F, 
-     0x01F, 0x01F, 0x01F, 0x01F, 0x01F, 0x01F, 0x01F, 0x01F, }},
-    // U+2591 LIGHT SHADE
-    {0x2591, {
+     0x01F, 0x01F, 0x01F, 0x01F, 0x01F, 0x01F, 0x01F, 0x01F, },
+    // 441: U+2591 LIGHT SHADE
+    {
      0x2AA, 0x000, 0x2AA, 0x000, 0x2AA, 0x000, 0x2AA, 0x000, 
      0x2AA, 0x000, 0x2AA, 0x000, 0x2AA, 0x000, 0x2AA, 0x000, 
-     0x2AA, 0x000, 0x2AA, 0x000, 0x2AA, 0x000, 0x2AA, 0x000, }},
-    // U+2592 MEDIUM SHADE
-    {0x2592, {
+     0x2AA, 0x000, 0x2AA, 0x000, 0x2AA, 0x000, 0x2AA, 0x000, },
+    // 442: U+2592 MEDIUM SHADE
+    {
      0x2AA, 0x155, 0x2AA, 0x155, 0x2AA, 0x155, 0x2AA, 0x155, 
      0x2AA, 0x155, 0x2AA, 0x155, 0x2AA, 0x155, 0x2AA, 0x155, 
-     0x2AA, 0x155, 0x2AA, 0x155, 0x2AA, 0x155, 0x2AA, 0x155, }},
-    // U+2593 DARK SHADE
-    {0x2593, {
+     0x2AA, 0x155, 0x2AA, 0x155, 0x2AA, 0x155, 0x2AA, 0x155, },
+    // 443: U+2593 DARK SHADE
+    {
      0x3FF, 0x2AA, 0x3FF, 0x2AA, 0x3FF, 0x2AA, 0x3FF, 0x2AA, 
      0x3FF, 0x2AA, 0x3FF, 0x2AA, 0x3FF, 0x2AA, 0x3FF, 0x2AA, 
-     0x3FF, 0x2AA, 0x3FF, 0x2AA, 0x3FF, 0x2AA, 0x3FF, 0x2AA, }},
-    // U+25A0 BLACK SQUARE
-    {0x25A0, {
+     0x3FF, 0x2AA, 0x3FF, 0x2AA, 0x3FF, 0x2AA, 0x3FF, 0x2AA, },
+    // 444: U+25A0 BLACK SQUARE
+    {
      0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 
      0x1FE, 0x1FE, 0x1FE, 0x1FE, 0x1FE, 0x1FE, 0x1FE, 0x1FE, 
-     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, }},
-    // U+FFFD REPLACEMENT CHARACTER
-    {0xFFFD, {
+     0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, },
+    // 445: U+FFFD REPLACEMENT CHARACTER
+    {
      0x000, 0x000, 0x000, 0x000, 0x1FE, 0x1FE, 0x186, 0x186, 
      0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 0x186, 
-     0x186, 0x186, 0x1FE, 0x1FE, 0x000, 0x000, 0x000, 0x000, }},
+     0x186, 0x186, 0x1FE, 0x1FE, 0x000, 0x000, 0x000, 0x000, },
+};
+
+// The page tables below point into kRows: the glyph of U+hhll is entry ll of
+// the page for hh, null when there is none, and the page of a high byte with
+// no glyphs at all is the empty one.
+const unsigned short *const kNoGlyphs[256] = {};
+
+const unsigned short *const kPage00[256] = {
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    kRows[0], kRows[1], kRows[2], kRows[3], kRows[4], kRows[5], kRows[6], kRows[7], 
+    kRows[8], kRows[9], kRows[10], kRows[11], kRows[12], kRows[13], kRows[14], kRows[15], 
+    kRows[16], kRows[17], kRows[18], kRows[19], kRows[20], kRows[21], kRows[22], kRows[23], 
+    kRows[24], kRows[25], kRows[26], kRows[27], kRows[28], kRows[29], kRows[30], kRows[31], 
+    kRows[32], kRows[33], kRows[34], kRows[35], kRows[36], kRows[37], kRows[38], kRows[39], 
+    kRows[40], kRows[41], kRows[42], kRows[43], kRows[44], kRows[45], kRows[46], kRows[47], 
+    kRows[48], kRows[49], kRows[50], kRows[51], kRows[52], kRows[53], kRows[54], kRows[55], 
+    kRows[56], kRows[57], kRows[58], kRows[59], kRows[60], kRows[61], kRows[62], kRows[63], 
+    kRows[64], kRows[65], kRows[66], kRows[67], kRows[68], kRows[69], kRows[70], kRows[71], 
+    kRows[72], kRows[73], kRows[74], kRows[75], kRows[76], kRows[77], kRows[78], kRows[79], 
+    kRows[80], kRows[81], kRows[82], kRows[83], kRows[84], kRows[85], kRows[86], kRows[87], 
+    kRows[88], kRows[89], kRows[90], kRows[91], kRows[92], kRows[93], kRows[94], NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    kRows[95], kRows[96], kRows[97], kRows[98], kRows[99], kRows[100], kRows[101], kRows[102], 
+    kRows[103], kRows[104], kRows[105], kRows[106], kRows[107], kRows[108], kRows[109], kRows[110], 
+    kRows[111], kRows[112], kRows[113], kRows[114], kRows[115], kRows[116], kRows[117], kRows[118], 
+    kRows[119], kRows[120], kRows[121], kRows[122], kRows[123], kRows[124], kRows[125], kRows[126], 
+    kRows[127], kRows[128], kRows[129], kRows[130], kRows[131], kRows[132], kRows[133], kRows[134], 
+    kRows[135], kRows[136], kRows[137], kRows[138], kRows[139], kRows[140], kRows[141], kRows[142], 
+    kRows[143], kRows[144], kRows[145], kRows[146], kRows[147], kRows[148], kRows[149], kRows[150], 
+    kRows[151], kRows[152], kRows[153], kRows[154], kRows[155], kRows[156], kRows[157], kRows[158], 
+    kRows[159], kRows[160], kRows[161], kRows[162], kRows[163], kRows[164], kRows[165], kRows[166], 
+    kRows[167], kRows[168], kRows[169], kRows[170], kRows[171], kRows[172], kRows[173], kRows[174], 
+    kRows[175], kRows[176], kRows[177], kRows[178], kRows[179], kRows[180], kRows[181], kRows[182], 
+    kRows[183], kRows[184], kRows[185], kRows[186], kRows[187], kRows[188], kRows[189], kRows[190], 
+};
+
+const unsigned short *const kPage01[256] = {
+    NULL, NULL, kRows[191], kRows[192], kRows[193], kRows[194], kRows[195], kRows[196], 
+    NULL, NULL, NULL, NULL, kRows[197], kRows[198], kRows[199], kRows[200], 
+    kRows[201], kRows[202], NULL, NULL, NULL, NULL, NULL, NULL, 
+    kRows[203], kRows[204], kRows[205], kRows[206], NULL, NULL, kRows[207], kRows[208], 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    kRows[209], kRows[210], NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, kRows[211], kRows[212], NULL, NULL, kRows[213], kRows[214], NULL, 
+    NULL, kRows[215], kRows[216], kRows[217], kRows[218], NULL, NULL, kRows[219], 
+    kRows[220], NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    kRows[221], kRows[222], kRows[223], kRows[224], kRows[225], kRows[226], NULL, NULL, 
+    kRows[227], kRows[228], kRows[229], kRows[230], NULL, NULL, kRows[231], kRows[232], 
+    kRows[233], kRows[234], kRows[235], kRows[236], kRows[237], kRows[238], NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, kRows[239], kRows[240], 
+    kRows[241], kRows[242], NULL, NULL, NULL, NULL, NULL, NULL, 
+    kRows[243], kRows[244], kRows[245], kRows[246], kRows[247], kRows[248], kRows[249], NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, kRows[250], NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
 };
 
-const size_t kGlyphCount = sizeof(kGlyphs) / sizeof(kGlyphs[0]);
+const unsigned short *const kPage02[256] = {
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, kRows[251], kRows[252], 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    kRows[253], kRows[254], NULL, kRows[255], kRows[256], kRows[257], NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+};
+
+const unsigned short *const kPage03[256] = {
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, kRows[258], NULL, NULL, NULL, NULL, 
+    kRows[259], NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, kRows[260], NULL, NULL, kRows[261], NULL, 
+    NULL, kRows[262], NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, kRows[263], NULL, NULL, kRows[264], kRows[265], NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    kRows[266], NULL, NULL, kRows[267], kRows[268], NULL, kRows[269], NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+};
+
+const unsigned short *const kPage04[256] = {
+    NULL, kRows[270], kRows[271], kRows[272], kRows[273], kRows[274], kRows[275], kRows[276], 
+    kRows[277], kRows[278], kRows[279], kRows[280], kRows[281], NULL, kRows[282], kRows[283], 
+    kRows[284], kRows[285], kRows[286], kRows[287], kRows[288], kRows[289], kRows[290], kRows[291], 
+    kRows[292], kRows[293], kRows[294], kRows[295], kRows[296], kRows[297], kRows[298], kRows[299], 
+    kRows[300], kRows[301], kRows[302], kRows[303], kRows[304], kRows[305], kRows[306], kRows[307], 
+    kRows[308], kRows[309], kRows[310], kRows[311], kRows[312], kRows[313], kRows[314], kRows[315], 
+    kRows[316], kRows[317], kRows[318], kRows[319], kRows[320], kRows[321], kRows[322], kRows[323], 
+    kRows[324], kRows[325], kRows[326], kRows[327], kRows[328], kRows[329], kRows[330], kRows[331], 
+    kRows[332], kRows[333], kRows[334], kRows[335], kRows[336], kRows[337], kRows[338], kRows[339], 
+    kRows[340], kRows[341], kRows[342], kRows[343], kRows[344], kRows[345], kRows[346], kRows[347], 
+    NULL, kRows[348], kRows[349], kRows[350], kRows[351], kRows[352], kRows[353], kRows[354], 
+    kRows[355], kRows[356], kRows[357], kRows[358], kRows[359], NULL, kRows[360], kRows[361], 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    kRows[362], kRows[363], NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+};
+
+const unsigned short *const kPage20[256] = {
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, kRows[364], kRows[365], NULL, NULL, kRows[366], 
+    kRows[367], kRows[368], kRows[369], NULL, kRows[370], kRows[371], kRows[372], NULL, 
+    kRows[373], kRows[374], kRows[375], NULL, NULL, NULL, kRows[376], NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    kRows[377], NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, kRows[378], kRows[379], NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, kRows[380], 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, kRows[381], 
+    NULL, NULL, NULL, NULL, kRows[382], NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+};
+
+const unsigned short *const kPage21[256] = {
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, kRows[383], NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, kRows[384], NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+};
+
+const unsigned short *const kPage22[256] = {
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, kRows[385], kRows[386], NULL, NULL, NULL, kRows[387], NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, kRows[388], NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    kRows[389], NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, kRows[390], NULL, NULL, kRows[391], kRows[392], NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+};
+
+const unsigned short *const kPage23[256] = {
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    kRows[393], NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    kRows[394], kRows[395], NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+};
+
+const unsigned short *const kPage25[256] = {
+    kRows[396], NULL, kRows[397], NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, kRows[398], NULL, NULL, NULL, 
+    kRows[399], NULL, NULL, NULL, kRows[400], NULL, NULL, NULL, 
+    kRows[401], NULL, NULL, NULL, kRows[402], NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, kRows[403], NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, kRows[404], NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, kRows[405], NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, kRows[406], NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    kRows[407], kRows[408], kRows[409], kRows[410], kRows[411], kRows[412], kRows[413], kRows[414], 
+    kRows[415], kRows[416], kRows[417], kRows[418], kRows[419], kRows[420], kRows[421], kRows[422], 
+    kRows[423], kRows[424], kRows[425], kRows[426], kRows[427], kRows[428], kRows[429], kRows[430], 
+    kRows[431], kRows[432], kRows[433], kRows[434], kRows[435], NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    kRows[436], NULL, NULL, NULL, kRows[437], NULL, NULL, NULL, 
+    kRows[438], NULL, NULL, NULL, kRows[439], NULL, NULL, NULL, 
+    kRows[440], kRows[441], kRows[442], kRows[443], NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    kRows[444], NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+};
+
+const unsigned short *const kPageFF[256] = {
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, 
+    NULL, NULL, NULL, NULL, NULL, kRows[445], NULL, NULL, 
+};
+
+
+// By the high byte of the code point. Entry 256, the empty page, stands for
+// every code point past U+FFFF.
+const unsigned short *const *const kPages[257] = {
+    kPage00, kPage01, kPage02, kPage03, kPage04, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kPage20, kPage21, kPage22, kPage23, kNoGlyphs, kPage25, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, 
+    kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kNoGlyphs, kPageFF, 
+    kNoGlyphs, 
+};
 
 } // namespace
 
 const unsigned short *FontBGlyph(wchar_t ch) {
+  // Two loads and no branch: min() clamps the page without one.
   unsigned int code = (unsigned int)ch;
-  if (code > 0xFFFF) return NULL;
-  size_t lo = 0, hi = kGlyphCount;
-  while (lo < hi) {
-    size_t mid = lo + (hi - lo) / 2;
-    if (kGlyphs[mid].code < code) lo = mid + 1;
-    else hi = mid;
-  }
-  if (lo < kGlyphCount && kGlyphs[lo].code == code) return kGlyphs[lo].rows;
-  return NULL;
+  return kPages[std::min(code >> 8, 256u)][code & 0xFF];
 }
@@ -16,6 +16,7 @@ let package = Package(
             sources: [
                 "Network.cpp",
                 "VirtualPrinter.cpp",
+                "PaperArchive.cpp",
                 "Barcode.cpp",
                 "CodePages.cpp",
                 "QRCode.cpp",
@@ -2,34 +2,97 @@
 #import "PrinterView.h"
 
 // C++ headers
+#include "../ByteRing.h"
 #include "../Network.h"
 #include "../VirtualPrinter.h"
+#include <memory>
+#include <mutex>
 
 @interface AppDelegate ()
 @property(strong, nonatomic) PrinterView *printerView;
 @property(strong, nonatomic) NSStatusItem *statusItem;
 @property(weak, nonatomic) NSMenuItem *alwaysOnTopItem;
+- (void)updateTitle;
 @end
 
 // Global instance to bridge C++ callback to ObjC
 VirtualPrinter printer;
 NetworkServer server;
-std::vector<unsigned char> g_rawBuffer;
-const size_t MAX_BUFFER_SIZE = 1024 * 1024; // 1MB Limit
+// What was received, for "Salvar...": the last bytes of all the connections
+// together, and those of the last connection to close, which is normally one
+// receipt. Connections append from their own threads.
+ByteRing g_rawCapture(1024 * 1024);
+std::shared_ptr<ByteRing> g_lastConnection;
 int g_port = 9100;
 int g_columns = 0;
+int g_memoryLimitMB = 256; // paper kept in memory; oldest receipts go past it
+int g_captureKB = 1024;     // size of each raw capture ring
+size_t g_archivedJob = 0;  // archived receipt on show, from 1; 0 = the paper
 int g_fontSize = 16;
 bool g_alwaysOnTop = false;
+bool g_realSpeed = false; // print at the pace of RealSpeedProfile()
+
+// "Velocidade real": a typical 80 mm thermal printer, 250 mm/s with a 4 KB
+// receive buffer, to see how the point of sale copes with its pace.
+static PrinterProfile RealSpeedProfile() {
+  PrinterProfile profile;
+  profile.printSpeedMmPerSec = 250;
+  profile.cutMs = 300;
+  profile.receiveBufferBytes = 4096;
+  return profile;
+}
+
+// A terminal that connects and never sends, or opens connection after
+// connection, must not keep the others from printing.
+static NetworkServer::Limits ServerLimits() {
+  NetworkServer::Limits limits;
+  limits.maxConnections = 32;
+  limits.queueLength = 32;
+  limits.idleTimeoutMs = 5 * 60 * 1000;
+  return limits;
+}
 
-void RepaintCallback(void *param) {
+// Called at most once a frame, from the printer's notifier thread.
+void RepaintCallback(const PaperChange &change, void *param) {
   AppDelegate *delegate = (__bridge AppDelegate *)param;
+  BOOL restarted = change.restarted;
   dispatch_async(dispatch_get_main_queue(), ^{
-    [delegate.printerView setNeedsDisplay:YES];
+    [delegate updateTitle];
+    [delegate.printerView paperChanged:restarted];
+  });
+}
+
+// What `capture` holds, oldest first, in one piece.
+static NSData *CaptureData(ByteRing &capture) {
+  NSMutableData *data = [NSMutableData data];
+  capture.ForEachSpan([data](const unsigned char *bytes, size_t length) {
+    [data appendBytes:bytes length:length];
   });
+  return data;
 }
 
 @implementation AppDelegate
 
+// Port and the memory the paper holds, or the archived receipt on show.
+- (void)updateTitle {
+  if (g_archivedJob > 0) {
+    [self.window
+        setTitle:[NSString stringWithFormat:@"Impressora ESC/POS Virtual (Porto "
+                                            @"%d) - Recibo arquivado %zu de %zu",
+                                            g_port, g_archivedJob,
+                                            printer.GetArchivedJobCount()]];
+    return;
+  }
+  PaperUsage usage = printer.GetPaperUsage();
+  [self.window
+      setTitle:[NSString
+                   stringWithFormat:@"Impressora ESC/POS Virtual (Porto %d) - "
+                                    @"%.1f MB",
+                                    g_port,
+                                    (usage.bytes + usage.liveBytes) /
+                                        (1024.0 * 1024.0)]];
+}
+
 - (void)setupMenu {
   NSMenu *menubar = [[NSMenu alloc] init];
   [NSApp setMainMenu:menubar];
@@ -53,6 +116,9 @@ void RepaintCallback(void *param) {
   [fileMenu addItemWithTitle:@"Salvar..."
                       action:@selector(saveOutput:)
                keyEquivalent:@"s"];
+  [fileMenu addItemWithTitle:@"Salvar última ligação..."
+                      action:@selector(saveLastConnection:)
+               keyEquivalent:@""];
   [fileMenu addItemWithTitle:@"Limpar"
                       action:@selector(clearBuffer:)
                keyEquivalent:@"l"];
@@ -72,6 +138,15 @@ void RepaintCallback(void *param) {
   [settingsMenu addItemWithTitle:@"Tamanho do texto..."
                           action:@selector(changeFontSize:)
                    keyEquivalent:@"f"];
+  [settingsMenu addItemWithTitle:@"Limite de memória..."
+                          action:@selector(changeMemoryLimit:)
+                   keyEquivalent:@"m"];
+  [settingsMenu addItemWithTitle:@"Recibo arquivado..."
+                          action:@selector(showArchivedReceipt:)
+                   keyEquivalent:@"a"];
+  [settingsMenu addItemWithTitle:@"Tamanho da captura..."
+                          action:@selector(changeCaptureSize:)
+                   keyEquivalent:@""];
 
   NSMenuItem *alwaysOnTopItem =
       [settingsMenu addItemWithTitle:@"Sempre no topo"
@@ -81,6 +156,33 @@ void RepaintCallback(void *param) {
                                           : NSControlStateValueOff];
   self.alwaysOnTopItem = alwaysOnTopItem;
 
+  // What the printer answers to status requests (DLE EOT, GS r, ASB), to see
+  // how the point of sale copes with a printer that needs attention. Each
+  // item's tag says which flag of PrinterStatus it toggles.
+  NSMenuItem *statusMenuItem =
+      [settingsMenu addItemWithTitle:@"Estado da impressora"
+                              action:nil
+                       keyEquivalent:@""];
+  NSMenu *statusMenu = [[NSMenu alloc] initWithTitle:@"Estado da impressora"];
+  [statusMenuItem setSubmenu:statusMenu];
+  NSArray *statusTitles = @[
+    @"Tampa aberta", @"Papel quase no fim", @"Sem papel", @"Gaveta aberta",
+    @"Erro da guilhotina"
+  ];
+  for (NSUInteger i = 0; i < statusTitles.count; ++i) {
+    NSMenuItem *item = [statusMenu addItemWithTitle:statusTitles[i]
+                                             action:@selector(toggleStatus:)
+                                      keyEquivalent:@""];
+    item.tag = (NSInteger)i;
+  }
+
+  NSMenuItem *realSpeedItem =
+      [settingsMenu addItemWithTitle:@"Velocidade real (250 mm/s)"
+                              action:@selector(toggleRealSpeed:)
+                       keyEquivalent:@""];
+  [realSpeedItem setState:g_realSpeed ? NSControlStateValueOn
+                                      : NSControlStateValueOff];
+
   [settingsMenu addItem:[NSMenuItem separatorItem]];
   [settingsMenu addItemWithTitle:@"Instalar Impressora Virtual"
                           action:@selector(installVirtualPrinter:)
@@ -110,24 +212,39 @@ void RepaintCallback(void *param) {
 
 - (void)startServerWithPort:(int)port {
   server.Stop();
-  bool success = server.Start(port, [](const unsigned char *data, int len) {
-    printer.ProcessData(data, len);
-
-    // Buffer logic
-    if (g_rawBuffer.size() + len > MAX_BUFFER_SIZE) {
-      size_t overflow = (g_rawBuffer.size() + len) - MAX_BUFFER_SIZE;
-      if (overflow < g_rawBuffer.size()) {
-        g_rawBuffer.erase(g_rawBuffer.begin(), g_rawBuffer.begin() + overflow);
-      } else {
-        g_rawBuffer.clear();
-        if ((size_t)len > MAX_BUFFER_SIZE) {
-          data += (len - MAX_BUFFER_SIZE);
-          len = MAX_BUFFER_SIZE;
-        }
-      }
-    }
-    g_rawBuffer.insert(g_rawBuffer.end(), data, data + len);
-  });
+  // Each connection prints through its own printer session, so simultaneous
+  // jobs keep their own styles, and its output reaches the paper as one job
+  // when the connection closes. The connection's thread only hands over what
+  // fits in the session's input ring; the printer's parser thread prints it
+  // and has the connection read again once there is room.
+  PrinterProfile profile = g_realSpeed ? RealSpeedProfile() : PrinterProfile();
+  printer.SetProfile(profile);
+  server.SetLimits(ServerLimits());
+  std::vector<NetworkServer::Endpoint> endpoints(1);
+  endpoints[0].port = port;
+  endpoints[0].receiveBufferBytes = (int)profile.receiveBufferBytes;
+  endpoints[0].onAccept = [](const NetworkServer::Writer &writer) {
+    std::shared_ptr<PrinterSession> session = printer.OpenSession(
+        [writer](const unsigned char *data, int len) { writer.Send(data, len); },
+        [writer]() { writer.Resume(); });
+    std::shared_ptr<ByteRing> capture =
+        std::make_shared<ByteRing>((size_t)g_captureKB * 1024);
+    NetworkServer::ConnectionCallbacks callbacks;
+    callbacks.onData = [session, capture](const unsigned char *data, int len) {
+      int taken = session->Feed(data, len);
+      // The rest comes again once the printer has room.
+      g_rawCapture.Append(data, taken);
+      capture->Append(data, taken);
+      return taken;
+    };
+    callbacks.onClose = [session, capture]() {
+      session->Close();
+      if (capture->Size() > 0)
+        std::atomic_store(&g_lastConnection, capture);
+    };
+    return callbacks;
+  };
+  bool success = server.Start(endpoints);
 
   if (!success) {
     dispatch_async(dispatch_get_main_queue(), ^{
@@ -142,10 +259,7 @@ void RepaintCallback(void *param) {
     });
   } else {
     g_port = port;
-    [self.window
-        setTitle:[NSString
-                     stringWithFormat:@"Impressora ESC/POS Virtual (Porto %d)",
-                                      g_port]];
+    [self updateTitle];
   }
 }
 
@@ -164,6 +278,17 @@ void RepaintCallback(void *param) {
   if ([defaults objectForKey:@"AlwaysOnTop"]) {
     g_alwaysOnTop = [defaults boolForKey:@"AlwaysOnTop"];
   }
+  if ([defaults objectForKey:@"MemoryLimitMB"]) {
+    g_memoryLimitMB = (int)[defaults integerForKey:@"MemoryLimitMB"];
+  }
+  if ([defaults objectForKey:@"CaptureKB"]) {
+    int kb = (int)[defaults integerForKey:@"CaptureKB"];
+    if (kb > 0)
+      g_captureKB = kb;
+  }
+  if ([defaults objectForKey:@"RealSpeed"]) {
+    g_realSpeed = [defaults boolForKey:@"RealSpeed"];
+  }
 }
 
 - (void)saveSettings {
@@ -172,6 +297,9 @@ void RepaintCallback(void *param) {
   [defaults setInteger:g_columns forKey:@"Columns"];
   [defaults setInteger:g_fontSize forKey:@"FontSize"];
   [defaults setBool:g_alwaysOnTop forKey:@"AlwaysOnTop"];
+  [defaults setInteger:g_memoryLimitMB forKey:@"MemoryLimitMB"];
+  [defaults setInteger:g_captureKB forKey:@"CaptureKB"];
+  [defaults setBool:g_realSpeed forKey:@"RealSpeed"];
 
   if (self.window) {
     NSString *frameString = NSStringFromRect(self.window.frame);
@@ -210,10 +338,7 @@ void RepaintCallback(void *param) {
                                             styleMask:style
                                               backing:NSBackingStoreBuffered
                                                 defer:NO];
-  [self.window
-      setTitle:[NSString
-                   stringWithFormat:@"Impressora ESC/POS Virtual (Porto %d)",
-                                    g_port]];
+  [self updateTitle];
   self.window.delegate = self;
 
   // Prevent floating window from hiding when app loses focus
@@ -235,6 +360,9 @@ void RepaintCallback(void *param) {
   self.printerView = [[PrinterView alloc] initWithFrame:frame];
   [self.printerView setPrinter:&printer];
   printer.SetMaxColumns(g_columns);
+  printer.SetMaxPaperBytes((size_t)g_memoryLimitMB * 1024 * 1024);
+  [self openReceiptArchive];
+  g_rawCapture.SetCapacity((size_t)g_captureKB * 1024);
 
   [scrollView setDocumentView:self.printerView];
   [self.window setContentView:scrollView];
@@ -303,6 +431,24 @@ void RepaintCallback(void *param) {
   [self saveSettings];
 }
 
+- (void)toggleStatus:(NSMenuItem *)sender {
+  PrinterStatus status = printer.GetStatus();
+  bool *flags[] = {&status.coverOpen, &status.paperNearEnd, &status.paperEnd,
+                   &status.drawerOpen, &status.cutterError};
+  bool *flag = flags[sender.tag];
+  *flag = !*flag;
+  printer.SetStatus(status); // clients with ASB on are told at once
+  sender.state = *flag ? NSControlStateValueOn : NSControlStateValueOff;
+}
+
+- (void)toggleRealSpeed:(NSMenuItem *)sender {
+  g_realSpeed = !g_realSpeed;
+  sender.state = g_realSpeed ? NSControlStateValueOn : NSControlStateValueOff;
+  [self saveSettings];
+  // The receive buffer belongs to the listening socket: restart it.
+  [self startServerWithPort:g_port];
+}
+
 - (void)installVirtualPrinter:(id)sender {
   NSString *cmd = [NSString
       stringWithFormat:
@@ -370,8 +516,109 @@ void RepaintCallback(void *param) {
   }
 }
 
+- (void)changeMemoryLimit:(id)sender {
+  NSAlert *alert = [[NSAlert alloc] init];
+  [alert setMessageText:@"Limite de Memória"];
+  [alert setInformativeText:@"Memória para o papel, em MB (0 = sem limite):"];
+  [alert addButtonWithTitle:@"OK"];
+  [alert addButtonWithTitle:@"Cancelar"];
+
+  NSTextField *input =
+      [[NSTextField alloc] initWithFrame:NSMakeRect(0, 0, 200, 24)];
+  [input setStringValue:[NSString stringWithFormat:@"%d", g_memoryLimitMB]];
+  [alert setAccessoryView:input];
+
+  if ([alert runModal] == NSAlertFirstButtonReturn) {
+    int newLimit = [input intValue];
+    if (newLimit >= 0) {
+      g_memoryLimitMB = newLimit;
+      printer.SetMaxPaperBytes((size_t)g_memoryLimitMB * 1024 * 1024);
+      [self updateTitle];
+      [self saveSettings];
+    }
+  }
+}
+
+- (void)showArchivedReceipt:(id)sender {
+  size_t count = printer.GetArchivedJobCount();
+  NSAlert *alert = [[NSAlert alloc] init];
+  [alert setMessageText:@"Recibo Arquivado"];
+  [alert setInformativeText:
+             [NSString stringWithFormat:@"Recibo (1 a %zu, 0 = papel):", count]];
+  [alert addButtonWithTitle:@"OK"];
+  [alert addButtonWithTitle:@"Cancelar"];
+
+  NSTextField *input =
+      [[NSTextField alloc] initWithFrame:NSMakeRect(0, 0, 200, 24)];
+  [input setStringValue:[NSString stringWithFormat:@"%zu", g_archivedJob]];
+  [alert setAccessoryView:input];
+
+  if ([alert runModal] == NSAlertFirstButtonReturn) {
+    int n = [input intValue];
+    if (n >= 0 && (size_t)n <= count) {
+      g_archivedJob = (size_t)n;
+      [self.printerView showArchivedJob:g_archivedJob];
+      [self updateTitle];
+    }
+  }
+}
+
+// Opens today's receipt archive, recibos-AAAAMMDD.bin in Application
+// Support: the receipts that leave the paper go there instead of being lost.
+- (void)openReceiptArchive {
+  NSURL *support = [[[NSFileManager defaultManager]
+      URLsForDirectory:NSApplicationSupportDirectory
+             inDomains:NSUserDomainMask] firstObject];
+  if (!support)
+    return;
+  NSURL *dir = [support URLByAppendingPathComponent:@"VirtualESCPOS"
+                                        isDirectory:YES];
+  [[NSFileManager defaultManager] createDirectoryAtURL:dir
+                           withIntermediateDirectories:YES
+                                            attributes:nil
+                                                 error:nil];
+  NSDateFormatter *format = [[NSDateFormatter alloc] init];
+  [format setDateFormat:@"yyyyMMdd"];
+  NSString *name = [NSString
+      stringWithFormat:@"recibos-%@.bin", [format stringFromDate:[NSDate date]]];
+  NSURL *url = [dir URLByAppendingPathComponent:name];
+  printer.OpenArchive([[url path] UTF8String]);
+}
+
 - (void)saveOutput:(id)sender {
-  if (g_rawBuffer.empty()) {
+  [self saveCaptureData:CaptureData(g_rawCapture)];
+}
+
+- (void)saveLastConnection:(id)sender {
+  std::shared_ptr<ByteRing> last = std::atomic_load(&g_lastConnection);
+  [self saveCaptureData:last ? CaptureData(*last) : [NSData data]];
+}
+
+- (void)changeCaptureSize:(id)sender {
+  NSAlert *alert = [[NSAlert alloc] init];
+  [alert setMessageText:@"Tamanho da captura"];
+  [alert setInformativeText:@"Tamanho da captura em KB:"];
+  [alert addButtonWithTitle:@"OK"];
+  [alert addButtonWithTitle:@"Cancelar"];
+
+  NSTextField *input =
+      [[NSTextField alloc] initWithFrame:NSMakeRect(0, 0, 200, 24)];
+  [input setStringValue:[NSString stringWithFormat:@"%d", g_captureKB]];
+  [alert setAccessoryView:input];
+
+  if ([alert runModal] == NSAlertFirstButtonReturn) {
+    int newSize = [input intValue];
+    if (newSize > 0) {
+      g_captureKB = newSize;
+      g_rawCapture.SetCapacity((size_t)g_captureKB * 1024);
+      [self saveSettings];
+    }
+  }
+}
+
+// Asks for a file name and writes `data` to it.
+- (void)saveCaptureData:(NSData *)data {
+  if ([data length] == 0) {
     NSAlert *alert = [[NSAlert alloc] init];
     [alert setMessageText:@"Aviso"];
     [alert setInformativeText:@"Não há dados para gravar."];
@@ -385,8 +632,6 @@ void RepaintCallback(void *param) {
   [panel beginSheetModalForWindow:self.window
                 completionHandler:^(NSModalResponse result) {
                   if (result == NSModalResponseOK) {
-                    NSData *data = [NSData dataWithBytes:g_rawBuffer.data()
-                                                  length:g_rawBuffer.size()];
                     [data writeToURL:[panel URL] atomically:YES];
 
                     NSAlert *successAlert = [[NSAlert alloc] init];
@@ -407,7 +652,8 @@ void RepaintCallback(void *param) {
 
   if ([alert runModal] == NSAlertFirstButtonReturn) {
     printer.Clear();
-    g_rawBuffer.clear();
+    g_rawCapture.Clear();
+    std::atomic_store(&g_lastConnection, std::shared_ptr<ByteRing>());
     [self.printerView setNeedsDisplay:YES];
   }
 }
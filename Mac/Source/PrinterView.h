@@ -10,6 +10,12 @@ typedef struct VirtualPrinter VirtualPrinter;
 
 #ifdef __cplusplus
 - (void)setPrinter:(VirtualPrinter *)printerObj;
+// Shows archived receipt `n` (from 1) in place of the paper; 0 goes back to
+// the paper.
+- (void)showArchivedJob:(size_t)n;
+// Redraws what a change on the paper can have touched: from the end of the
+// committed paper down, or everything after a restart.
+- (void)paperChanged:(BOOL)restarted;
 #endif
 
 @end
@@ -4,6 +4,20 @@
 @implementation PrinterView {
   VirtualPrinter *_printer;
   CGFloat _totalHeight;
+  // The elements as last drawn: the committed paper up to _paperVersion,
+  // then the live output of the jobs still printing. Elements only point at
+  // their text and bitmaps; _paper and _live own them.
+  std::vector<PrinterElement> _elements;
+  PaperVersion _paperVersion;
+  size_t _committedElements;
+  // Top of the line holding the end of the committed paper at the last
+  // redraw: what the printer appends only changes the view from there down.
+  CGFloat _changeTop;
+  PaperView _paper;
+  ElementList _live;
+  // The archived receipt on show instead of the paper, from 1; 0 = none.
+  size_t _archivedJob;
+  ElementList _archived;
 }
 
 - (instancetype)initWithFrame:(NSRect)frameRect {
@@ -16,6 +30,54 @@
 
 - (void)setPrinter:(VirtualPrinter *)printerObj {
   _printer = printerObj;
+  _elements.clear();
+  _paperVersion = PaperVersion();
+  _committedElements = 0;
+  _changeTop = 0;
+  _paper = PaperView();
+  _live.clear();
+  _archivedJob = 0;
+  _archived.clear();
+}
+
+- (void)showArchivedJob:(size_t)n {
+  _archivedJob = n;
+  // Read back from the archive only now, and only this receipt.
+  _archived = n > 0 ? _printer->GetArchivedJobElements(n - 1) : ElementList();
+  [self setNeedsDisplay:YES];
+}
+
+- (void)paperChanged:(BOOL)restarted {
+  if (_archivedJob > 0)
+    return; // the archived receipt does not change
+  if (restarted) {
+    [self setNeedsDisplay:YES];
+    return;
+  }
+  NSRect bounds = self.bounds;
+  // Below the view, the change still needs a redraw for the height to grow.
+  CGFloat top = MIN(_changeTop, NSMaxY(bounds) - 1);
+  [self setNeedsDisplayInRect:NSMakeRect(0, top, bounds.size.width,
+                                         NSMaxY(bounds) - top)];
+}
+
+// Brings _elements up to date for a redraw. Only what changed since the last
+// one is fetched: the jobs committed since then and the live output, which
+// replaces the previous live tail.
+- (const std::vector<PrinterElement> &)refreshElements {
+  PaperView added = _printer->GetElementsSince(_paperVersion, &_live);
+  if (added.restarted())
+    _committedElements = 0;
+  _elements.erase(_elements.begin() + _committedElements, _elements.end());
+  _elements.reserve(_elements.size() + added.size() + _live.size());
+  for (size_t i = 0; i < added.size(); ++i)
+    _elements.push_back(added[i]);
+  _committedElements = _elements.size();
+  _paperVersion = added.version();
+  _paper = added; // keeps the roll, and with it the payloads, alive
+  const std::vector<PrinterElement> &live = _live.Elements();
+  _elements.insert(_elements.end(), live.begin(), live.end());
+  return _elements;
 }
 
 - (BOOL)isFlipped {
@@ -29,7 +91,8 @@
   if (!_printer)
     return;
 
-  std::vector<PrinterElement> elements = _printer->GetElements();
+  const std::vector<PrinterElement> &elements =
+      _archivedJob > 0 ? _archived.Elements() : [self refreshElements];
 
   CGContextRef context = [[NSGraphicsContext currentContext] CGContext];
 
@@ -84,8 +147,9 @@
 
   auto attrsForElement = [&](const PrinterElement &e) -> NSMutableDictionary * {
     NSMutableDictionary *a = [NSMutableDictionary dictionary];
-    NSFont *f = fontForElement(e.font);
-    if (e.isBold) {
+    const ElementStyle &st = e.Style();
+    NSFont *f = fontForElement(st.font);
+    if (st.isBold) {
       // ESC G double-strike shows up as bold.
       NSFont *boldFont = [[NSFontManager sharedFontManager] convertFont:f
                                                            toHaveTrait:NSBoldFontMask];
@@ -95,18 +159,18 @@
     a[NSFontAttributeName] = f;
     // GS B knocks the glyphs out in white over an inked cell.
     a[NSForegroundColorAttributeName] =
-        e.isReverse ? [NSColor whiteColor]
-                    : (e.isRed ? [NSColor redColor] : [NSColor blackColor]);
-    if (e.isUnderline)
+        st.isReverse ? [NSColor whiteColor]
+                     : (st.isRed ? [NSColor redColor] : [NSColor blackColor]);
+    if (st.isUnderline)
       a[NSUnderlineStyleAttributeName] = @(NSUnderlineStyleSingle);
-    if (e.charSpacing > 0)
-      a[NSKernAttributeName] = @(dotsToPoints(e.charSpacing)); // ESC SP
+    if (st.charSpacing > 0)
+      a[NSKernAttributeName] = @(dotsToPoints(st.charSpacing)); // ESC SP
     return a;
   };
 
   auto stringForElement = [](const PrinterElement &e) -> NSString * {
-    return [[NSString alloc] initWithBytes:e.text.data()
-                                    length:e.text.size() * sizeof(wchar_t)
+    return [[NSString alloc] initWithBytes:e.text
+                                    length:e.TextLength() * sizeof(wchar_t)
                                   encoding:NSUTF32LittleEndianStringEncoding];
   };
 
@@ -120,10 +184,11 @@
         break;
       NSString *t = stringForElement(e);
       NSSize sz = [t sizeWithAttributes:attrsForElement(e)];
-      if (e.isRotated90)
-        total += sz.height * e.heightScale * (CGFloat)t.length;
+      const ElementStyle &st = e.Style();
+      if (st.isRotated90)
+        total += sz.height * st.heightScale * (CGFloat)t.length;
       else
-        total += sz.width * e.widthScale;
+        total += sz.width * st.widthScale;
     }
     return total;
   };
@@ -136,7 +201,8 @@
       if (e.type != ELEMENT_TEXT)
         break;
       NSString *t = stringForElement(e);
-      CGFloat h = [t sizeWithAttributes:attrsForElement(e)].height * e.heightScale;
+      CGFloat h = [t sizeWithAttributes:attrsForElement(e)].height *
+                  e.Style().heightScale;
       if (h > maxHeight)
         maxHeight = h;
     }
@@ -148,7 +214,7 @@
       const auto &e = elements[i];
       if (e.type != ELEMENT_TEXT)
         break;
-      if (e.isUpsideDown)
+      if (e.Style().isUpsideDown)
         return true;
     }
     return false;
@@ -157,27 +223,28 @@
   // Draws one text segment at (x, y0) and reports the space it took up.
   auto drawSegment = [&](const PrinterElement &e, CGFloat x,
                          CGFloat y0) -> NSSize {
+    const ElementStyle &st = e.Style();
     NSMutableDictionary *attrs = attrsForElement(e);
     NSString *text = stringForElement(e);
     NSSize base = [text sizeWithAttributes:attrs];
     NSSize drawn =
-        NSMakeSize(base.width * e.widthScale, base.height * e.heightScale);
+        NSMakeSize(base.width * st.widthScale, base.height * st.heightScale);
 
     // ESC V turns each glyph 90 degrees clockwise while the line still runs
     // left to right, so the run occupies one glyph height per character.
-    if (e.isRotated90) {
-      CGFloat cell = base.height * e.heightScale;
+    if (st.isRotated90) {
+      CGFloat cell = base.height * st.heightScale;
       drawn = NSMakeSize(cell * (CGFloat)text.length, cell);
     }
 
-    if (e.isReverse) {
-      NSColor *ink = e.isRed ? [NSColor redColor] : [NSColor blackColor];
+    if (st.isReverse) {
+      NSColor *ink = st.isRed ? [NSColor redColor] : [NSColor blackColor];
       [ink setFill];
       NSRectFill(NSMakeRect(x, y0, drawn.width, drawn.height));
     }
 
-    if (e.isRotated90) {
-      CGFloat cell = base.height * e.heightScale;
+    if (st.isRotated90) {
+      CGFloat cell = base.height * st.heightScale;
       CGFloat penX = x;
       for (NSUInteger i = 0; i < text.length; ++i) {
         NSString *glyph = [text substringWithRange:NSMakeRange(i, 1)];
@@ -186,7 +253,7 @@
         // angle turns clockwise on screen.
         CGContextTranslateCTM(context, penX + cell, y0);
         CGContextRotateCTM(context, M_PI_2);
-        CGContextScaleCTM(context, e.widthScale, e.heightScale);
+        CGContextScaleCTM(context, st.widthScale, st.heightScale);
         [glyph drawAtPoint:NSMakePoint(0, 0) withAttributes:attrs];
         CGContextRestoreGState(context);
         penX += cell;
@@ -196,7 +263,7 @@
 
     CGContextSaveGState(context);
     CGContextTranslateCTM(context, x, y0);
-    CGContextScaleCTM(context, e.widthScale, e.heightScale);
+    CGContextScaleCTM(context, st.widthScale, st.heightScale);
     [text drawAtPoint:NSMakePoint(0, 0) withAttributes:attrs];
     CGContextRestoreGState(context);
 
@@ -205,14 +272,14 @@
 
   // Left edge of the printable area for an element, honouring GS L.
   auto elementBaseX = [&](const PrinterElement &e) -> CGFloat {
-    return leftMargin + dotsToPoints(e.marginLeft);
+    return leftMargin + dotsToPoints(e.Style().marginLeft);
   };
 
   // Width of the printable area: GS W if set, else the configured paper width,
   // else whatever the view gives us.
   auto elementAreaWidth = [&](const PrinterElement &e) -> CGFloat {
-    if (e.areaWidth > 0)
-      return dotsToPoints(e.areaWidth);
+    if (e.Style().areaWidth > 0)
+      return dotsToPoints(e.Style().areaWidth);
     if (paperWidth > 0)
       return paperWidth;
     return width - elementBaseX(e) - leftMargin;
@@ -223,9 +290,9 @@
     CGFloat base = elementBaseX(e);
     CGFloat areaW = elementAreaWidth(e);
     CGFloat startX = base;
-    if (e.align == 1)
+    if (e.Style().align == 1)
       startX = base + (areaW - contentWidth) / 2.0;
-    else if (e.align == 2)
+    else if (e.Style().align == 2)
       startX = base + areaW - contentWidth;
     if (startX < base)
       startX = base;
@@ -261,11 +328,12 @@
       return NSMakeSize(dotsToPoints(e.width), dotsToPoints(e.height));
     NSString *t = stringForElement(e);
     NSSize sz = [t sizeWithAttributes:attrsForElement(e)];
-    if (e.isRotated90) {
-      CGFloat cell = sz.height * e.heightScale;
+    const ElementStyle &st = e.Style();
+    if (st.isRotated90) {
+      CGFloat cell = sz.height * st.heightScale;
       return NSMakeSize(cell * (CGFloat)t.length, cell);
     }
-    return NSMakeSize(sz.width * e.widthScale, sz.height * e.heightScale);
+    return NSMakeSize(sz.width * st.widthScale, sz.height * st.heightScale);
   };
 
   // How much paper the page needs when ESC W did not state a height.
@@ -292,8 +360,9 @@
   // Row-major 1bpp raster of a bitmap element; GS * data arrives column-major.
   auto elementRaster =
       [](const PrinterElement &e) -> std::vector<unsigned char> {
+    const std::vector<unsigned char> &data = *e.bitmap;
     if (!e.isColumnFormat)
-      return e.bitmapData;
+      return data;
 
     int xBytes = e.width / 8;
     int yBytes = e.height / 8;
@@ -305,9 +374,9 @@
     for (int col = 0; col < widthDots; col++) {
       for (int vB = 0; vB < yBytes; vB++) {
         size_t srcIdx = (size_t)col * yBytes + vB;
-        if (srcIdx >= e.bitmapData.size())
+        if (srcIdx >= data.size())
           break;
-        unsigned char b = e.bitmapData[srcIdx];
+        unsigned char b = data[srcIdx];
         for (int bit = 0; bit < 8; bit++) {
           if (!((b >> (7 - bit)) & 1))
             continue;
@@ -365,9 +434,16 @@
   CGFloat pageLeft = 0, pageTop = 0, pageW = 0, pageH = 0;
 
   bool atLineStart = true;
+  bool changeTopFound = _archivedJob > 0;
   for (size_t idx = 0; idx < elements.size(); ++idx) {
     const auto &el = elements[idx];
 
+    // y is the top of the line (or page) this element is on.
+    if (!changeTopFound && idx >= _committedElements) {
+      _changeTop = y;
+      changeTopFound = true;
+    }
+
     if (el.type == ELEMENT_PAGE_BEGIN) {
       if (!atLineStart) {
         y += currentLineMaxHeight + 4;
@@ -532,6 +608,9 @@
     }
   }
 
+  if (!changeTopFound)
+    _changeTop = y; // nothing live
+
   // Update total height for scrolling
   _totalHeight = y + 50;
   if (_totalHeight > self.frame.size.height) {
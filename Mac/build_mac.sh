@@ -9,6 +9,11 @@ ln -sf ../Network.cpp Network.cpp
 ln -sf ../Network.h Network.h
 ln -sf ../VirtualPrinter.cpp VirtualPrinter.cpp
 ln -sf ../VirtualPrinter.h VirtualPrinter.h
+ln -sf ../AppendLog.h AppendLog.h
+ln -sf ../ByteRing.h ByteRing.h
+ln -sf ../SpscRing.h SpscRing.h
+ln -sf ../PaperArchive.cpp PaperArchive.cpp
+ln -sf ../PaperArchive.h PaperArchive.h
 ln -sf ../Barcode.cpp Barcode.cpp
 ln -sf ../Barcode.h Barcode.h
 ln -sf ../CodePages.cpp CodePages.cpp
@@ -22,7 +27,7 @@ swift build -c release
 BUILD_RESULT=$?
 
 # Restore (remove links)
-rm Network.cpp Network.h VirtualPrinter.cpp VirtualPrinter.h Barcode.cpp Barcode.h CodePages.cpp CodePages.h QRCode.cpp QRCode.h
+rm Network.cpp Network.h VirtualPrinter.cpp VirtualPrinter.h AppendLog.h ByteRing.h SpscRing.h PaperArchive.cpp PaperArchive.h Barcode.cpp Barcode.h CodePages.cpp CodePages.h QRCode.cpp QRCode.h
 
 # Check if build was successful
 if [ $BUILD_RESULT -eq 0 ]; then
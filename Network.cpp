@@ -1,10 +1,271 @@
 #include "Network.h"
+#include <chrono>
+#include <climits>
 #include <iostream>
 #include <string>
 #include <vector>
 
+#ifndef _WIN32
+#include <cerrno>
+#include <netinet/tcp.h>
+#include <poll.h>
+#endif
+#ifdef NETWORK_EPOLL
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
+#ifdef NETWORK_IO_URING
+#include <algorithm>
+#include <cstdio>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/utsname.h>
+#endif
+
+// Receive buffers start small and double, up to RECV_BUFFER_MAX, while the
+// socket keeps filling them; everything already readable is handed to onData
+// in one call, so a large raster job costs a few parser and repaint calls
+// instead of one per 4 KB.
+static const int RECV_BUFFER_SIZE = 4096;
+static const int RECV_BUFFER_MAX = 256 * 1024;
+
+// Replies a client has yet to read, kept for it beyond what its socket holds.
+// Past this, new ones are dropped, as by a printer whose transmit buffer is
+// full.
+static const size_t REPLY_QUEUE_BYTES = 64 * 1024;
+// How soon the flush thread sees replies queued while it waits on others.
+static const int FLUSH_POLL_MS = 10;
+
+#ifdef MSG_NOSIGNAL
+static const int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+static const int SEND_FLAGS = 0; // SO_NOSIGPIPE is set on the socket instead
+#endif
+
+// FaultStats in the order of NetworkServer::faultCounts.
+enum {
+  FAULT_DELAYS,
+  FAULT_STALLS,
+  FAULT_RESETS,
+  FAULT_PAPER_OUTS,
+  FAULT_REFUSED
+};
+
+// splitmix64: small, and the same sequence on every platform, which is all
+// the fault plan needs to be repeatable.
+static unsigned long long NextRandom(unsigned long long &state) {
+  unsigned long long z = (state += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+static bool Chance(unsigned long long &state, int percent) {
+  return (int)(NextRandom(state) % 100) < percent;
+}
+
+// Makes closing `socket` send a reset instead of the end of the stream.
+static void ResetOnClose(SOCKET socket) {
+  struct linger abortive;
+  abortive.l_onoff = 1;
+  abortive.l_linger = 0;
+  setsockopt(socket, SOL_SOCKET, SO_LINGER, (const char *)&abortive,
+             sizeof(abortive));
+}
+
+static long long SteadyMs() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// How long to stop accepting when accept() fails for lack of descriptors or
+// memory. Retrying at once would fail the same way, in a tight loop.
+static const int ACCEPT_RETRY_MS = 100;
+
+#ifdef NETWORK_EPOLL
+// Wakes the thread waiting on the eventfd `fd`.
+static void Signal(int fd) {
+  uint64_t one = 1;
+  if (write(fd, &one, sizeof(one)) < 0) {
+    // The counter cannot overflow from one write; nothing to retry.
+  }
+}
+#endif
+
+#ifdef NETWORK_EPOLL
+// Chunks read from one connection before the worker moves on to the next
+// ready one, so a client that never stops sending cannot hold a worker.
+static const int READS_PER_TURN = 16;
+
+// Workers for the reactor: enough to parse on every core, but a fixed number
+// however many connections are open.
+static size_t WorkerCount() {
+  size_t n = std::thread::hardware_concurrency();
+  if (n < 2) n = 2;
+  if (n > 8) n = 8;
+  return n;
+}
+#endif
+
+#ifdef NETWORK_IO_URING
+static const unsigned URING_SQ_ENTRIES = 256;
+static const unsigned URING_CQ_ENTRIES = 4096;
+// Receive buffers the kernel picks from, a power of two. A connection whose
+// chunks wait for the parser holds on to theirs, so running out of them is
+// what slows the senders down.
+static const unsigned URING_BUFFERS = 512;
+static const unsigned URING_BUFFER_SIZE = 8192;
+// How long a connection that found no free buffer waits to try again.
+static const int URING_BUFFER_RETRY_MS = 1;
+
+// The mapped rings of one io_uring instance and its provided buffers. Only
+// the thread in UringLoop() submits and reaps; workers only give buffers
+// back, under bufferMutex.
+struct NetworkServer::Uring {
+  int fd;
+  void *ringMemory;
+  size_t ringBytes;
+  struct io_uring_sqe *sqes;
+  size_t sqeBytes;
+  unsigned *sqHead, *sqTail, *sqArray, sqMask, sqEntries;
+  unsigned sqPending; // filled in since the last io_uring_enter()
+  unsigned *cqHead, *cqTail, cqMask;
+  struct io_uring_cqe *cqes;
+
+  struct io_uring_buf_ring *bufferRing; // null when legacyBuffers
+  unsigned char *buffers;
+  unsigned short bufferTail;
+  // Some kernels accept a buffer ring and then never take from it. They get
+  // each buffer back with IORING_OP_PROVIDE_BUFFERS instead, which only this
+  // thread can submit: workers leave the ids in `returned`.
+  bool legacyBuffers;
+  std::vector<unsigned short> returned;
+  std::mutex bufferMutex;
+
+  // Timers, whose addresses also tag their completions.
+  struct __kernel_timespec acceptDelay, bufferDelay;
+  bool acceptRetryPending, bufferRetryPending;
+
+  Uring()
+      : fd(-1), ringMemory(NULL), ringBytes(0), sqes(NULL), sqeBytes(0),
+        sqPending(0), bufferRing(NULL), buffers(NULL), bufferTail(0),
+        legacyBuffers(false), acceptRetryPending(false),
+        bufferRetryPending(false) {}
+  ~Uring() {
+    // The kernel's references to the buffers go with the descriptor.
+    if (fd >= 0) close(fd);
+    if (ringMemory) munmap(ringMemory, ringBytes);
+    if (sqes) munmap(sqes, sqeBytes);
+    if (bufferRing) munmap(bufferRing, URING_BUFFERS * sizeof(io_uring_buf));
+    if (buffers) munmap(buffers, (size_t)URING_BUFFERS * URING_BUFFER_SIZE);
+  }
+
+  // The next free submission entry, cleared; submits first if the ring is
+  // full.
+  struct io_uring_sqe *NextSqe() {
+    while (sqPending == sqEntries) Enter(0, 0);
+    unsigned tail = *sqTail + sqPending;
+    struct io_uring_sqe *sqe = &sqes[tail & sqMask];
+    memset(sqe, 0, sizeof(*sqe));
+    ++sqPending;
+    return sqe;
+  }
+
+  // Submits what has been filled in and waits for `waitFor` completions.
+  int Enter(unsigned waitFor, unsigned flags) {
+    __atomic_store_n(sqTail, *sqTail + sqPending, __ATOMIC_RELEASE);
+    int submitted = (int)syscall(__NR_io_uring_enter, fd, sqPending, waitFor,
+                                 flags, NULL, 0);
+    if (submitted > 0) sqPending -= submitted;
+    return submitted;
+  }
 
-NetworkServer::NetworkServer() : listenSocket(INVALID_SOCKET), running(false) {
+  // Takes the completion at the head of the queue, waiting for it.
+  bool NextCqe(struct io_uring_cqe *cqe) {
+    unsigned head = *cqHead;
+    while (__atomic_load_n(cqTail, __ATOMIC_ACQUIRE) == head) {
+      if (Enter(1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR) return false;
+    }
+    *cqe = cqes[head & cqMask];
+    __atomic_store_n(cqHead, head + 1, __ATOMIC_RELEASE);
+    return true;
+  }
+
+  void ProvideBuffers(unsigned short first, unsigned count, unsigned flags) {
+    struct io_uring_sqe *sqe = NextSqe();
+    sqe->opcode = IORING_OP_PROVIDE_BUFFERS;
+    sqe->fd = (int)count;
+    sqe->addr = (unsigned long long)(uintptr_t)(buffers +
+                                                (size_t)first * URING_BUFFER_SIZE);
+    sqe->len = URING_BUFFER_SIZE;
+    sqe->off = first;
+    sqe->buf_group = 0;
+    sqe->flags = (unsigned char)flags;
+    sqe->user_data = 0;
+  }
+
+  // Hands back to the kernel what the workers returned (legacy buffers),
+  // one request per run of consecutive ids.
+  void ProvideReturned() {
+    std::vector<unsigned short> ids;
+    {
+      std::lock_guard<std::mutex> lock(bufferMutex);
+      ids.swap(returned);
+    }
+    std::sort(ids.begin(), ids.end());
+    for (size_t i = 0; i < ids.size();) {
+      size_t run = 1;
+      while (i + run < ids.size() && ids[i + run] == ids[i] + run) ++run;
+      ProvideBuffers(ids[i], (unsigned)run, IOSQE_CQE_SKIP_SUCCESS);
+      i += run;
+    }
+  }
+
+  void ReturnBuffers(const unsigned short *ids, int count) {
+    std::lock_guard<std::mutex> lock(bufferMutex);
+    if (legacyBuffers) {
+      returned.insert(returned.end(), ids, ids + count);
+      return;
+    }
+    for (int i = 0; i < count; ++i) {
+      struct io_uring_buf *b =
+          &bufferRing->bufs[bufferTail & (URING_BUFFERS - 1)];
+      b->addr = (unsigned long long)(uintptr_t)(buffers + (size_t)ids[i] *
+                                                              URING_BUFFER_SIZE);
+      b->len = URING_BUFFER_SIZE;
+      b->bid = ids[i];
+      ++bufferTail;
+    }
+    __atomic_store_n(&bufferRing->tail, bufferTail, __ATOMIC_RELEASE);
+  }
+};
+
+static bool KernelAtLeast(int major, int minor) {
+  struct utsname name;
+  int a = 0, b = 0;
+  if (uname(&name) != 0 || sscanf(name.release, "%d.%d", &a, &b) != 2) {
+    return false;
+  }
+  return a > major || (a == major && b >= minor);
+}
+#endif
+
+NetworkServer::NetworkServer()
+    : running(false), requestedBackend(BACKEND_DEFAULT),
+      activeBackend(BACKEND_DEFAULT), queuedCount(0), refusedCount(0),
+      idleCount(0), droppedCount(0), faultsOn(false), accepted(0), slots(0) {
+  for (int i = 0; i < 5; ++i) faultCounts[i] = 0;
+#ifdef NETWORK_EPOLL
+  epollFd = -1;
+  wakeFd = -1;
+  stopping = false;
+#endif
+#ifdef NETWORK_IO_URING
+  uring = NULL;
+#endif
 #ifdef _WIN32
   WSADATA wsaData;
   WSAStartup(MAKEWORD(2, 2), &wsaData);
@@ -18,10 +279,9 @@ NetworkServer::~NetworkServer() {
 #endif
 }
 
-bool NetworkServer::Start(
-    int port, std::function<void(const unsigned char *, int)> dataCallback) {
-  onDataReceived = dataCallback;
-
+// A socket listening on `port`, or INVALID_SOCKET. Its connections inherit
+// `receiveBufferBytes`, unless 0.
+static SOCKET OpenListener(int port, int receiveBufferBytes) {
   struct addrinfo *result = NULL;
   struct addrinfo hints;
 
@@ -34,82 +294,1481 @@ bool NetworkServer::Start(
   std::string portStr = std::to_string(port);
 
   if (getaddrinfo(NULL, portStr.c_str(), &hints, &result) != 0) {
-    return false;
+    return INVALID_SOCKET;
   }
 
-  listenSocket =
+  SOCKET listenSocket =
       socket(result->ai_family, result->ai_socktype, result->ai_protocol);
   if (listenSocket == INVALID_SOCKET) {
     freeaddrinfo(result);
-    return false;
+    return INVALID_SOCKET;
+  }
+
+#ifndef _WIN32
+  // Stop() closes connections from this side, which leaves them in
+  // TIME_WAIT on the port; without this a restart could not bind it again.
+  int reuse = 1;
+  setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+#endif
+  // Before listen(), since the window a connection starts with is based on it.
+  if (receiveBufferBytes > 0) {
+    setsockopt(listenSocket, SOL_SOCKET, SO_RCVBUF,
+               (const char *)&receiveBufferBytes, sizeof(receiveBufferBytes));
   }
 
   if (bind(listenSocket, result->ai_addr, (int)result->ai_addrlen) ==
       SOCKET_ERROR) {
     freeaddrinfo(result);
     closesocket(listenSocket);
-    listenSocket = INVALID_SOCKET;
-    return false;
+    return INVALID_SOCKET;
   }
 
   freeaddrinfo(result);
 
+#ifndef __linux__
+  // Room in the kernel for a whole receive buffer while the parser works,
+  // unless the endpoint asked for a buffer of its own, which is kept as is.
+  // Accepted sockets inherit it, and the window scale is settled at the
+  // handshake, so it has to be set here. Linux sizes its buffers on its own
+  // and would stop doing so.
+  int receiveBuffer = 0;
+  socklen_t optionLength = sizeof(receiveBuffer);
+  if (receiveBufferBytes <= 0 &&
+      getsockopt(listenSocket, SOL_SOCKET, SO_RCVBUF, (char *)&receiveBuffer,
+                 &optionLength) == 0 &&
+      receiveBuffer < RECV_BUFFER_MAX) {
+    receiveBuffer = RECV_BUFFER_MAX;
+    setsockopt(listenSocket, SOL_SOCKET, SO_RCVBUF, (const char *)&receiveBuffer,
+               sizeof(receiveBuffer));
+  }
+#endif
+
   if (listen(listenSocket, SOMAXCONN) == SOCKET_ERROR) {
     closesocket(listenSocket);
-    listenSocket = INVALID_SOCKET;
+    return INVALID_SOCKET;
+  }
+  return listenSocket;
+}
+
+bool NetworkServer::Start(int port, AcceptCallback acceptCallback) {
+  std::vector<Endpoint> endpoints(1);
+  endpoints[0].port = port;
+  endpoints[0].onAccept = acceptCallback;
+  return Start(endpoints);
+}
+
+bool NetworkServer::Start(const std::vector<Endpoint> &endpoints) {
+  if (endpoints.empty()) return false;
+  listeners.reserve(endpoints.size());
+  for (size_t i = 0; i < endpoints.size(); ++i) {
+    SOCKET listenSocket =
+        OpenListener(endpoints[i].port, endpoints[i].receiveBufferBytes);
+    if (listenSocket == INVALID_SOCKET) {
+      CloseListeners();
+      return false;
+    }
+    listeners.push_back(Listener());
+    listeners.back().socket = listenSocket;
+    listeners.back().onAccept = endpoints[i].onAccept;
+  }
+
+  faultsOn = faultPlan.readDelayMs > 0 || faultPlan.readJitterMs > 0 ||
+             faultPlan.stallMs > 0 || faultPlan.resetPercent > 0 ||
+             faultPlan.paperOutPercent > 0 || faultPlan.refusePercent > 0;
+  accepted = 0;
+  for (int i = 0; i < 5; ++i) faultCounts[i] = 0;
+  queuedCount = refusedCount = idleCount = droppedCount = 0;
+  slots = 0;
+
+  activeBackend = BACKEND_DEFAULT;
+#ifdef NETWORK_EPOLL
+  wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (wakeFd < 0) {
+    CloseListeners();
     return false;
   }
+#ifdef NETWORK_IO_URING
+  if (requestedBackend == BACKEND_IO_URING && StartUring()) {
+    activeBackend = BACKEND_IO_URING;
+  }
+#endif
+  if (activeBackend == BACKEND_DEFAULT) {
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd < 0) {
+      close(wakeFd);
+      wakeFd = -1;
+      CloseListeners();
+      return false;
+    }
+    // The listening sockets and the eventfd are told apart from connections
+    // by the address they carry.
+    for (size_t i = 0; i < listeners.size(); ++i) {
+      SOCKET listenSocket = listeners[i].socket;
+      fcntl(listenSocket, F_SETFL, fcntl(listenSocket, F_GETFL) | O_NONBLOCK);
+      struct epoll_event ev;
+      ev.events = EPOLLIN;
+      ev.data.ptr = &listeners[i];
+      epoll_ctl(epollFd, EPOLL_CTL_ADD, listenSocket, &ev);
+    }
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.ptr = &wakeFd;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &ev);
+  }
+
+  stopping = false;
+  size_t workerCount = WorkerCount();
+  for (size_t i = 0; i < workerCount; ++i) {
+    workers.push_back(std::thread(&NetworkServer::WorkerLoop, this));
+  }
 
   running = true;
+  flushThread = std::thread(&NetworkServer::FlushLoop, this);
+  if (limits.idleTimeoutMs > 0) {
+    idleThread = std::thread(&NetworkServer::IdleLoop, this);
+  }
+  if (faultPlan.readDelayMs > 0 || faultPlan.readJitterMs > 0 ||
+      faultPlan.stallMs > 0) {
+    delayThread = std::thread(&NetworkServer::DelayLoop, this);
+  }
+#ifdef NETWORK_IO_URING
+  if (activeBackend == BACKEND_IO_URING) {
+    serverThread = std::thread(&NetworkServer::UringLoop, this);
+    return true;
+  }
+#endif
   serverThread = std::thread(&NetworkServer::ServerLoop, this);
+#else
+  running = true;
+  flushThread = std::thread(&NetworkServer::FlushLoop, this);
+  if (limits.idleTimeoutMs > 0) {
+    idleThread = std::thread(&NetworkServer::IdleLoop, this);
+  }
+  for (size_t i = 0; i < listeners.size(); ++i) {
+    listeners[i].thread =
+        std::thread(&NetworkServer::AcceptLoop, this, &listeners[i]);
+  }
+#endif
   return true;
 }
 
+void NetworkServer::CloseListeners() {
+  for (size_t i = 0; i < listeners.size(); ++i) {
+    closesocket(listeners[i].socket);
+  }
+  listeners.clear();
+}
+
 void NetworkServer::Stop() {
   running = false;
-  if (listenSocket != INVALID_SOCKET) {
-    closesocket(listenSocket);
-    listenSocket = INVALID_SOCKET;
+  if (idleThread.joinable()) {
+    // Taken so the notification cannot fall between its check and its wait.
+    { std::lock_guard<std::mutex> lock(connectionsMutex); }
+    idleStop.notify_all();
+    idleThread.join();
+  }
+#ifdef NETWORK_EPOLL
+  if (delayThread.joinable()) {
+    { std::lock_guard<std::mutex> lock(delayMutex); }
+    delayChanged.notify_all();
+    delayThread.join();
   }
+  delayed.clear(); // those still held are closed below
+  if (wakeFd >= 0) Signal(wakeFd);
   if (serverThread.joinable()) {
-    serverThread.join();
+    serverThread.join(); // on io_uring, once the kernel has let go of all
+  }
+  {
+    std::lock_guard<std::mutex> lock(readyMutex);
+    stopping = true;
+    ready.clear(); // still in `connections`, closed below
+  }
+  readyChanged.notify_all();
+  for (size_t i = 0; i < workers.size(); ++i) {
+    workers[i].join();
+  }
+  workers.clear();
+  // Nothing else can touch a connection now.
+  std::vector<Connection *> remaining(connections.begin(), connections.end());
+  for (size_t i = 0; i < remaining.size(); ++i) {
+    CloseConnection(remaining[i]);
+  }
+  for (size_t i = 0; i < waiting.size(); ++i) {
+    closesocket(waiting[i].second); // never served
+  }
+  waiting.clear();
+#ifdef NETWORK_IO_URING
+  delete uring;
+  uring = NULL;
+#endif
+  if (epollFd >= 0) close(epollFd);
+  if (wakeFd >= 0) close(wakeFd);
+  epollFd = wakeFd = -1;
+  CloseListeners();
+#else
+  // shutdown() is what wakes a thread blocked in accept() on Linux; closing
+  // the socket alone leaves it blocked. They are closed once the loops are
+  // done with them.
+  for (size_t i = 0; i < listeners.size(); ++i) {
+    shutdown(listeners[i].socket, SD_BOTH);
+  }
+  for (size_t i = 0; i < listeners.size(); ++i) {
+    if (listeners[i].thread.joinable()) listeners[i].thread.join();
+  }
+  CloseListeners();
+  // Wake every handler from its recv(), or from waiting to be resumed, and
+  // wait until all have closed.
+  std::unique_lock<std::mutex> lock(connectionsMutex);
+  for (std::unordered_set<Connection *>::iterator it = connections.begin();
+       it != connections.end(); ++it) {
+    if ((*it)->socket != INVALID_SOCKET) shutdown((*it)->socket, SD_BOTH);
+  }
+  connectionsChanged.notify_all();
+  connectionsChanged.wait(lock, [this] { return connections.empty(); });
+  for (size_t i = 0; i < waiting.size(); ++i) {
+    closesocket(waiting[i].second); // never served
   }
+  waiting.clear();
+#endif
+  // Last, since the connections could queue replies until they were closed.
+  if (flushThread.joinable()) {
+    { std::lock_guard<std::mutex> lock(flushMutex); }
+    flushChanged.notify_all();
+    flushThread.join();
+  }
+  flushing.clear(); // replies to connections that are gone
 }
 
-void NetworkServer::ServerLoop() {
+struct NetworkServer::Writer::Channel {
+  std::mutex mutex; // held for a whole reply, so replies do not interleave
+  SOCKET socket;    // INVALID_SOCKET once the connection is closed
+  // What the socket had no room for yet, oldest first; the connection is in
+  // the server's `flushing` while this is not empty.
+  std::vector<unsigned char> unsent;
+  // For Resume(); the connection is null once closed.
+  NetworkServer *server;
+  Connection *connection;
+};
+
+// Sends what `socket` takes of `data` at once, never waiting for the client
+// to read: how many bytes it took, or -1 if the connection is broken.
+static int SendNow(SOCKET socket, const unsigned char *data, int length) {
+#ifdef _WIN32
+  // The sockets block here; one that selects writable has the room for a
+  // reply as short as a status at once.
+  fd_set writable;
+  FD_ZERO(&writable);
+  FD_SET(socket, &writable);
+  struct timeval now = {0, 0};
+  int ready = select(0, NULL, &writable, NULL, &now);
+  if (ready <= 0) return ready < 0 ? -1 : 0;
+  int n = send(socket, (const char *)data, length, 0);
+  return n < 0 ? -1 : n;
+#else
+  for (;;) {
+    int n = (int)send(socket, data, length, MSG_DONTWAIT | SEND_FLAGS);
+    if (n >= 0) return n;
+    if (errno == EINTR) continue;
+    return errno == EAGAIN || errno == EWOULDBLOCK ? 0 : -1;
+  }
+#endif
+}
+
+bool NetworkServer::Writer::Send(const unsigned char *data, int length) const {
+  if (!channel) return false;
+  std::lock_guard<std::mutex> lock(channel->mutex);
+  if (channel->socket == INVALID_SOCKET) return false;
+  std::vector<unsigned char> &unsent = channel->unsent;
+  if (unsent.empty()) {
+    int n = SendNow(channel->socket, data, length);
+    if (n < 0) return false;
+    if (n == length) return true;
+    // The client is not reading as fast as it is answered: the rest goes
+    // out from the flush thread as it does, and the sender moves on.
+    unsent.assign(data + n, data + length);
+    channel->server->Flush(*this);
+    return true;
+  }
+  if (unsent.size() + length > REPLY_QUEUE_BYTES) {
+    ++channel->server->droppedCount;
+    return false;
+  }
+  unsent.insert(unsent.end(), data, data + length); // after the others
+  return true;
+}
+
+void NetworkServer::Flush(const Writer &writer) {
+  {
+    std::lock_guard<std::mutex> lock(flushMutex);
+    flushing.push_back(writer);
+  }
+  flushChanged.notify_one();
+}
+
+void NetworkServer::FlushLoop() {
+  std::unique_lock<std::mutex> lock(flushMutex);
   while (running) {
-    SOCKET clientSocket = accept(listenSocket, NULL, NULL);
-    if (clientSocket == INVALID_SOCKET) {
-      if (running) {
-        // Error or interrupted
+    if (flushing.empty()) {
+      flushChanged.wait(lock);
+      continue;
+    }
+    // Taken out while they are waited on, so that Flush() is never held up;
+    // the ones not done go back after any queued meanwhile.
+    std::vector<Writer> writers;
+    writers.swap(flushing);
+    lock.unlock();
+
+    std::vector<struct pollfd> fds(writers.size());
+    for (size_t i = 0; i < writers.size(); ++i) {
+      std::lock_guard<std::mutex> channelLock(writers[i].channel->mutex);
+      fds[i].fd = writers[i].channel->socket;
+      fds[i].events = POLLOUT;
+      fds[i].revents = 0;
+    }
+#ifdef _WIN32
+    WSAPoll(fds.data(), (ULONG)fds.size(), FLUSH_POLL_MS);
+#else
+    poll(fds.data(), (nfds_t)fds.size(), FLUSH_POLL_MS);
+#endif
+    std::vector<Writer> left;
+    for (size_t i = 0; i < writers.size(); ++i) {
+      Writer::Channel &channel = *writers[i].channel;
+      std::lock_guard<std::mutex> channelLock(channel.mutex);
+      std::vector<unsigned char> &unsent = channel.unsent;
+      if (channel.socket == INVALID_SOCKET) {
+        unsent.clear(); // closed meanwhile
+        continue;
+      }
+      if (fds[i].revents != 0) {
+        int n = SendNow(channel.socket, unsent.data(), (int)unsent.size());
+        if (n < 0) {
+          unsent.clear(); // broken; its onData will see the end
+          continue;
+        }
+        unsent.erase(unsent.begin(), unsent.begin() + n);
+      }
+      if (!unsent.empty()) left.push_back(writers[i]);
+    }
+
+    lock.lock();
+    flushing.insert(flushing.end(), left.begin(), left.end());
+  }
+}
+
+void NetworkServer::Writer::Resume() const {
+  if (!channel) return;
+  std::lock_guard<std::mutex> lock(channel->mutex);
+  if (channel->connection) channel->server->Resume(channel->connection);
+}
+
+void NetworkServer::CloseConnection(Connection *connection) {
+  {
+    // A reply being sent finishes first; later ones find no socket, and
+    // Resume() no connection.
+    Writer::Channel &channel = *connection->writer.channel;
+    std::lock_guard<std::mutex> lock(channel.mutex);
+    channel.socket = INVALID_SOCKET;
+    channel.connection = NULL;
+  }
+  {
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    // Closed under the lock, so Stop() never shuts down a socket number
+    // that has already been reused.
+    closesocket(connection->socket);
+    connection->socket = INVALID_SOCKET;
+  }
+  if (connection->callbacks.onClose) {
+    connection->callbacks.onClose();
+  }
+  // While this one is still in `connections`, so that Stop() keeps waiting
+  // for the one it lets in.
+  ReleaseSlot();
+  {
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    connections.erase(connection);
+#ifndef NETWORK_EPOLL
+    // Last use of the server: Stop() may return and destroy it from here.
+    connectionsChanged.notify_all();
+#endif
+  }
+  delete connection;
+}
+
+NetworkServer::ConnectionStats NetworkServer::GetConnectionStats() {
+  ConnectionStats stats;
+  {
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    stats.open = (int)connections.size();
+    stats.waiting = (int)waiting.size();
+  }
+  stats.queued = queuedCount;
+  stats.refused = refusedCount;
+  stats.idleClosed = idleCount;
+  stats.repliesDropped = droppedCount;
+  return stats;
+}
+
+NetworkServer::FaultStats NetworkServer::GetFaultStats() const {
+  FaultStats stats;
+  stats.delays = faultCounts[FAULT_DELAYS];
+  stats.stalls = faultCounts[FAULT_STALLS];
+  stats.resets = faultCounts[FAULT_RESETS];
+  stats.paperOuts = faultCounts[FAULT_PAPER_OUTS];
+  stats.refused = faultCounts[FAULT_REFUSED];
+  return stats;
+}
+
+NetworkServer::Connection *NetworkServer::AddConnection(Listener &listener,
+                                                        SOCKET socket) {
+  // Every draw is made whether or not its fault is planned, so that turning
+  // one fault on does not change which connections get the others.
+  unsigned long long random = 0;
+  bool refuse = false, reset = false, paperOut = false;
+  long long resetAt = 0;
+  if (faultsOn) {
+    random = faultPlan.seed + accepted.fetch_add(1) * 0xD1B54A32D192ED03ULL;
+    refuse = Chance(random, faultPlan.refusePercent);
+    reset = Chance(random, faultPlan.resetPercent);
+    long long within = faultPlan.resetWithinBytes;
+    if (within < 1) within = 1;
+    resetAt = 1 + (long long)(NextRandom(random) % (unsigned long long)within);
+    paperOut = Chance(random, faultPlan.paperOutPercent);
+  }
+  if (refuse) {
+    ++faultCounts[FAULT_REFUSED];
+    ResetOnClose(socket);
+    closesocket(socket);
+    return NULL;
+  }
+
+  Connection *connection = new Connection;
+  connection->socket = socket;
+  connection->faultRandom = random;
+  if (faultPlan.stallMs > 0 && faultsOn) {
+    connection->stallAt = faultPlan.stallAfterBytes;
+  }
+  if (reset) connection->resetAt = resetAt;
+  if (paperOut) {
+    ++faultCounts[FAULT_PAPER_OUTS];
+    connection->writer.paperOut = true;
+  }
+  // Replies are a few bytes each, and a client waiting for one must not wait
+  // for Nagle's algorithm as well.
+  int noDelay = 1;
+  setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, (const char *)&noDelay,
+             sizeof(noDelay));
+#ifdef SO_NOSIGPIPE
+  int noSigPipe = 1; // a reply to a client that has gone must not kill us
+  setsockopt(socket, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+  connection->writer.channel = std::make_shared<Writer::Channel>();
+  connection->writer.channel->socket = socket;
+  connection->writer.channel->server = this;
+  connection->writer.channel->connection = connection;
+  connection->lastActivityMs = SteadyMs();
+  if (listener.onAccept) {
+    connection->callbacks = listener.onAccept(connection->writer);
+  }
+  std::lock_guard<std::mutex> lock(connectionsMutex);
+  connections.insert(connection);
+#ifndef NETWORK_EPOLL
+  // Let in off the queue while Stop() was waking the others: this one must
+  // not block in recv() either.
+  if (!running) shutdown(socket, SD_BOTH);
+#endif
+  return connection;
+}
+
+NetworkServer::Connection *NetworkServer::Admit(Listener &listener,
+                                                SOCKET socket) {
+  if (limits.maxConnections > 0) {
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    if (slots >= limits.maxConnections) {
+      if ((int)waiting.size() < limits.queueLength) {
+        // Unread until its turn: the client's data waits in the socket.
+        waiting.push_back(std::make_pair(&listener, socket));
+        ++queuedCount;
+      } else {
+        ++refusedCount;
+        ResetOnClose(socket);
+        closesocket(socket);
+      }
+      return NULL;
+    }
+    ++slots;
+  }
+  Connection *connection = AddConnection(listener, socket);
+  if (!connection) ReleaseSlot(); // refused by the fault plan
+  return connection;
+}
+
+void NetworkServer::ReleaseSlot() {
+  if (limits.maxConnections <= 0) return;
+  for (;;) {
+    std::pair<Listener *, SOCKET> next;
+    {
+      std::lock_guard<std::mutex> lock(connectionsMutex);
+      if (waiting.empty() || !running) {
+        --slots;
+        return;
+      }
+      next = waiting.front();
+      waiting.pop_front();
+    }
+    // The place passes to it.
+    Connection *connection = AddConnection(*next.first, next.second);
+    if (connection) {
+      StartServing(connection);
+      return;
+    }
+  }
+}
+
+void NetworkServer::StartServing(Connection *connection) {
+#ifdef NETWORK_EPOLL
+#ifdef NETWORK_IO_URING
+  if (uring) {
+    // Only UringLoop() submits; the wake poll has it look at the list.
+    {
+      std::lock_guard<std::mutex> lock(readyMutex);
+      uringStarting.push_back(connection);
+    }
+    Signal(wakeFd);
+    return;
+  }
+#endif
+  Arm(connection, EPOLL_CTL_ADD);
+#else
+  std::thread clientThread(&NetworkServer::ClientHandler, this, connection);
+  clientThread.detach();
+#endif
+}
+
+void NetworkServer::IdleLoop() {
+  // Looks a few times per timeout, so a connection is closed at most a
+  // quarter of it late.
+  int checkMs = limits.idleTimeoutMs / 4;
+  if (checkMs < 10) checkMs = 10;
+  if (checkMs > 1000) checkMs = 1000;
+  std::unique_lock<std::mutex> lock(connectionsMutex);
+  while (!idleStop.wait_for(lock, std::chrono::milliseconds(checkMs),
+                            [this] { return !running; })) {
+    long long idleSince = SteadyMs() - limits.idleTimeoutMs;
+    for (std::unordered_set<Connection *>::iterator it = connections.begin();
+         it != connections.end(); ++it) {
+      Connection *connection = *it;
+      if (connection->socket == INVALID_SOCKET || connection->busy ||
+          connection->lastActivityMs > idleSince) {
+        continue;
+      }
+      // Under connectionsMutex, as in Stop(), so the socket number cannot
+      // have been reused. The backend then sees the end of the stream and
+      // closes the connection as usual.
+      shutdown(connection->socket, SD_BOTH);
+      connection->lastActivityMs = LLONG_MAX; // counted once
+      ++idleCount;
+    }
+  }
+}
+
+int NetworkServer::Offer(Connection *connection, const unsigned char *data,
+                         int n, int length) {
+  if (!connection->callbacks.onData) return n;
+  int taken = connection->callbacks.onData(data, n);
+  if (taken < n) connection->pending.assign(data + taken, data + length);
+  return taken;
+}
+
+NetworkServer::Delivery NetworkServer::DeliverPending(Connection *connection) {
+  std::vector<unsigned char> data;
+  data.swap(connection->pending); // what is not taken this time goes back
+  return DeliverData(connection, data.data(), (int)data.size(), false);
+}
+
+bool NetworkServer::Hold(Connection *connection) {
+#ifdef NETWORK_EPOLL
+  std::lock_guard<std::mutex> lock(readyMutex);
+#else
+  std::lock_guard<std::mutex> lock(connectionsMutex);
+#endif
+  if (connection->resumed) {
+    connection->resumed = false;
+    return false;
+  }
+  connection->held = true;
+  return true;
+}
+
+void NetworkServer::Resume(Connection *connection) {
+#ifdef NETWORK_EPOLL
+  {
+    std::lock_guard<std::mutex> lock(readyMutex);
+    if (!connection->held) {
+      connection->resumed = true; // its worker looks before holding it
+      return;
+    }
+    connection->held = false;
+    if (stopping) return;
+    // Still busy, so the idle timeout has left it alone.
+#ifdef NETWORK_IO_URING
+    if (uring) {
+      Schedule(connection);
+      uringChanged.push_back(connection); // for UringLoop() to receive again
+    } else {
+      ready.push_back(connection);
+    }
+#else
+    ready.push_back(connection);
+#endif
+  }
+#ifdef NETWORK_IO_URING
+  if (uring) Signal(wakeFd);
+#endif
+  readyChanged.notify_one();
+#else
+  {
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    if (!connection->held) {
+      connection->resumed = true;
+      return;
+    }
+    connection->held = false;
+  }
+  connectionsChanged.notify_all();
+#endif
+}
+
+NetworkServer::Delivery NetworkServer::DeliverData(Connection *connection,
+                                                   const unsigned char *data,
+                                                   int length, bool fresh) {
+  if (!faultsOn) {
+    return Offer(connection, data, length, length) < length ? HELD : DELIVERED;
+  }
+  if (connection->reset) return ENDED;
+
+  if (fresh) {
+    int delayMs = faultPlan.readDelayMs;
+    if (faultPlan.readJitterMs > 0) {
+      delayMs += (int)(NextRandom(connection->faultRandom) %
+                       (unsigned long long)(faultPlan.readJitterMs + 1));
+    }
+    if (delayMs > 0) {
+      ++faultCounts[FAULT_DELAYS];
+      if (Wait(connection, delayMs)) {
+        connection->pending.assign(data, data + length);
+        return HELD;
       }
+    }
+  }
+#ifdef NETWORK_EPOLL
+  if (connection->waitUntilMs > SteadyMs()) {
+    // Resumed early, by the printer making room: the wait is not over.
+    connection->pending.assign(data, data + length);
+    return HELD;
+  }
+#endif
+
+  // Hands the data over in pieces that end where a stall or the reset falls.
+  while (length > 0) {
+    long long end = connection->received + length;
+    if (connection->stallAt >= 0 && connection->stallAt < end) {
+      end = connection->stallAt;
+    }
+    if (connection->resetAt >= 0 && connection->resetAt < end) {
+      end = connection->resetAt;
+    }
+    int n = (int)(end - connection->received);
+    if (n > 0) {
+      int taken = Offer(connection, data, n, length);
+      if (taken < n) {
+        connection->received += taken;
+        return HELD;
+      }
+    }
+    data += n;
+    length -= n;
+    connection->received = end;
+
+    if (end == connection->resetAt) {
+      connection->reset = true;
+      ++faultCounts[FAULT_RESETS];
+      ResetOnClose(connection->socket);
+#ifdef NETWORK_IO_URING
+      // Ends the kernel's receive, and with it the connection, once the
+      // chunks already received have been skipped.
+      if (uring) shutdown(connection->socket, SHUT_RD);
+#endif
+      return ENDED;
+    }
+    if (end == connection->stallAt) {
+      connection->stallAt = -1;
+      ++faultCounts[FAULT_STALLS];
+      if (Wait(connection, faultPlan.stallMs)) {
+        connection->pending.assign(data, data + length);
+        return HELD;
+      }
+    }
+  }
+  return DELIVERED;
+}
+
+bool NetworkServer::Wait(Connection *connection, int ms) {
+#ifdef NETWORK_EPOLL
+  // Counted from the end of a wait still to come, which an early Resume()
+  // may have left behind.
+  long long from = SteadyMs();
+  if (connection->waitUntilMs > from) from = connection->waitUntilMs;
+  connection->waitUntilMs = from + ms;
+  {
+    std::lock_guard<std::mutex> lock(delayMutex);
+    delayed.insert(std::make_pair(connection->waitUntilMs, connection->writer));
+  }
+  delayChanged.notify_one();
+  return true;
+#else
+  // The thread is the connection's own, so it can sleep through it.
+  (void)connection;
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  return false;
+#endif
+}
+
+#ifdef NETWORK_EPOLL
+void NetworkServer::DelayLoop() {
+  std::unique_lock<std::mutex> lock(delayMutex);
+  while (running) {
+    if (delayed.empty()) {
+      delayChanged.wait(lock);
       continue;
     }
+    long long wait = delayed.begin()->first - SteadyMs();
+    if (wait > 0) {
+      delayChanged.wait_for(lock, std::chrono::milliseconds(wait));
+      continue;
+    }
+    Writer writer = delayed.begin()->second;
+    delayed.erase(delayed.begin());
+    lock.unlock();
+    writer.Resume(); // nothing if the connection has ended meanwhile
+    lock.lock();
+  }
+}
+#endif
 
-    // Handle client in a detached thread or block here?
-    // For a simple simulator, blocking here is risky if the client hangs.
-    // Let's spawn a thread.
-    std::thread clientThread(&NetworkServer::ClientHandler, this, clientSocket);
-    clientThread.detach();
+#ifdef NETWORK_EPOLL
+
+bool NetworkServer::IsListener(const void *tag) const {
+  if (listeners.empty()) return false;
+  std::less_equal<const void *> notAfter;
+  return notAfter(&listeners.front(), tag) &&
+         std::less<const void *>()(tag, &listeners.back() + 1);
+}
+
+void NetworkServer::WatchListeners(bool watch) {
+  for (size_t i = 0; i < listeners.size(); ++i) {
+    struct epoll_event ev;
+    ev.events = watch ? (uint32_t)EPOLLIN : 0u;
+    ev.data.ptr = &listeners[i];
+    epoll_ctl(epollFd, EPOLL_CTL_MOD, listeners[i].socket, &ev);
   }
 }
 
-void NetworkServer::ClientHandler(SOCKET clientSocket) {
-  std::vector<unsigned char> buffer(4096);
+void NetworkServer::ServerLoop() {
+  const int MAX_EVENTS = 64;
+  struct epoll_event events[MAX_EVENTS];
+  bool acceptPaused = false;
+  std::chrono::steady_clock::time_point resumeAt;
+
   while (running) {
-    int bytesReceived =
-        recv(clientSocket, (char *)buffer.data(), (int)buffer.size(), 0);
+    int timeout = -1;
+    if (acceptPaused) {
+      long long ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                         resumeAt - std::chrono::steady_clock::now())
+                         .count();
+      if (ms <= 0) {
+        WatchListeners(true);
+        acceptPaused = false;
+      } else {
+        timeout = (int)ms;
+      }
+    }
+
+    int n = epoll_wait(epollFd, events, MAX_EVENTS, timeout);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      break;
+    }
+    for (int i = 0; i < n; ++i) {
+      void *tag = events[i].data.ptr;
+      if (tag == &wakeFd) {
+        continue; // Stop(): `running` is already false
+      } else if (IsListener(tag)) {
+        if (acceptPaused) continue; // reported before the pause
+        if (!AcceptPending(*static_cast<Listener *>(tag))) {
+          // Out of descriptors: stop watching the listening sockets until
+          // some have been freed, rather than waking for them again at once.
+          WatchListeners(false);
+          acceptPaused = true;
+          resumeAt = std::chrono::steady_clock::now() +
+                     std::chrono::milliseconds(ACCEPT_RETRY_MS);
+        }
+      } else {
+        Enqueue(static_cast<Connection *>(tag));
+      }
+    }
+  }
+}
+
+bool NetworkServer::AcceptPending(Listener &listener) {
+  for (;;) {
+    SOCKET clientSocket =
+        accept4(listener.socket, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (clientSocket == INVALID_SOCKET) {
+      if (errno == EINTR || errno == ECONNABORTED) continue;
+      if (errno == EMFILE || errno == ENFILE || errno == ENOBUFS ||
+          errno == ENOMEM) {
+        return false;
+      }
+      return true; // EAGAIN: nothing left to accept
+    }
+    Connection *connection = Admit(listener, clientSocket);
+    if (connection) Arm(connection, EPOLL_CTL_ADD);
+  }
+}
+
+// Asks for one readiness event for `connection`. One-shot: until it is armed
+// again, no other worker can be handed the same connection, which is what
+// keeps its chunks in order.
+void NetworkServer::Arm(Connection *connection, int op) {
+  struct epoll_event ev;
+  ev.events = EPOLLIN | EPOLLRDHUP | EPOLLET | EPOLLONESHOT;
+  ev.data.ptr = connection;
+  epoll_ctl(epollFd, op, connection->socket, &ev);
+}
+
+void NetworkServer::Enqueue(Connection *connection) {
+  {
+    std::lock_guard<std::mutex> lock(readyMutex);
+    if (stopping) return;
+    connection->busy = true; // not idle while its data waits for a worker
+    ready.push_back(connection);
+  }
+  readyChanged.notify_one();
+}
+
+void NetworkServer::WorkerLoop() {
+  std::vector<unsigned char> buffer(RECV_BUFFER_SIZE);
+  for (;;) {
+    Connection *connection;
+    {
+      std::unique_lock<std::mutex> lock(readyMutex);
+      readyChanged.wait(lock, [this] { return stopping || !ready.empty(); });
+      if (stopping) return;
+      connection = ready.front();
+      ready.pop_front();
+    }
+#ifdef NETWORK_IO_URING
+    if (uring) {
+      Deliver(connection);
+      continue;
+    }
+#endif
+    Serve(connection, buffer);
+  }
+}
+
+void NetworkServer::Serve(Connection *connection,
+                          std::vector<unsigned char> &buffer) {
+  // What onData did not take last time goes first.
+  Delivery delivery = DELIVERED;
+  if (!connection->pending.empty()) delivery = DeliverPending(connection);
+
+  // Reads into the buffer until the socket is drained, growing it when it
+  // fills, and hands over what it holds in one call.
+  size_t filled = 0;
+  bool drained = false, closed = false;
+  for (int turn = 0; turn < READS_PER_TURN && delivery == DELIVERED; ++turn) {
+    ssize_t bytesReceived = recv(connection->socket, buffer.data() + filled,
+                                 buffer.size() - filled, 0);
     if (bytesReceived > 0) {
-      if (onDataReceived) {
-        onDataReceived(buffer.data(), bytesReceived);
+      filled += bytesReceived;
+      if (filled < buffer.size()) continue;
+      if (buffer.size() < (size_t)RECV_BUFFER_MAX) {
+        buffer.resize(buffer.size() * 2);
+        continue;
       }
-    } else if (bytesReceived == 0) {
-      // Connection closed
+      // Full at the largest size: hand it over and start again.
+    } else if (bytesReceived < 0 && errno == EINTR) {
+      continue;
+    } else if (bytesReceived < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      drained = true;
+    } else {
+      closed = true; // by the peer, or an error
+    }
+    if (filled > 0) {
+      delivery = DeliverData(connection, buffer.data(), (int)filled, true);
+    }
+    filled = 0;
+    if (drained || closed) break;
+  }
+  if (filled > 0) {
+    delivery = DeliverData(connection, buffer.data(), (int)filled, true);
+  }
+
+  if (delivery == HELD) {
+    // The printer has no room, or a fault plan delay is to pass. Until then
+    // the socket is not read nor watched, so the client's window closes
+    // while the worker serves the others; Resume() puts the connection back
+    // in the queue, and an end of the stream is read again then.
+    if (!Hold(connection)) Enqueue(connection);
+    return;
+  }
+  if (delivery == ENDED || closed) {
+    // Reset by the fault plan, or ended. Leaves the epoll set with close().
+    CloseConnection(connection);
+    return;
+  }
+  if (drained) {
+    // Edge-triggered, so this is the moment to ask for the next event: data
+    // that arrived since the last read raises one at once.
+    connection->lastActivityMs = SteadyMs();
+    connection->busy = false;
+    Arm(connection, EPOLL_CTL_MOD);
+    return;
+  }
+  // Still more to read: back of the queue, behind the other connections.
+  Enqueue(connection);
+}
+
+#ifdef NETWORK_IO_URING
+
+bool NetworkServer::StartUring() {
+  // Multishot receive into provided buffers arrived in 6.0.
+  if (!KernelAtLeast(6, 0)) return false;
+
+  Uring *u = new Uring;
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  params.flags = IORING_SETUP_CQSIZE;
+  params.cq_entries = URING_CQ_ENTRIES;
+  u->fd = (int)syscall(__NR_io_uring_setup, URING_SQ_ENTRIES, &params);
+  // Without NODROP a burst of completions could be lost, and with it any
+  // connection whose last one it was.
+  if (u->fd < 0 || !(params.features & IORING_FEAT_SINGLE_MMAP) ||
+      !(params.features & IORING_FEAT_NODROP)) {
+    delete u;
+    return false;
+  }
+
+  size_t sqBytes = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  size_t cqBytes =
+      params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  u->ringBytes = sqBytes > cqBytes ? sqBytes : cqBytes;
+  void *ring = mmap(NULL, u->ringBytes, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, u->fd, IORING_OFF_SQ_RING);
+  u->sqeBytes = params.sq_entries * sizeof(struct io_uring_sqe);
+  void *sqes = mmap(NULL, u->sqeBytes, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, u->fd, IORING_OFF_SQES);
+  void *bufferRing =
+      mmap(NULL, URING_BUFFERS * sizeof(io_uring_buf), PROT_READ | PROT_WRITE,
+           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  void *buffers = mmap(NULL, (size_t)URING_BUFFERS * URING_BUFFER_SIZE,
+                       PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1,
+                       0);
+  u->ringMemory = ring == MAP_FAILED ? NULL : ring;
+  u->sqes = sqes == MAP_FAILED ? NULL : (struct io_uring_sqe *)sqes;
+  u->bufferRing = bufferRing == MAP_FAILED
+                      ? NULL
+                      : (struct io_uring_buf_ring *)bufferRing;
+  u->buffers = buffers == MAP_FAILED ? NULL : (unsigned char *)buffers;
+  if (!u->ringMemory || !u->sqes || !u->bufferRing || !u->buffers) {
+    delete u;
+    return false;
+  }
+
+  char *base = (char *)u->ringMemory;
+  u->sqHead = (unsigned *)(base + params.sq_off.head);
+  u->sqTail = (unsigned *)(base + params.sq_off.tail);
+  u->sqArray = (unsigned *)(base + params.sq_off.array);
+  u->sqMask = *(unsigned *)(base + params.sq_off.ring_mask);
+  u->sqEntries = params.sq_entries;
+  u->cqHead = (unsigned *)(base + params.cq_off.head);
+  u->cqTail = (unsigned *)(base + params.cq_off.tail);
+  u->cqMask = *(unsigned *)(base + params.cq_off.ring_mask);
+  u->cqes = (struct io_uring_cqe *)(base + params.cq_off.cqes);
+  for (unsigned i = 0; i < u->sqEntries; ++i) u->sqArray[i] = i;
+
+  struct io_uring_buf_reg reg;
+  memset(&reg, 0, sizeof(reg));
+  reg.ring_addr = (unsigned long long)(uintptr_t)u->bufferRing;
+  reg.ring_entries = URING_BUFFERS;
+  reg.bgid = 0;
+  if (syscall(__NR_io_uring_register, u->fd, IORING_REGISTER_PBUF_RING, &reg,
+              1) < 0) {
+    delete u;
+    return false;
+  }
+  for (unsigned i = 0; i < URING_BUFFERS; ++i) {
+    unsigned short id = (unsigned short)i;
+    u->ReturnBuffers(&id, 1);
+  }
+
+  // Make sure the kernel really takes from the ring: receive one byte
+  // through it from a socket pair.
+  int pair[2];
+  if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, pair) != 0) {
+    delete u;
+    return false;
+  }
+  bool ringWorks = false;
+  struct io_uring_cqe cqe;
+  if (send(pair[1], "", 1, 0) == 1) {
+    struct io_uring_sqe *sqe = u->NextSqe();
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = pair[0];
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = 0;
+    if (u->NextCqe(&cqe) && cqe.res == 1 &&
+        (cqe.flags & IORING_CQE_F_BUFFER)) {
+      unsigned short id =
+          (unsigned short)(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+      u->ReturnBuffers(&id, 1);
+      ringWorks = true;
+    }
+  }
+  close(pair[0]);
+  close(pair[1]);
+  if (!ringWorks) {
+    syscall(__NR_io_uring_register, u->fd, IORING_UNREGISTER_PBUF_RING, &reg,
+            1);
+    munmap(u->bufferRing, URING_BUFFERS * sizeof(io_uring_buf));
+    u->bufferRing = NULL;
+    u->legacyBuffers = true;
+    u->ProvideBuffers(0, URING_BUFFERS, 0);
+    if (!u->NextCqe(&cqe) || cqe.res < 0) {
+      delete u;
+      return false;
+    }
+  }
+
+  u->acceptDelay.tv_sec = 0;
+  u->acceptDelay.tv_nsec = ACCEPT_RETRY_MS * 1000000LL;
+  u->bufferDelay.tv_sec = 0;
+  u->bufferDelay.tv_nsec = URING_BUFFER_RETRY_MS * 1000000LL;
+  uring = u;
+  // Submitted by UringLoop() on its first turn.
+  for (size_t i = 0; i < listeners.size(); ++i) ArmAccept(&listeners[i]);
+  struct io_uring_sqe *sqe = u->NextSqe();
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = wakeFd;
+  sqe->poll32_events = POLLIN;
+  sqe->len = IORING_POLL_ADD_MULTI;
+  sqe->user_data = (unsigned long long)(uintptr_t)&wakeFd;
+  return true;
+}
+
+// One accept request that keeps completing, once per connection.
+void NetworkServer::ArmAccept(Listener *listener) {
+  struct io_uring_sqe *sqe = uring->NextSqe();
+  sqe->opcode = IORING_OP_ACCEPT;
+  sqe->fd = listener->socket;
+  sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+  sqe->accept_flags = SOCK_CLOEXEC;
+  sqe->user_data = (unsigned long long)(uintptr_t)listener;
+}
+
+// One receive request that keeps completing, a chunk per buffer, until the
+// connection ends or the buffers run out.
+void NetworkServer::ArmRecv(Connection *connection) {
+  struct io_uring_sqe *sqe = uring->NextSqe();
+  sqe->opcode = IORING_OP_RECV;
+  sqe->fd = connection->socket;
+  sqe->ioprio = IORING_RECV_MULTISHOT;
+  sqe->flags = IOSQE_BUFFER_SELECT;
+  sqe->buf_group = 0;
+  sqe->user_data = (unsigned long long)(uintptr_t)connection;
+  connection->receive = Connection::RECEIVE_ARMED;
+}
+
+void NetworkServer::UpdateReceive(Connection *connection, int &inFlight) {
+  bool wanted = !connection->held && !connection->ended;
+  if (wanted && connection->receive == Connection::RECEIVE_IDLE) {
+    ArmRecv(connection);
+    ++inFlight;
+  } else if (!wanted && connection->receive == Connection::RECEIVE_ARMED) {
+    // A held connection must not go on taking buffers the others need. The
+    // receive ends with -ECANCELED, or sooner on its own.
+    struct io_uring_sqe *sqe = uring->NextSqe();
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->addr = (unsigned long long)(uintptr_t)connection;
+    sqe->user_data = 0; // its own completion is ignored, as Stop()'s
+    connection->receive = Connection::RECEIVE_CANCELLING;
+  }
+}
+
+void NetworkServer::UringLoop() {
+  Uring *u = uring;
+  // Requests the kernel still holds: one accept per listener, the wake poll
+  // and one receive per connection, plus any timer. Stop() waits until there
+  // are none, so nothing completes into freed memory.
+  int inFlight = 1 + (int)listeners.size();
+  bool draining = false;
+  std::vector<Connection *> starved; // waiting for a free buffer
+  std::vector<Listener *> acceptStarved; // waiting for a free descriptor
+  // Held across the receive completions of a batch, and let go before
+  // anything that calls out, like onAccept.
+  std::unique_lock<std::mutex> readyLock(readyMutex, std::defer_lock);
+  int queued = 0; // connections put on `ready` in this batch
+
+  while (inFlight > 0) {
+    if (!running && !draining) {
+      struct io_uring_sqe *sqe = u->NextSqe();
+      sqe->opcode = IORING_OP_ASYNC_CANCEL;
+      sqe->cancel_flags = IORING_ASYNC_CANCEL_ANY;
+      sqe->user_data = 0;
+      draining = true;
+    }
+    if (u->legacyBuffers) u->ProvideReturned();
+    if (u->Enter(1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR &&
+        errno != EBUSY) {
       break;
+    }
+
+    unsigned head = *u->cqHead;
+    unsigned tail = __atomic_load_n(u->cqTail, __ATOMIC_ACQUIRE);
+    for (; head != tail; ++head) {
+      struct io_uring_cqe *cqe = &u->cqes[head & u->cqMask];
+      void *tag = (void *)(uintptr_t)cqe->user_data;
+      int res = cqe->res;
+      bool more = (cqe->flags & IORING_CQE_F_MORE) != 0;
+
+      bool received = tag != NULL && tag != &wakeFd && !IsListener(tag) &&
+                      tag != &u->acceptDelay && tag != &u->bufferDelay;
+      if (received && !readyLock.owns_lock()) {
+        readyLock.lock();
+      } else if (!received && readyLock.owns_lock()) {
+        readyLock.unlock();
+      }
+
+      if (tag == NULL) {
+        continue; // the cancellation itself
+      } else if (tag == &wakeFd) {
+        uint64_t count;
+        if (read(wakeFd, &count, sizeof(count)) < 0) {
+          // Already drained by an earlier completion.
+        }
+        // Let in off the queue by ReleaseSlot(); when draining, left for
+        // Stop() to close. Held and resumed ones stop or start receiving.
+        std::vector<Connection *> starting;
+        {
+          std::lock_guard<std::mutex> lock(readyMutex);
+          starting.swap(uringStarting);
+          if (!draining) {
+            for (size_t i = 0; i < uringChanged.size(); ++i) {
+              UpdateReceive(uringChanged[i], inFlight);
+            }
+          }
+          uringChanged.clear();
+        }
+        if (!draining) {
+          for (size_t i = 0; i < starting.size(); ++i) ArmRecv(starting[i]);
+          inFlight += (int)starting.size();
+        }
+        if (!more) {
+          --inFlight;
+          if (!draining) {
+            struct io_uring_sqe *sqe = u->NextSqe();
+            sqe->opcode = IORING_OP_POLL_ADD;
+            sqe->fd = wakeFd;
+            sqe->poll32_events = POLLIN;
+            sqe->len = IORING_POLL_ADD_MULTI;
+            sqe->user_data = cqe->user_data;
+            ++inFlight;
+          }
+        }
+      } else if (tag == &u->acceptDelay) {
+        --inFlight;
+        u->acceptRetryPending = false;
+        if (!draining) {
+          for (size_t i = 0; i < acceptStarved.size(); ++i) {
+            ArmAccept(acceptStarved[i]);
+          }
+          inFlight += (int)acceptStarved.size();
+        }
+        acceptStarved.clear();
+      } else if (tag == &u->bufferDelay) {
+        --inFlight;
+        u->bufferRetryPending = false;
+        if (!draining) {
+          // Those held meanwhile wait to be resumed instead.
+          std::lock_guard<std::mutex> lock(readyMutex);
+          for (size_t i = 0; i < starved.size(); ++i) {
+            starved[i]->receive = Connection::RECEIVE_IDLE;
+            UpdateReceive(starved[i], inFlight);
+          }
+        }
+        starved.clear();
+      } else if (IsListener(tag)) {
+        Listener *listener = static_cast<Listener *>(tag);
+        if (res >= 0) {
+          Connection *connection = Admit(*listener, res);
+          if (connection && !draining) { // otherwise left for Stop() to close
+            ArmRecv(connection);
+            ++inFlight;
+          }
+        }
+        if (!more) {
+          --inFlight;
+          if (!draining) {
+            // Out of descriptors or memory: wait before accepting again
+            // rather than failing again at once.
+            bool starving = res == -EMFILE || res == -ENFILE ||
+                            res == -ENOBUFS || res == -ENOMEM;
+            if (!starving) {
+              ArmAccept(listener);
+              ++inFlight;
+            } else {
+              acceptStarved.push_back(listener);
+              if (!u->acceptRetryPending) {
+                struct io_uring_sqe *sqe = u->NextSqe();
+                sqe->opcode = IORING_OP_TIMEOUT;
+                sqe->addr = (unsigned long long)(uintptr_t)&u->acceptDelay;
+                sqe->len = 1;
+                sqe->user_data =
+                    (unsigned long long)(uintptr_t)&u->acceptDelay;
+                u->acceptRetryPending = true;
+                ++inFlight;
+              }
+            }
+          }
+        }
+      } else {
+        Connection *connection = static_cast<Connection *>(tag);
+        if (!more) {
+          --inFlight;
+          connection->receive = Connection::RECEIVE_IDLE;
+        }
+        if (res > 0 && (cqe->flags & IORING_CQE_F_BUFFER)) {
+          unsigned short id =
+              (unsigned short)(cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+          connection->chunks.push_back(std::make_pair(id, res));
+          queued += Schedule(connection);
+          if (!more && !draining) UpdateReceive(connection, inFlight);
+        } else if (res == -ECANCELED && !draining) {
+          // Stopped because the connection is held; receives again once it
+          // is resumed, which may already have happened.
+          UpdateReceive(connection, inFlight);
+        } else if (res == -ENOBUFS) {
+          // Every buffer waits for the parser. Try again shortly; until
+          // then the socket fills and TCP slows the sender down.
+          if (!draining) {
+            connection->receive = Connection::RECEIVE_STARVED;
+            starved.push_back(connection);
+            if (!u->bufferRetryPending) {
+              struct io_uring_sqe *sqe = u->NextSqe();
+              sqe->opcode = IORING_OP_TIMEOUT;
+              sqe->addr = (unsigned long long)(uintptr_t)&u->bufferDelay;
+              sqe->len = 1;
+              sqe->user_data = (unsigned long long)(uintptr_t)&u->bufferDelay;
+              u->bufferRetryPending = true;
+              ++inFlight;
+            }
+          }
+        } else {
+          // Closed by the peer, an error, or cancelled by Stop(). This was
+          // the last completion for it; the worker closes it once the
+          // chunks before it are delivered.
+          connection->ended = true;
+          queued += Schedule(connection);
+        }
+      }
+    }
+    __atomic_store_n(u->cqHead, head, __ATOMIC_RELEASE);
+    if (readyLock.owns_lock()) readyLock.unlock();
+    if (queued == 1) {
+      readyChanged.notify_one();
+    } else if (queued > 1) {
+      readyChanged.notify_all();
+    }
+    queued = 0;
+  }
+}
+
+// Puts `connection` on the ready queue unless a worker already has it or it
+// is held. Called with readyMutex held; returns how many were queued.
+int NetworkServer::Schedule(Connection *connection) {
+  if (connection->scheduled || connection->held || stopping) return 0;
+  connection->scheduled = true;
+  connection->busy = true;
+  ready.push_back(connection);
+  return 1;
+}
+
+void NetworkServer::Deliver(Connection *connection) {
+  // What onData did not take last time goes first.
+  Delivery delivery = DELIVERED;
+  if (!connection->pending.empty()) delivery = DeliverPending(connection);
+
+  std::pair<unsigned short, int> chunks[READS_PER_TURN];
+  int count = 0;
+  if (delivery != HELD) {
+    std::lock_guard<std::mutex> lock(readyMutex);
+    while (count < READS_PER_TURN && !connection->chunks.empty()) {
+      chunks[count++] = connection->chunks.front();
+      connection->chunks.pop_front();
+    }
+  }
+
+  // Handed over, or skipped after a reset by the fault plan until the
+  // receive ends; a chunk onData took only part of is kept in `pending`.
+  // Their buffers go back.
+  unsigned short ids[READS_PER_TURN];
+  int done = 0;
+  for (; done < count && delivery != HELD; ++done) {
+    delivery = DeliverData(connection,
+                           uring->buffers +
+                               (size_t)chunks[done].first * URING_BUFFER_SIZE,
+                           chunks[done].second, true);
+    ids[done] = chunks[done].first;
+  }
+  uring->ReturnBuffers(ids, done);
+
+  bool held = false;
+  {
+    std::lock_guard<std::mutex> lock(readyMutex);
+    // The rest keep their buffers and their place, first in line.
+    for (int i = count; i > done; --i) {
+      connection->chunks.push_front(chunks[i - 1]);
+    }
+    if (delivery == HELD) {
+      if (!connection->resumed) {
+        // Until Resume(), no worker is handed it and UringLoop() stops
+        // receiving on it.
+        connection->held = held = true;
+        connection->scheduled = false;
+        uringChanged.push_back(connection);
+      } else {
+        connection->resumed = false;
+        if (!stopping) ready.push_back(connection);
+        connection = NULL;
+      }
+    } else if (connection->chunks.empty() && !connection->ended) {
+      connection->scheduled = false;
+      connection->lastActivityMs = SteadyMs();
+      connection->busy = false;
+      return;
+    } else if (!connection->chunks.empty()) {
+      // More came meanwhile: back of the queue, behind the others. Another
+      // worker may have it as soon as the lock is let go.
+      if (!stopping) ready.push_back(connection);
+      connection = NULL;
     } else {
-      // Error
+      // Delivered up to the end. Nothing may point to it once it is freed.
+      uringChanged.erase(
+          std::remove(uringChanged.begin(), uringChanged.end(), connection),
+          uringChanged.end());
+    }
+  }
+  if (held) {
+    Signal(wakeFd);
+    return;
+  }
+  if (!connection) {
+    readyChanged.notify_one();
+    return;
+  }
+  CloseConnection(connection);
+}
+
+#endif
+
+#else
+
+void NetworkServer::AcceptLoop(Listener *listener) {
+  while (running) {
+    SOCKET clientSocket = accept(listener->socket, NULL, NULL);
+    if (clientSocket == INVALID_SOCKET) {
+      if (!running) break; // Stop() closed the socket
+      // Out of descriptors, most likely: retrying at once would only fail
+      // again, at full speed.
+      std::this_thread::sleep_for(std::chrono::milliseconds(ACCEPT_RETRY_MS));
+      continue;
+    }
+
+    Connection *connection = Admit(*listener, clientSocket);
+    if (!connection) continue; // waiting, or refused
+    std::thread clientThread(&NetworkServer::ClientHandler, this, connection);
+    clientThread.detach();
+  }
+}
+
+// Bytes that can be read from `socket` without waiting, up to `length`;
+// 0 when there are none yet.
+static int RecvAvailable(SOCKET socket, unsigned char *data, int length) {
+#ifdef _WIN32
+  u_long available = 0;
+  if (ioctlsocket(socket, FIONREAD, &available) != 0 || available == 0) {
+    return 0;
+  }
+  int n = recv(socket, (char *)data,
+               available < (u_long)length ? (int)available : length, 0);
+#else
+  int n = (int)recv(socket, data, length, MSG_DONTWAIT);
+#endif
+  // An error or the end of the stream is left for the next blocking recv()
+  return n > 0 ? n : 0;
+}
+
+void NetworkServer::ClientHandler(Connection *connection) {
+  std::vector<unsigned char> buffer(RECV_BUFFER_SIZE);
+  int smallReads = 0;
+  for (;;) {
+    int bytesReceived = recv(connection->socket, (char *)buffer.data(),
+                             (int)buffer.size(), 0);
+    if (bytesReceived <= 0) {
+      // Closed by the peer, or an error, or shut down by Stop()
       break;
     }
+    // A full buffer means more is waiting: grow it and take that too
+    // before calling the parser.
+    size_t filled = bytesReceived;
+    while (filled == buffer.size() && buffer.size() < (size_t)RECV_BUFFER_MAX) {
+      buffer.resize(buffer.size() * 2);
+      int more = RecvAvailable(connection->socket, buffer.data() + filled,
+                               (int)(buffer.size() - filled));
+      if (more == 0) break;
+      filled += more;
+    }
+    connection->busy = true;
+    Delivery delivery =
+        DeliverData(connection, buffer.data(), (int)filled, true);
+    while (delivery == HELD) {
+      // The thread is the connection's own: it waits here, unread, until
+      // Resume() or Stop().
+      if (Hold(connection)) {
+        std::unique_lock<std::mutex> lock(connectionsMutex);
+        connectionsChanged.wait(lock, [this, connection] {
+          return !connection->held || !running;
+        });
+        if (connection->held) break;
+      }
+      delivery = DeliverPending(connection);
+    }
+    connection->lastActivityMs = SteadyMs();
+    connection->busy = false;
+    if (delivery != DELIVERED) break;
+    // Give the memory back once the data comes in small pieces again, so
+    // that a connection kept open after a large job does not hold it.
+    if (buffer.size() > (size_t)RECV_BUFFER_SIZE && filled < buffer.size() / 4) {
+      if (++smallReads == 16) {
+        std::vector<unsigned char>(buffer.size() / 2).swap(buffer);
+        smallReads = 0;
+      }
+    } else {
+      smallReads = 0;
+    }
   }
-  closesocket(clientSocket);
+  CloseConnection(connection);
 }
+
+#endif
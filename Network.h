@@ -1,8 +1,15 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <unordered_set>
+#include <vector>
 
 #ifdef _WIN32
 #include <winsock2.h>
@@ -21,28 +28,347 @@
 #define SOCKET int
 #define INVALID_SOCKET -1
 #define SOCKET_ERROR -1
+#define SD_BOTH SHUT_RDWR
 #define ZeroMemory(p, size) memset(p, 0, size)
 #define closesocket close
 #endif
 
+// On Linux, connections are served by an epoll reactor and a fixed pool of
+// workers, so an idle connection costs a file descriptor and no thread.
+// Elsewhere, or when built with NETWORK_THREAD_PER_CONNECTION, every
+// connection gets a thread of its own.
+#if defined(__linux__) && !defined(NETWORK_THREAD_PER_CONNECTION)
+#define NETWORK_EPOLL 1
+// The io_uring backend needs only the kernel headers, not liburing.
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define NETWORK_IO_URING 1
+#endif
+#endif
+#endif
+
 class NetworkServer {
 public:
+  // What to do with one client connection. onData runs for every chunk
+  // received, in order and never on two threads at once for the same
+  // connection, and returns how much of the chunk it took. Taking less holds
+  // the connection: nothing more is read from its socket, so the client's
+  // window closes, and the rest is handed to onData again, before anything
+  // newer, once the connection's Writer::Resume() is called. No thread waits
+  // meanwhile. onClose runs once after the last chunk, however the
+  // connection ended. Which thread they run on depends on the model above.
+  struct ConnectionCallbacks {
+    std::function<int(const unsigned char *, int)> onData;
+    std::function<void()> onClose;
+  };
+
+  // Sends to the client of one connection, such as the replies to status
+  // requests. Copies may be kept and used from any thread; sends from several
+  // threads go out one after the other. Send() never waits for the client to
+  // read: what its socket has no room for is sent later, in order, as it
+  // reads, and a reply that would make more than 64 KB wait is dropped.
+  // Send() returns false then, and once the connection is closed.
+  class Writer {
+  public:
+    bool Send(const unsigned char *data, int length) const;
+    // Has a connection held by onData taking less than it was given read
+    // again. Safe from any thread at any time, even while onData is still
+    // running; does nothing once the connection is closed.
+    void Resume() const;
+    // The fault plan picked this connection to be told the paper is out.
+    bool PaperOut() const { return paperOut; }
+
+  private:
+    friend class NetworkServer;
+    struct Channel; // the socket, while the connection is open
+    std::shared_ptr<Channel> channel;
+    bool paperOut = false;
+  };
+
+  // Called for every new connection with the means to answer it; returns
+  // the callbacks that will serve it.
+  typedef std::function<ConnectionCallbacks(const Writer &)> AcceptCallback;
+
+  // A port to listen on and what serves the connections it accepts.
+  struct Endpoint {
+    int port;
+    AcceptCallback onAccept;
+    // SO_RCVBUF of its connections, to make the TCP window close as soon as
+    // a small printer's would; the system may round it up. 0 = the default.
+    // On io_uring the kernel also receives ahead into the server's buffer
+    // ring, so the window only closes once that is full too.
+    int receiveBufferBytes = 0;
+  };
+
+  // Limits that keep one misbehaving client from taking the server from the
+  // others.
+  struct Limits {
+    // Connections served at once; 0 = no limit. Those accepted beyond it
+    // wait, unread, in a queue of up to queueLength and are served in turn
+    // as others close. Beyond that they are reset at once.
+    int maxConnections = 0;
+    int queueLength = 0;
+    // A connection that has received nothing for this long is closed; 0 =
+    // never. Time its data spends waiting for the printer does not count.
+    int idleTimeoutMs = 0;
+  };
+  struct ConnectionStats {
+    int open = 0;    // being served
+    int waiting = 0; // in the queue
+    // Since Start():
+    unsigned long long queued = 0;     // made to wait in the queue
+    unsigned long long refused = 0;    // reset for want of room in it
+    unsigned long long idleClosed = 0; // closed by the idle timeout
+    // Replies dropped because their client was not reading them.
+    unsigned long long repliesDropped = 0;
+  };
+
+  // Faults to inject, for testing how clients cope with a flaky printer
+  // without a proxy in between. Each connection draws its faults from a
+  // generator seeded with `seed` and the connection's number in accept
+  // order, so a run can be repeated exactly. A delay or a stall holds up
+  // only its own connection.
+  struct FaultPlan {
+    unsigned long long seed = 1;
+    int readDelayMs = 0;  // before every chunk is handed to onData...
+    int readJitterMs = 0; // ...plus a random 0 to this much more
+    long long stallAfterBytes = 0; // once a connection has received this
+    int stallMs = 0;               // much, it stops reading for stallMs
+    int resetPercent = 0; // connections reset partway, after a random
+    long long resetWithinBytes = 4096; // number of bytes up to this
+    int paperOutPercent = 0; // connections whose Writer says PaperOut()
+    int refusePercent = 0;   // connections reset as soon as accepted
+  };
+  // How many of each fault were injected since Start().
+  struct FaultStats {
+    unsigned long long delays = 0;
+    unsigned long long stalls = 0;
+    unsigned long long resets = 0;
+    unsigned long long paperOuts = 0;
+    unsigned long long refused = 0;
+  };
+
+  // How connections are served. BACKEND_IO_URING (Linux 6.0 or later) has
+  // the kernel accept and receive on its own, into a ring of buffers that
+  // onData reads in place; without it, Start() falls back to the default.
+  enum Backend { BACKEND_DEFAULT, BACKEND_IO_URING };
+
   NetworkServer();
   ~NetworkServer();
 
-  // Start listening on the specified port
-  bool Start(int port,
-             std::function<void(const unsigned char *, int)> dataCallback);
+  // Takes effect at the next Start().
+  void SetBackend(Backend backend) { requestedBackend = backend; }
+  // The backend the server is running on, once started.
+  Backend GetBackend() const { return activeBackend; }
+  // Takes effect at the next Start(). The default limits are none.
+  void SetLimits(const Limits &newLimits) { limits = newLimits; }
+  ConnectionStats GetConnectionStats();
+  // Takes effect at the next Start(). A default plan injects nothing.
+  void SetFaultPlan(const FaultPlan &plan) { faultPlan = plan; }
+  FaultStats GetFaultStats() const;
+
+  // Start listening on the specified port. `acceptCallback` is called for
+  // every new connection and returns the callbacks that will serve it.
+  bool Start(int port, AcceptCallback acceptCallback);
+  // Listens on every port of `endpoints` at once. Their connections share one
+  // reactor and worker pool (or, with a thread per connection, the ports get
+  // an accepting thread each). A connection held by its onData gives its
+  // worker back, so a busy printer on one port cannot hold up the others. If
+  // any port cannot be opened, none is.
+  bool Start(const std::vector<Endpoint> &endpoints);
 
-  // Stop the server
+  // Stops listening and closes the connections still open, each with its
+  // onClose. Returns once no callback is running any more.
   void Stop();
 
 private:
-  void ServerLoop();
-  void ClientHandler(SOCKET clientSocket);
+  struct Connection {
+    SOCKET socket;
+    ConnectionCallbacks callbacks;
+    Writer writer;
+    // Fault injection: the connection's own generator, what it has been
+    // handed so far, and where it is to stall and be reset (-1 = never).
+    unsigned long long faultRandom = 0;
+    long long received = 0;
+    long long stallAt = -1;
+    long long resetAt = -1;
+    bool reset = false; // done: nothing more is delivered
+#ifdef NETWORK_EPOLL
+    // Until when, in steady milliseconds, it is held for a delay or a stall:
+    // the workers are shared, so none of them sleeps through it.
+    long long waitUntilMs = 0;
+#endif
+    // What onData did not take, handed to it again once the connection is
+    // resumed; only the thread serving the connection touches it.
+    std::vector<unsigned char> pending;
+    // Guarded by readyMutex (connectionsMutex with a thread per
+    // connection): waiting for Writer::Resume() to be read again, and
+    // whether Resume() came while it was still being served.
+    bool held = false;
+    bool resumed = false;
+    // For the idle timeout: when data last came in, in steady milliseconds,
+    // and whether some is being read or parsed now, which is not idle.
+    std::atomic<long long> lastActivityMs{0};
+    std::atomic<bool> busy{false};
+#ifdef NETWORK_IO_URING
+    // io_uring only, guarded by readyMutex: buffers received and not yet
+    // handed to onData, as (buffer id, length).
+    std::deque<std::pair<unsigned short, int> > chunks;
+    bool scheduled = false; // queued for a worker, or being served by one
+    bool ended = false;     // no more chunks will come
+    // UringLoop() only: whether the kernel has a receive request for it,
+    // one being cancelled because it is held, or one waiting for buffers.
+    enum {
+      RECEIVE_IDLE,
+      RECEIVE_ARMED,
+      RECEIVE_CANCELLING,
+      RECEIVE_STARVED
+    } receive = RECEIVE_IDLE;
+#endif
+  };
+
+  struct Listener {
+    SOCKET socket;
+    AcceptCallback onAccept;
+#ifndef NETWORK_EPOLL
+    std::thread thread; // blocked in accept()
+#endif
+  };
 
-  SOCKET listenSocket;
+  // One per endpoint. Filled by Start() and left alone until Stop(), since
+  // the reactor tells listeners apart by their address in it.
+  std::vector<Listener> listeners;
   std::thread serverThread;
   std::atomic<bool> running;
-  std::function<void(const unsigned char *, int)> onDataReceived;
+  Backend requestedBackend;
+  Backend activeBackend;
+
+  Limits limits;
+  std::atomic<unsigned long long> queuedCount, refusedCount, idleCount;
+  std::atomic<unsigned long long> droppedCount; // by Writer::Send()
+
+  FaultPlan faultPlan;
+  bool faultsOn; // faultPlan injects anything; set by Start()
+  std::atomic<unsigned long long> accepted; // numbers connections for faults
+  std::atomic<unsigned long long> faultCounts[5]; // in FaultStats order
+
+  // Open connections, so that Stop() can close them.
+  std::unordered_set<Connection *> connections;
+  std::mutex connectionsMutex;
+  // Also guarded by connectionsMutex: connections accepted over
+  // limits.maxConnections, oldest first, and how many count against it.
+  std::deque<std::pair<Listener *, SOCKET> > waiting;
+  int slots;
+  // Shuts down the connections idle for longer than limits.idleTimeoutMs,
+  // which then end as if closed by their client.
+  std::thread idleThread;
+  std::condition_variable idleStop; // with connectionsMutex
+  void IdleLoop();
+  // Writers whose client has replies waiting for room in its socket, and the
+  // thread that sends them as the client reads.
+  std::vector<Writer> flushing;
+  std::mutex flushMutex;
+  std::condition_variable flushChanged;
+  std::thread flushThread;
+  // Has the flush thread send the `unsent` replies of `writer`; called by
+  // Writer::Send() with its channel's mutex held.
+  void Flush(const Writer &writer);
+  void FlushLoop();
+  // What the accept loops call: AddConnection(), or a place in the queue,
+  // or a reset, as the limits allow. Null unless the connection is to be
+  // served now.
+  Connection *Admit(Listener &listener, SOCKET socket);
+  // Gives the place of a connection that has ended to the oldest one
+  // waiting, if any, and starts serving it.
+  void ReleaseSlot();
+  // Has the backend serve a connection admitted off its accept thread.
+  void StartServing(Connection *connection);
+  // Ends `connection`: closes its socket, calls onClose and frees it.
+  void CloseConnection(Connection *connection);
+  // A new connection on `socket`, accepted by `listener`, as yet unserved.
+  // Null if the fault plan refused it, in which case the socket is gone.
+  Connection *AddConnection(Listener &listener, SOCKET socket);
+  // What became of the bytes handed to DeliverData().
+  enum Delivery {
+    DELIVERED, // all taken
+    HELD,      // the rest waits in `pending` until the connection is resumed
+    ENDED      // reset by the fault plan: the caller is to end it
+  };
+  // Hands `length` received bytes to onData, with the faults of the plan.
+  // `fresh` bytes are newly received and have the read delay drawn for them;
+  // those coming back from `pending` have had theirs.
+  Delivery DeliverData(Connection *connection, const unsigned char *data,
+                       int length, bool fresh);
+  // Hands `pending` to onData again.
+  Delivery DeliverPending(Connection *connection);
+  // Hands `n` of the `length` bytes at `data` to onData and keeps all it did
+  // not take in `pending`; returns how many it took.
+  int Offer(Connection *connection, const unsigned char *data, int n,
+            int length);
+  // After a HELD delivery: true if the connection now waits for Resume(),
+  // false if that has already come and it is to be served again at once.
+  bool Hold(Connection *connection);
+  // Writer::Resume(): serves a held connection again.
+  void Resume(Connection *connection);
+  // Has the fault plan's delay or stall of `ms` pass before the connection's
+  // data goes on. True if the connection is to be held until then; with a
+  // thread per connection its thread sleeps instead and it is false.
+  bool Wait(Connection *connection, int ms);
+  void CloseListeners();
+
+#ifdef NETWORK_EPOLL
+  int epollFd;
+  int wakeFd; // an eventfd that wakes the reactor for Stop()
+  std::vector<std::thread> workers;
+  std::deque<Connection *> ready; // connections with data to read
+  std::mutex readyMutex;
+  std::condition_variable readyChanged;
+  bool stopping; // guarded by readyMutex
+  // Connections held for a fault plan delay or stall, by when they are to be
+  // resumed. Their Writer is kept rather than the connection, which may end
+  // before its time comes.
+  std::multimap<long long, Writer> delayed;
+  std::mutex delayMutex;
+  std::condition_variable delayChanged;
+  std::thread delayThread; // only while the plan has delays or stalls
+  void DelayLoop();
+
+  void ServerLoop();
+  bool IsListener(const void *tag) const;
+  // Accepts every pending connection. False when out of descriptors, so
+  // the reactor stops accepting for a while instead of spinning.
+  bool AcceptPending(Listener &listener);
+  // Has the reactor watch the listening sockets, or stop watching them.
+  void WatchListeners(bool watch);
+  void Arm(Connection *connection, int op);
+  void Enqueue(Connection *connection);
+  void WorkerLoop();
+  // Reads what `connection` has, a bounded number of chunks per turn.
+  void Serve(Connection *connection, std::vector<unsigned char> &buffer);
+
+#ifdef NETWORK_IO_URING
+  struct Uring; // the rings and buffers, defined in Network.cpp
+  Uring *uring; // null unless running on io_uring
+  bool StartUring();
+  void UringLoop();
+  void ArmAccept(Listener *listener);
+  void ArmRecv(Connection *connection);
+  int Schedule(Connection *connection);
+  // Connections for UringLoop() to start receiving on, off the queue of
+  // waiting ones, and those held or resumed since it last looked, for it to
+  // stop or restart receiving on; guarded by readyMutex.
+  std::vector<Connection *> uringStarting;
+  std::vector<Connection *> uringChanged;
+  // Has the kernel receive for `connection` while it is not held, and stop
+  // while it is. Called by UringLoop() with readyMutex held.
+  void UpdateReceive(Connection *connection, int &inFlight);
+  // Hands the received chunks of `connection` to onData, in order, and
+  // gives their buffers back to the kernel.
+  void Deliver(Connection *connection);
+#endif
+#else
+  std::condition_variable connectionsChanged;
+  void AcceptLoop(Listener *listener);
+  void ClientHandler(Connection *connection);
+#endif
 };
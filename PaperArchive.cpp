@@ -0,0 +1,539 @@
+#include "PaperArchive.h"
+
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ---------------------------------------------------------------------------
+// Record layout
+// ---------------------------------------------------------------------------
+//
+//   RecordHeader
+//   RecordStyle   x styleCount
+//   RecordElement x elementCount
+//   payload area: the text and bitmap bytes the elements point into
+//
+// padded to a multiple of 8 bytes. Structs are copied in and out with memcpy,
+// so a record needs no particular alignment in the mapping.
+
+static const uint32_t ARCHIVE_MAGIC = 0x4A504556; // "VEPJ"
+
+struct RecordHeader {
+    uint32_t magic;
+    uint32_t charSize;     // sizeof(wchar_t) where the record was written
+    uint64_t size;         // the whole record, header included
+    uint64_t id;
+    int64_t startedMs;     // since the epoch
+    int64_t endedMs;
+    int64_t bytes;
+    uint32_t endReason;
+    uint32_t styleCount;
+    uint64_t elementCount;
+};
+
+struct RecordStyle {
+    int32_t isRed, widthScale, heightScale, isReverse, isUpsideDown, isBold,
+        isRotated90, charSpacing, marginLeft, areaWidth, font, isUnderline,
+        align;
+};
+
+struct RecordElement {
+    uint8_t type;
+    uint8_t flags; // absolutePos, isColumnFormat, mergeableBand
+    uint8_t pageDir;
+    uint8_t reserved;
+    uint32_t style; // index into the record's styles
+    int32_t width, height, pageX, pageY;
+    uint64_t payload; // offset into the payload area
+    uint64_t payloadBytes;
+};
+
+static int64_t ToMs(std::chrono::system_clock::time_point t) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(t.time_since_epoch()).count();
+}
+
+static std::chrono::system_clock::time_point FromMs(int64_t ms) {
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::milliseconds(ms)));
+}
+
+static RecordStyle PackStyle(const ElementStyle &s) {
+    RecordStyle r;
+    r.isRed = s.isRed;
+    r.widthScale = s.widthScale;
+    r.heightScale = s.heightScale;
+    r.isReverse = s.isReverse;
+    r.isUpsideDown = s.isUpsideDown;
+    r.isBold = s.isBold;
+    r.isRotated90 = s.isRotated90;
+    r.charSpacing = s.charSpacing;
+    r.marginLeft = s.marginLeft;
+    r.areaWidth = s.areaWidth;
+    r.font = s.font;
+    r.isUnderline = s.isUnderline;
+    r.align = s.align;
+    return r;
+}
+
+static ElementStyle UnpackStyle(const RecordStyle &r) {
+    ElementStyle s;
+    s.isRed = r.isRed != 0;
+    s.widthScale = r.widthScale;
+    s.heightScale = r.heightScale;
+    s.isReverse = r.isReverse != 0;
+    s.isUpsideDown = r.isUpsideDown != 0;
+    s.isBold = r.isBold != 0;
+    s.isRotated90 = r.isRotated90 != 0;
+    s.charSpacing = r.charSpacing;
+    s.marginLeft = r.marginLeft;
+    s.areaWidth = r.areaWidth;
+    s.font = r.font;
+    s.isUnderline = r.isUnderline != 0;
+    s.align = r.align;
+    return s;
+}
+
+template <typename T> static void Put(std::vector<unsigned char> &out, const T &value) {
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(&value);
+    out.insert(out.end(), p, p + sizeof(T));
+}
+
+// Serializes `job`, whose elements are on `roll`, into `out`.
+static void BuildRecord(const PaperRoll &roll, const PrintJob &job,
+                        std::vector<unsigned char> &out) {
+    std::unordered_map<StyleId, uint32_t> styleIndex;
+    std::vector<RecordStyle> styles;
+    std::vector<RecordElement> elements;
+    std::vector<unsigned char> payload;
+    elements.reserve(job.elementCount);
+
+    for (size_t i = 0; i < job.elementCount; ++i) {
+        const PrinterElement &el = roll.elements.At(job.firstElement + i);
+        RecordElement r;
+        std::memset(&r, 0, sizeof(r));
+        r.type = el.type;
+        r.flags = (uint8_t)((el.absolutePos ? 1 : 0) | (el.isColumnFormat ? 2 : 0) |
+                            (el.mergeableBand ? 4 : 0));
+        r.pageDir = el.pageDir;
+        std::unordered_map<StyleId, uint32_t>::const_iterator it = styleIndex.find(el.style);
+        if (it == styleIndex.end()) {
+            it = styleIndex.insert(std::make_pair(el.style, (uint32_t)styles.size())).first;
+            styles.push_back(PackStyle(el.Style()));
+        }
+        r.style = it->second;
+        r.width = el.width;
+        r.height = el.height;
+        r.pageX = el.pageX;
+        r.pageY = el.pageY;
+        const unsigned char *data = nullptr;
+        if (el.type == ELEMENT_TEXT && el.text) {
+            data = reinterpret_cast<const unsigned char *>(el.text);
+            r.payloadBytes = el.TextLength() * sizeof(wchar_t);
+        } else if (el.type == ELEMENT_BITMAP && el.bitmap) {
+            data = el.bitmap->data();
+            r.payloadBytes = el.bitmap->size();
+        }
+        r.payload = payload.size();
+        if (r.payloadBytes) payload.insert(payload.end(), data, data + r.payloadBytes);
+        elements.push_back(r);
+    }
+
+    RecordHeader h;
+    std::memset(&h, 0, sizeof(h));
+    h.magic = ARCHIVE_MAGIC;
+    h.charSize = sizeof(wchar_t);
+    h.id = job.id;
+    h.startedMs = ToMs(job.started);
+    h.endedMs = ToMs(job.ended);
+    h.bytes = job.bytes;
+    h.endReason = (uint32_t)job.endReason;
+    h.styleCount = (uint32_t)styles.size();
+    h.elementCount = elements.size();
+    size_t size = sizeof(h) + styles.size() * sizeof(RecordStyle) +
+                  elements.size() * sizeof(RecordElement) + payload.size();
+    size = (size + 7) & ~(size_t)7;
+    h.size = size;
+
+    out.clear();
+    out.reserve(size);
+    Put(out, h);
+    for (size_t i = 0; i < styles.size(); ++i) Put(out, styles[i]);
+    for (size_t i = 0; i < elements.size(); ++i) Put(out, elements[i]);
+    out.insert(out.end(), payload.begin(), payload.end());
+    out.resize(size, 0);
+}
+
+// A header that can belong to a record of the file: right magic and character
+// width, and a size that fits what it claims to hold and the file.
+static bool HeaderValid(const RecordHeader &h, unsigned long long offset,
+                        unsigned long long fileSize) {
+    if (h.magic != ARCHIVE_MAGIC || h.charSize != sizeof(wchar_t)) return false;
+    if (h.size < sizeof(h) || h.size % 8 != 0 || h.size > fileSize - offset) return false;
+    unsigned long long fixed = (unsigned long long)h.styleCount * sizeof(RecordStyle);
+    if (fixed > h.size - sizeof(h)) return false;
+    return h.elementCount <= (h.size - sizeof(h) - fixed) / sizeof(RecordElement);
+}
+
+static void FillJob(const RecordHeader &h, PrintJob &out) {
+    out = PrintJob();
+    out.id = h.id;
+    out.started = FromMs(h.startedMs);
+    out.ended = FromMs(h.endedMs);
+    out.bytes = h.bytes;
+    out.firstElement = 0;
+    out.elementCount = (size_t)h.elementCount;
+    out.endReason = (JobEndReason)h.endReason;
+    out.memoryBytes = (size_t)h.size;
+}
+
+// ---------------------------------------------------------------------------
+// File access
+// ---------------------------------------------------------------------------
+
+#ifdef _WIN32
+static const HANDLE NO_FILE = INVALID_HANDLE_VALUE;
+
+static HANDLE OpenArchiveFile(const std::string &path) {
+    int n = MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, NULL, 0);
+    if (n <= 0) return NO_FILE;
+    std::wstring wide(n, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, &wide[0], n);
+    return CreateFileW(wide.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ,
+                       NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+}
+
+static void CloseFile(HANDLE file) { CloseHandle(file); }
+
+static unsigned long long FileSize(HANDLE file) {
+    LARGE_INTEGER size;
+    return GetFileSizeEx(file, &size) ? (unsigned long long)size.QuadPart : 0;
+}
+
+static bool ReadAt(HANDLE file, unsigned long long offset, void *dst, size_t length) {
+    unsigned char *p = static_cast<unsigned char *>(dst);
+    while (length > 0) {
+        OVERLAPPED ov = { 0 };
+        ov.Offset = (DWORD)offset;
+        ov.OffsetHigh = (DWORD)(offset >> 32);
+        DWORD chunk = length > (1u << 30) ? (1u << 30) : (DWORD)length;
+        DWORD done = 0;
+        if (!ReadFile(file, p, chunk, &done, &ov) || done == 0) return false;
+        p += done;
+        offset += done;
+        length -= done;
+    }
+    return true;
+}
+
+static bool WriteAt(HANDLE file, unsigned long long offset, const void *src, size_t length) {
+    const unsigned char *p = static_cast<const unsigned char *>(src);
+    while (length > 0) {
+        OVERLAPPED ov = { 0 };
+        ov.Offset = (DWORD)offset;
+        ov.OffsetHigh = (DWORD)(offset >> 32);
+        DWORD chunk = length > (1u << 30) ? (1u << 30) : (DWORD)length;
+        DWORD done = 0;
+        if (!WriteFile(file, p, chunk, &done, &ov) || done == 0) return false;
+        p += done;
+        offset += done;
+        length -= done;
+    }
+    return true;
+}
+
+static void Truncate(HANDLE file, unsigned long long size) {
+    LARGE_INTEGER pos;
+    pos.QuadPart = (LONGLONG)size;
+    if (SetFilePointerEx(file, pos, NULL, FILE_BEGIN)) SetEndOfFile(file);
+}
+
+// A read-only view of [offset, offset + length) of the file.
+class MappedRange {
+public:
+    MappedRange(HANDLE file, unsigned long long offset, size_t length)
+        : mapping(NULL), view(NULL), data(nullptr) {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        unsigned long long start = offset - offset % info.dwAllocationGranularity;
+        mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (!mapping) return;
+        view = MapViewOfFile(mapping, FILE_MAP_READ, (DWORD)(start >> 32), (DWORD)start,
+                             (SIZE_T)(offset - start + length));
+        if (view) data = static_cast<const unsigned char *>(view) + (offset - start);
+    }
+    ~MappedRange() {
+        if (view) UnmapViewOfFile(view);
+        if (mapping) CloseHandle(mapping);
+    }
+    const unsigned char *Data() const { return data; }
+
+private:
+    HANDLE mapping;
+    void *view;
+    const unsigned char *data;
+};
+#else
+static const int NO_FILE = -1;
+
+static int OpenArchiveFile(const std::string &path) {
+    return open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+}
+
+static void CloseFile(int file) { close(file); }
+
+static unsigned long long FileSize(int file) {
+    struct stat st;
+    return fstat(file, &st) == 0 ? (unsigned long long)st.st_size : 0;
+}
+
+static bool ReadAt(int file, unsigned long long offset, void *dst, size_t length) {
+    unsigned char *p = static_cast<unsigned char *>(dst);
+    while (length > 0) {
+        ssize_t done = pread(file, p, length, (off_t)offset);
+        if (done <= 0) return false;
+        p += done;
+        offset += done;
+        length -= done;
+    }
+    return true;
+}
+
+static bool WriteAt(int file, unsigned long long offset, const void *src, size_t length) {
+    const unsigned char *p = static_cast<const unsigned char *>(src);
+    while (length > 0) {
+        ssize_t done = pwrite(file, p, length, (off_t)offset);
+        if (done <= 0) return false;
+        p += done;
+        offset += done;
+        length -= done;
+    }
+    return true;
+}
+
+static void Truncate(int file, unsigned long long size) {
+    if (ftruncate(file, (off_t)size) != 0) {
+        // Left as it is: the torn record stays past the last indexed one
+        // and is written over by the next job.
+    }
+}
+
+// A read-only view of [offset, offset + length) of the file.
+class MappedRange {
+public:
+    MappedRange(int file, unsigned long long offset, size_t length)
+        : view(MAP_FAILED), viewLength(0), data(nullptr) {
+        unsigned long long page = (unsigned long long)sysconf(_SC_PAGESIZE);
+        unsigned long long start = offset - offset % page;
+        viewLength = (size_t)(offset - start) + length;
+        view = mmap(nullptr, viewLength, PROT_READ, MAP_SHARED, file, (off_t)start);
+        if (view != MAP_FAILED) data = static_cast<const unsigned char *>(view) + (offset - start);
+    }
+    ~MappedRange() {
+        if (view != MAP_FAILED) munmap(view, viewLength);
+    }
+    const unsigned char *Data() const { return data; }
+
+private:
+    void *view;
+    size_t viewLength;
+    const unsigned char *data;
+};
+#endif
+
+// ---------------------------------------------------------------------------
+// PaperArchive
+// ---------------------------------------------------------------------------
+
+PaperArchive::PaperArchive()
+    : file(NO_FILE), fileSize(0), open(false), stopping(false), writing(false) {}
+
+PaperArchive::~PaperArchive() {
+    Close();
+}
+
+bool PaperArchive::Open(const std::string &path) {
+    Close();
+    {
+        std::lock_guard<std::mutex> lock(fileMutex);
+        file = OpenArchiveFile(path);
+        if (file == NO_FILE) return false;
+        ScanFile();
+    }
+    std::lock_guard<std::mutex> lock(queueMutex);
+    open = true;
+    stopping = false;
+    return true;
+}
+
+void PaperArchive::Close() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (!open) return;
+        open = false;
+        stopping = true;
+    }
+    queueChanged.notify_all();
+    if (writer.joinable()) writer.join(); // after it has written the queue out
+    std::lock_guard<std::mutex> lock(fileMutex);
+    CloseFile(file);
+    file = NO_FILE;
+    fileSize = 0;
+    offsets.clear();
+}
+
+bool PaperArchive::IsOpen() {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    return open;
+}
+
+void PaperArchive::Add(const std::shared_ptr<const PaperRoll> &roll,
+                       const std::vector<PrintJob> &jobs) {
+    if (jobs.empty()) return;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (!open) return;
+        Batch batch;
+        batch.roll = roll;
+        batch.jobs = jobs;
+        queue.push_back(std::move(batch));
+        // Started by the first batch, so an archive that never gets one,
+        // like those of idle printers in a farm, costs no thread.
+        if (!writer.joinable()) writer = std::thread(&PaperArchive::WriterLoop, this);
+    }
+    queueChanged.notify_all();
+}
+
+void PaperArchive::Flush() {
+    std::unique_lock<std::mutex> lock(queueMutex);
+    queueChanged.wait(lock, [this] { return queue.empty() && !writing; });
+}
+
+void PaperArchive::WriterLoop() {
+    std::unique_lock<std::mutex> lock(queueMutex);
+    for (;;) {
+        queueChanged.wait(lock, [this] { return stopping || !queue.empty(); });
+        if (queue.empty()) break; // stopping, and nothing left to write
+        Batch batch = std::move(queue.front());
+        queue.pop_front();
+        writing = true;
+        lock.unlock();
+        Write(batch);
+        batch = Batch(); // the roll goes before the next wait, not after it
+        lock.lock();
+        writing = false;
+        queueChanged.notify_all();
+    }
+}
+
+void PaperArchive::Write(const Batch &batch) {
+    std::vector<unsigned char> record;
+    for (size_t i = 0; i < batch.jobs.size(); ++i) {
+        BuildRecord(*batch.roll, batch.jobs[i], record);
+        std::lock_guard<std::mutex> lock(fileMutex);
+        // A failed write leaves fileSize where it was, so the next record
+        // goes over whatever part of this one reached the disk.
+        if (WriteAt(file, fileSize, record.data(), record.size())) {
+            offsets.push_back(fileSize);
+            fileSize += record.size();
+        }
+    }
+}
+
+void PaperArchive::ScanFile() {
+    offsets.clear();
+    unsigned long long size = FileSize(file);
+    unsigned long long offset = 0;
+    RecordHeader h;
+    while (size - offset >= sizeof(h) && ReadAt(file, offset, &h, sizeof(h)) &&
+           HeaderValid(h, offset, size)) {
+        offsets.push_back(offset);
+        offset += h.size;
+    }
+    if (offset < size) Truncate(file, offset);
+    fileSize = offset;
+}
+
+size_t PaperArchive::GetJobCount() {
+    std::lock_guard<std::mutex> lock(fileMutex);
+    return offsets.size();
+}
+
+bool PaperArchive::GetJob(size_t n, PrintJob &out) {
+    std::lock_guard<std::mutex> lock(fileMutex);
+    if (n >= offsets.size()) return false;
+    RecordHeader h;
+    if (!ReadAt(file, offsets[n], &h, sizeof(h)) || !HeaderValid(h, offsets[n], fileSize)) {
+        return false;
+    }
+    FillJob(h, out);
+    return true;
+}
+
+ElementList PaperArchive::GetJobElements(size_t n) {
+    ElementList result;
+    std::lock_guard<std::mutex> lock(fileMutex);
+    if (n >= offsets.size()) return result;
+    RecordHeader h;
+    if (!ReadAt(file, offsets[n], &h, sizeof(h)) || !HeaderValid(h, offsets[n], fileSize)) {
+        return result;
+    }
+    MappedRange range(file, offsets[n], (size_t)h.size);
+    const unsigned char *record = range.Data();
+    if (!record) return result;
+
+    const unsigned char *styleData = record + sizeof(h);
+    const unsigned char *elementData = styleData + h.styleCount * sizeof(RecordStyle);
+    const unsigned char *payload = elementData + h.elementCount * sizeof(RecordElement);
+    unsigned long long payloadSize = h.size - (unsigned long long)(payload - record);
+
+    std::vector<StyleId> styles(h.styleCount);
+    for (size_t i = 0; i < styles.size(); ++i) {
+        RecordStyle s;
+        std::memcpy(&s, styleData + i * sizeof(s), sizeof(s));
+        styles[i] = StyleTable::Instance().Intern(UnpackStyle(s));
+    }
+
+    for (size_t i = 0; i < h.elementCount; ++i) {
+        RecordElement r;
+        std::memcpy(&r, elementData + i * sizeof(r), sizeof(r));
+        if (r.type > ELEMENT_PAGE_END || r.style >= styles.size() ||
+            r.payload > payloadSize || r.payloadBytes > payloadSize - r.payload) {
+            return ElementList(); // damaged: all of the job or nothing
+        }
+        PrinterElement el;
+        el.type = (ElementType)r.type;
+        el.absolutePos = (r.flags & 1) != 0;
+        el.isColumnFormat = (r.flags & 2) != 0;
+        el.mergeableBand = (r.flags & 4) != 0;
+        el.pageDir = r.pageDir & 3;
+        el.style = styles[r.style];
+        el.width = r.width;
+        el.height = r.height;
+        el.pageX = r.pageX;
+        el.pageY = r.pageY;
+        if (el.type == ELEMENT_TEXT) {
+            if (r.width < 0 || r.payloadBytes != (uint64_t)r.width * sizeof(wchar_t)) {
+                return ElementList();
+            }
+            // Copied out through a wchar_t buffer: the payload need not be
+            // aligned for one in the mapping.
+            std::wstring text((size_t)r.width, L'\0');
+            if (r.width) std::memcpy(&text[0], payload + r.payload, (size_t)r.payloadBytes);
+            el.text = result.AddText(text);
+        } else if (el.type == ELEMENT_BITMAP) {
+            const unsigned char *bytes = payload + r.payload;
+            el.bitmap = result.AddBitmap(
+                std::vector<unsigned char>(bytes, bytes + r.payloadBytes));
+        }
+        result.push_back(el);
+    }
+    return result;
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "VirtualPrinter.h"
+
+// Receipts that have left the paper, kept on disk instead of in memory.
+//
+// The archive is one file that only ever grows, with one record per job: the
+// job's PrintJob fields, the styles it uses, its elements, and their text and
+// bitmaps. All that stays in memory is the offset of each record. Reading a
+// job maps that record's pages only, copies them into an ElementList and
+// unmaps them again, so memory use stays flat however large the file grows;
+// the OS page cache decides what stays resident.
+//
+// Records use the byte order and wchar_t width of the machine that wrote
+// them, and are meant to be read back there. Opening an existing file scans
+// the record headers to rebuild the index and cuts off a record torn by a
+// crash.
+//
+// Jobs are written on the archive's own thread, so a printer handing over a
+// batch of evicted jobs never waits for the disk.
+class PaperArchive {
+public:
+  PaperArchive();
+  ~PaperArchive(); // writes what is still queued, then closes
+
+  PaperArchive(const PaperArchive &) = delete;
+  PaperArchive &operator=(const PaperArchive &) = delete;
+
+  // Opens `path` (UTF-8), creating it if missing, and appends to it from
+  // then on. Closes the file that was open before, if any.
+  bool Open(const std::string &path);
+  void Close();
+  bool IsOpen();
+
+  // Queues `jobs`, whose elements are on `roll`, to be written. The roll is
+  // held until they are on disk. Ignored when no file is open.
+  void Add(const std::shared_ptr<const PaperRoll> &roll,
+           const std::vector<PrintJob> &jobs);
+  // Returns once everything queued so far has been written.
+  void Flush();
+
+  // Jobs on disk, oldest first. An archived job's firstElement is 0 and its
+  // memoryBytes is the size of its record.
+  size_t GetJobCount();
+  bool GetJob(size_t n, PrintJob &out);
+  // Reads the job back, or returns an empty list if its record is damaged.
+  ElementList GetJobElements(size_t n);
+
+private:
+  struct Batch {
+    std::shared_ptr<const PaperRoll> roll;
+    std::vector<PrintJob> jobs;
+  };
+
+  // Guards the file and the index. Held by the writer only while it appends,
+  // not while it serializes.
+  std::mutex fileMutex;
+#ifdef _WIN32
+  HANDLE file;
+#else
+  int file;
+#endif
+  unsigned long long fileSize;
+  std::vector<unsigned long long> offsets; // one per record, ascending
+
+  // Guards the queue and the writer's state.
+  std::mutex queueMutex;
+  std::condition_variable queueChanged;
+  std::deque<Batch> queue;
+  bool open;
+  bool stopping;
+  bool writing; // the writer holds a batch it took off the queue
+  std::thread writer;
+
+  void WriterLoop();
+  void Write(const Batch &batch);
+  // Rebuilds `offsets` from the file and truncates a torn last record.
+  void ScanFile();
+};
@@ -0,0 +1,1013 @@
+#include "PaperRaster.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+#include "FontA12x24.h"
+#include "FontB10x24.h"
+
+void PaperImage::Reset(int newWidth, int newTop, int newHeight, bool twoColour) {
+    width = newWidth > 0 ? newWidth : 0;
+    top = newTop;
+    height = newHeight > 0 ? newHeight : 0;
+    stride = ((width + 31) / 32) * 4;
+    black.assign((size_t)stride * height, 0);
+    if (twoColour) red.assign((size_t)stride * height, 0);
+    else red.clear();
+}
+
+// ---------------------------------------------------------------------------
+// Measuring
+//
+// Text is laid out on the character grid: every ESC/POS horizontal coordinate
+// is in dots and maps through the Font A cell width, and every glyph takes the
+// same cell, so a line's width is arithmetic rather than a question for a font
+// engine.
+// ---------------------------------------------------------------------------
+
+// a * b / c, rounded to the nearest and halves away from zero as Windows'
+// MulDiv() does. The viewer has always scaled with that, and a pixel more or
+// less per cell moves everything right of it.
+static int ScaleInt(int a, int b, int c) {
+    long long n = (long long)a * b;
+    return (int)((n >= 0 ? n + c / 2 : n - c / 2) / c);
+}
+
+// The dot cell of each font ESC M n can select, and the table its dots come
+// from. Font A (12x24) and Font B (10x24) each have their own matrix; Font C
+// has no table of its own, so it is Font A's shrunk to the 8x16 cell - which
+// is the same cell the parser counts columns with.
+struct FontCell {
+    const unsigned short* (*glyph)(wchar_t); // the ROM table
+    int srcW, srcH;                          // the cell that table is drawn on
+    int cellW, cellH;                        // the cell on the paper, in dots
+};
+
+static FontCell FontCellFor(int font) {
+    if (font == FONT_B) {
+        return { FontBGlyph, FONT_B_WIDTH, FONT_B_HEIGHT, FONT_B_WIDTH, FONT_B_HEIGHT };
+    }
+    if (font == FONT_C) {
+        return { FontAGlyph, FONT_A_WIDTH, FONT_A_HEIGHT, 8, 16 };
+    }
+    return { FontAGlyph, FONT_A_WIDTH, FONT_A_HEIGHT, FONT_A_WIDTH, FONT_A_HEIGHT };
+}
+
+// Height in pixels of one text element, i.e. the selected font scaled by the
+// vertical multiplier from ESC ! / GS !. The font size is the height of the
+// Font A cell, so the other fonts follow from the ratio of the cells: Font B
+// is as tall as Font A, Font C two thirds of it.
+static int ElementFontHeight(const PrinterElement& el, int fontSize) {
+    int baseHeight = ScaleInt(fontSize, FontCellFor(el.Style().font).cellH, FONT_A_HEIGHT);
+    if (baseHeight < 1) baseHeight = 1;
+    return baseHeight * el.Style().heightScale;
+}
+
+// Width of the Font A cell for a given font size: at 24 one dot is one pixel
+// and 48 columns come to the 576 pixels an 80 mm receipt prints at 203 dpi.
+static int CellWidthForSize(int fontSize) {
+    int w = ScaleInt(fontSize, FONT_A_WIDTH, FONT_A_HEIGHT);
+    return w < 1 ? 1 : w;
+}
+
+// Converts an ESC/POS horizontal coordinate (dots) into pixels.
+static int DotsToPixels(int dots, int charWidth) {
+    return ScaleInt(dots, charWidth, DOTS_PER_CHAR);
+}
+
+// Natural (unscaled) cell width of an element's font, in pixels: the Font A
+// cell narrowed in the ratio of the two cells, so Font B comes out 10 dots
+// wide where Font A is 12 - which is what puts 57 columns on the line.
+static int ElementNaturalWidth(const PrinterElement& el, int charWidth) {
+    int w = ScaleInt(charWidth, FontCellFor(el.Style().font).cellW, FONT_A_WIDTH);
+    return w < 1 ? 1 : w;
+}
+
+// Width in pixels of one character cell, the horizontal multiplier from
+// ESC ! / GS ! included.
+static int ElementCellWidth(const PrinterElement& el, int charWidth) {
+    return ElementNaturalWidth(el, charWidth) * el.Style().widthScale;
+}
+
+// Width of one cell of an ESC V rotated run: a glyph turned 90 degrees is as
+// wide as the font is tall.
+static int RotatedCellWidth(const PrinterElement& el, int fontSize, int charWidth) {
+    int cell = ElementFontHeight(el, fontSize) + DotsToPixels(el.Style().charSpacing, charWidth);
+    return cell < 1 ? 1 : cell;
+}
+
+// Distance from one character to the next, ESC SP spacing included.
+static int ElementAdvance(const PrinterElement& el, int fontSize, int charWidth) {
+    if (el.Style().isRotated90) return RotatedCellWidth(el, fontSize, charWidth);
+    return ElementCellWidth(el, charWidth) + DotsToPixels(el.Style().charSpacing, charWidth);
+}
+
+static int ElementTextWidth(const PrinterElement& el, int fontSize, int charWidth) {
+    return ElementAdvance(el, fontSize, charWidth) * (int)el.TextLength();
+}
+
+// Total pixel width of the run of TEXT elements starting at startIdx, up to the
+// next line break (NEWLINE / CUT / BITMAP) or the end. This is what ESC a
+// centres or right-aligns.
+static int MeasureTextLineWidth(const PrinterElement* elements, size_t count, size_t startIdx,
+                                int fontSize, int charWidth) {
+    int total = 0;
+    for (size_t i = startIdx; i < count; ++i) {
+        if (elements[i].type != ELEMENT_TEXT) break;
+        total += ElementTextWidth(elements[i], fontSize, charWidth);
+    }
+    return total;
+}
+
+// Tallest element in the same run.
+static int MeasureTextLineHeight(const PrinterElement* elements, size_t count, size_t startIdx,
+                                 int fontSize) {
+    int maxHeight = 0;
+    for (size_t i = startIdx; i < count; ++i) {
+        if (elements[i].type != ELEMENT_TEXT) break;
+        int h = ElementFontHeight(elements[i], fontSize);
+        if (h > maxHeight) maxHeight = h;
+    }
+    return maxHeight;
+}
+
+static bool LineHasUpsideDown(const PrinterElement* elements, size_t count, size_t startIdx) {
+    for (size_t i = startIdx; i < count; ++i) {
+        if (elements[i].type != ELEMENT_TEXT) break;
+        if (elements[i].Style().isUpsideDown) return true;
+    }
+    return false;
+}
+
+// Pixel size of a text or bitmap element in page mode. Bitmaps are scaled like
+// every other page coordinate so that a dot keeps the same size everywhere on
+// the page.
+static void MeasureElementBox(const PrinterElement& el, int fontSize,
+                              int charWidth, int* outW, int* outH) {
+    if (el.type == ELEMENT_BITMAP) {
+        *outW = DotsToPixels(el.width, charWidth);
+        *outH = DotsToPixels(el.height, charWidth);
+        return;
+    }
+    *outW = ElementTextWidth(el, fontSize, charWidth);
+    *outH = ElementFontHeight(el, fontSize);
+}
+
+// How much of the paper a page needs, in pixels, when ESC W did not state a
+// height. Directions 1 and 3 print along the paper's vertical axis, so there it
+// is the text flow that decides how far down the page reaches.
+static int MeasurePageContentHeight(const PrinterElement* elements, size_t count,
+                                    size_t startIdx, int fontSize, int charWidth) {
+    int needed = 0;
+    for (size_t i = startIdx; i < count; ++i) {
+        const PrinterElement& el = elements[i];
+        if (el.type == ELEMENT_PAGE_END) break;
+        if (el.type != ELEMENT_TEXT && el.type != ELEMENT_BITMAP) continue;
+        int w = 0, h = 0;
+        MeasureElementBox(el, fontSize, charWidth, &w, &h);
+        int extent = (el.pageDir == 1 || el.pageDir == 3)
+                         ? DotsToPixels(el.pageX, charWidth) + w
+                         : DotsToPixels(el.pageY, charWidth) + h;
+        if (extent > needed) needed = extent;
+    }
+    return needed;
+}
+
+// ---------------------------------------------------------------------------
+// The dot matrix fonts
+//
+// A thermal printer has no outline font: it strikes a dot cell held in ROM,
+// 12x24 for Font A and 10x24 for Font B. Drawing from the same kind of table is
+// what keeps a character on the dot grid every ESC/POS coordinate is expressed
+// in, so 48 columns come out 48 cells wide instead of drifting by a fraction of
+// a pixel per character.
+// ---------------------------------------------------------------------------
+
+// One dot of a glyph, with ESC E / ESC G double-strike folded in: the printer
+// strikes the row a second time one dot to the right, which is what thickens
+// the stems.
+static bool GlyphDot(const FontCell& cell, const unsigned short* glyph,
+                     int x, int y, bool bold) {
+    if (!glyph || x < 0 || x >= cell.srcW || y < 0 || y >= cell.srcH) return false;
+    unsigned int row = glyph[y];
+    if (bold) row |= row >> 1;
+    return ((row >> (cell.srcW - 1 - x)) & 1) != 0;
+}
+
+// A packed 1 bit per pixel picture, a set bit being ink, with rows of
+// (w + 7) / 8 bytes.
+struct Bits {
+    std::vector<unsigned char> data;
+    int w = 0, h = 0, stride = 0;
+};
+
+// ORs the first `w` bits of `src` into `dst` from bit `x` on, whole bytes at a
+// time shifted onto the destination's byte grid. `dst` must hold them.
+static void InkRow(unsigned char* dst, int x, const unsigned char* src, int w) {
+    int at = x / 8, shift = x % 8;
+    int bytes = (w + 7) / 8;
+    for (int i = 0; i < bytes; ++i) {
+        unsigned char b = src[i];
+        if (i == bytes - 1 && (w % 8)) b &= (unsigned char)(0xFF << (8 - w % 8));
+        if (!b) continue;
+        dst[at + i] |= (unsigned char)(b >> shift);
+        unsigned char spill = (unsigned char)(b << (8 - shift));
+        if (shift && spill) dst[at + i + 1] |= spill;
+    }
+}
+
+// What a character looks like on the paper: its glyph scaled to the cell,
+// and everything the style does to it. Two characters with the same key are
+// drawn dot for dot the same.
+struct GlyphKey {
+    int font;
+    wchar_t code;
+    int advance, cellW, height; // the box, and the part of it the glyph fills
+    bool bold, underline, reverse, rotated;
+
+    bool operator==(const GlyphKey& o) const {
+        return font == o.font && code == o.code && advance == o.advance &&
+               cellW == o.cellW && height == o.height && bold == o.bold &&
+               underline == o.underline && reverse == o.reverse && rotated == o.rotated;
+    }
+};
+
+struct GlyphKeyHash {
+    size_t operator()(const GlyphKey& k) const {
+        size_t h = (size_t)k.code * 31 + (size_t)k.font;
+        h = h * 31 + (size_t)k.advance;
+        h = h * 31 + (size_t)k.cellW;
+        h = h * 31 + (size_t)k.height;
+        return h * 16 + (k.bold | k.underline << 1 | k.reverse << 2 | k.rotated << 3);
+    }
+};
+
+// Packs one character, `key.advance` pixels wide and `key.height` tall.
+static void BuildGlyph(const GlyphKey& key, Bits* out) {
+    int stride = (key.advance + 7) / 8;
+    out->data.assign((size_t)stride * key.height, 0);
+    out->w = key.advance;
+    out->h = key.height;
+    out->stride = stride;
+
+    FontCell cell = FontCellFor(key.font);
+    const unsigned short* glyph = cell.glyph(key.code);
+    // ESC - underlines the whole cell, so the rule goes on the bottom dot row
+    // rather than immediately under the glyph: descenders reach row 22.
+    const int underlineRow = cell.srcH - 1;
+
+    for (int dy = 0; dy < key.height; ++dy) {
+        unsigned char* row = &out->data[(size_t)dy * stride];
+        for (int dx = 0; dx < key.advance; ++dx) {
+            bool ink = false;
+            if (key.rotated) {
+                // ESC V turns each glyph 90 degrees clockwise while the line
+                // still runs left to right, so the glyph's bottom edge ends up
+                // on the left and its left edge on top.
+                if (dx < key.cellW) {
+                    int sy = cell.srcH - 1 - dx * cell.srcH / key.cellW;
+                    int sx = dy * cell.srcW / key.height;
+                    ink = (key.underline && sy == underlineRow) ||
+                          GlyphDot(cell, glyph, sx, sy, key.bold);
+                }
+            } else {
+                int sy = dy * cell.srcH / key.height;
+                ink = key.underline && sy == underlineRow;
+                if (!ink && dx < key.cellW) {
+                    ink = GlyphDot(cell, glyph, dx * cell.srcW / key.cellW, sy, key.bold);
+                }
+            }
+            // GS B swaps ink and paper over the whole cell.
+            if (ink != key.reverse) row[dx / 8] |= (unsigned char)(0x80 >> (dx % 8));
+        }
+    }
+}
+
+// Characters already packed, so that text is drawn by copying rows rather
+// than by scaling every dot of every glyph again. A receipt uses a few
+// hundred of them; should a stream of odd sizes fill the cache, it starts
+// over. Each thread has its own, so rendering on several needs no lock.
+struct GlyphCache {
+    static const size_t kMaxBytes = 4 << 20;
+    std::unordered_map<GlyphKey, Bits, GlyphKeyHash> glyphs;
+    size_t bytes = 0;
+
+    const Bits& Get(const GlyphKey& key) {
+        std::unordered_map<GlyphKey, Bits, GlyphKeyHash>::iterator it = glyphs.find(key);
+        if (it != glyphs.end()) return it->second;
+        if (bytes > kMaxBytes) {
+            glyphs.clear();
+            bytes = 0;
+        }
+        Bits& bits = glyphs[key];
+        BuildGlyph(key, &bits);
+        bytes += bits.data.size();
+        return bits;
+    }
+};
+
+static thread_local GlyphCache glyphCache;
+
+// Packs a text element into a picture at its final size.
+static void BuildTextBitmap(const PrinterElement& el, int fontSize, int charWidth, Bits* out) {
+    out->w = out->h = 0;
+    const ElementStyle& style = el.Style();
+    int count = (int)el.TextLength();
+    GlyphKey key;
+    key.font = style.font;
+    key.code = 0;
+    key.advance = ElementAdvance(el, fontSize, charWidth);
+    // Turned 90 degrees, a glyph is as wide as the cell is tall and vice versa.
+    key.cellW = style.isRotated90 ? ElementFontHeight(el, fontSize)
+                                  : ElementCellWidth(el, charWidth);
+    key.height = style.isRotated90 ? ElementCellWidth(el, charWidth)
+                                   : ElementFontHeight(el, fontSize);
+    key.bold = style.isBold;
+    key.underline = style.isUnderline;
+    key.reverse = style.isReverse;
+    key.rotated = style.isRotated90;
+    int width = key.advance * count;
+    if (count < 1 || width < 1 || key.height < 1 || key.cellW < 1) return;
+
+    int stride = (width + 7) / 8;
+    out->data.assign((size_t)stride * key.height, 0);
+
+    for (int i = 0; i < count; ++i) {
+        key.code = el.text[i];
+        const Bits& glyph = glyphCache.Get(key);
+        int originX = i * key.advance;
+        for (int dy = 0; dy < key.height; ++dy) {
+            InkRow(&out->data[(size_t)dy * stride], originX,
+                   &glyph.data[(size_t)dy * glyph.stride], glyph.w);
+        }
+    }
+
+    out->w = width;
+    out->h = key.height;
+    out->stride = stride;
+}
+
+// Row-major picture of a bitmap element. GS * data arrives column by column,
+// x bytes across and y down, each byte 8 vertical dots with the top one in
+// the high bit.
+static void BuildElementBitmap(const PrinterElement& el, Bits* out) {
+    out->w = out->h = 0;
+    int w = el.width, h = el.height;
+    if (w <= 0 || h <= 0 || !el.bitmap) return;
+    int stride = (w + 7) / 8;
+    out->data.assign((size_t)stride * h, 0);
+    const std::vector<unsigned char>& src = *el.bitmap;
+
+    if (el.isColumnFormat) {
+        int yBytes = h / 8;
+        int columns = (w / 8) * 8;
+        for (int col = 0; col < columns; col++) {
+            for (int vB = 0; vB < yBytes; vB++) {
+                size_t srcIdx = (size_t)col * yBytes + vB;
+                if (srcIdx >= src.size()) break;
+                unsigned char b = src[srcIdx];
+                for (int bit = 0; bit < 8; bit++) {
+                    if (!((b >> (7 - bit)) & 1)) continue;
+                    int row = vB * 8 + bit;
+                    out->data[(size_t)row * stride + col / 8] |= (unsigned char)(0x80 >> (col % 8));
+                }
+            }
+        }
+    } else {
+        size_t n = src.size() < out->data.size() ? src.size() : out->data.size();
+        for (size_t i = 0; i < n; ++i) out->data[i] = src[i];
+    }
+
+    out->w = w;
+    out->h = h;
+    out->stride = stride;
+}
+
+// ---------------------------------------------------------------------------
+// Drawing
+//
+// Ink only ever adds: what is drawn over something already on the paper lets
+// it show through, as a second strike on a real printer would.
+// ---------------------------------------------------------------------------
+
+struct Canvas {
+    PaperImage* image; // null while only laying out
+    bool twoColour;
+
+    unsigned char* Row(int y, bool red) {
+        std::vector<unsigned char>& plane = red && twoColour ? image->red : image->black;
+        return &plane[(size_t)(y - image->top) * image->stride];
+    }
+    bool HasRow(int y) const {
+        return image && y >= image->top && y < image->top + image->height;
+    }
+    // Whether anything of rows [y, y + h) is to be drawn.
+    bool Shows(int y, int h) const {
+        return image && y + h > image->top && y < image->top + image->height;
+    }
+
+    void Dot(int x, int y, bool red) {
+        if (!HasRow(y) || x < 0 || x >= image->width) return;
+        Row(y, red)[x / 8] |= (unsigned char)(0x80 >> (x % 8));
+    }
+
+    // Inks the set bits of `bits` with its top-left corner at (x, y).
+    void Blit(const Bits& bits, int x, int y, bool red) {
+        for (int r = 0; r < bits.h; ++r) {
+            if (!HasRow(y + r)) continue;
+            const unsigned char* src = &bits.data[(size_t)r * bits.stride];
+            unsigned char* dst = Row(y + r, red);
+            if (x >= 0 && x + bits.w <= image->width) {
+                InkRow(dst, x, src, bits.w);
+                continue;
+            }
+            for (int c = 0; c < bits.w; ++c) {
+                int px = x + c;
+                if (px < 0 || px >= image->width) continue;
+                if ((src[c / 8] >> (7 - c % 8)) & 1) dst[px / 8] |= (unsigned char)(0x80 >> (px % 8));
+            }
+        }
+    }
+
+    // Inks the set bits of `bits`, turned 180 degrees, into the box at (x, y).
+    void BlitTurned(const Bits& bits, int x, int y, bool red) {
+        for (int r = 0; r < bits.h; ++r) {
+            int py = y + bits.h - 1 - r;
+            if (!HasRow(py)) continue;
+            const unsigned char* src = &bits.data[(size_t)r * bits.stride];
+            for (int c = 0; c < bits.w; ++c) {
+                if ((src[c / 8] >> (7 - c % 8)) & 1) Dot(x + bits.w - 1 - c, py, red);
+            }
+        }
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Page mode (ESC L)
+//
+// Elements between ELEMENT_PAGE_BEGIN and ELEMENT_PAGE_END do not flow: each
+// one carries the position it was printed at inside the print area, in the
+// coordinate system of the print direction selected by ESC T. Placing them is
+// a matter of mapping those page coordinates onto the paper, which for all
+// four directions is a quarter turn or two and a shift - including the glyph
+// rotation the printer applies to directions 1 to 3.
+// ---------------------------------------------------------------------------
+
+struct PageBox {
+    int left, top, w, h; // on the paper, in pixels
+    int dir;             // ESC T of the element being placed
+
+    // Inks page-local pixel (x, y), x along the text flow and y across the
+    // lines. The page clips what falls outside it, as a real printer does.
+    void Dot(Canvas& canvas, int x, int y, bool red) const {
+        int px, py;
+        switch (dir) {
+        case 1: px = left + y;         py = top + h - 1 - x; break; // bottom to top
+        case 2: px = left + w - 1 - x; py = top + h - 1 - y; break; // right to left
+        case 3: px = left + w - 1 - y; py = top + x;         break; // top to bottom
+        default: px = left + x;        py = top + y;         break; // left to right
+        }
+        if (px < left || px >= left + w || py < top || py >= top + h) return;
+        canvas.Dot(px, py, red);
+    }
+
+    // Inks `bits` stretched to destW x destH with its corner at (x, y).
+    void Blit(Canvas& canvas, const Bits& bits, int x, int y,
+              int destW, int destH, bool red) const {
+        if (bits.w <= 0 || bits.h <= 0) return;
+        for (int dy = 0; dy < destH; ++dy) {
+            const unsigned char* src = &bits.data[(size_t)(dy * bits.h / destH) * bits.stride];
+            for (int dx = 0; dx < destW; ++dx) {
+                int sx = dx * bits.w / destW;
+                if ((src[sx / 8] >> (7 - sx % 8)) & 1) Dot(canvas, x + dx, y + dy, red);
+            }
+        }
+    }
+};
+
+// ---------------------------------------------------------------------------
+// Layout
+// ---------------------------------------------------------------------------
+
+// Where the layout stands between two elements.
+struct Pen {
+    int y;             // top of the current line (or page)
+    int x;             // where the next text goes
+    int lineMaxHeight; // tallest thing on the line so far
+    bool atLineStart;
+    bool inPage;
+    PageBox page;
+};
+
+// Lays elements out one at a time and, given a canvas, draws them.
+struct Typesetter {
+    const PrinterElement* elements;
+    size_t count;
+    int fontSize, charWidth, leftMargin, paperWidth, width, lineHeight;
+    bool cutMarks, twoColour;
+    Canvas canvas;
+    Bits bits;
+    // Rows the ink of what was laid out since ResetInk() covers.
+    int inkTop, inkBottom;
+
+    Typesetter(const PrinterElement* elements_, size_t count_,
+               const RasterOptions& options, PaperImage* image)
+        : elements(elements_), count(count_) {
+        fontSize = options.fontSize > 0 ? options.fontSize : 24;
+        charWidth = CellWidthForSize(fontSize);
+        leftMargin = options.margin;
+        // Justification (ESC a) centres within the paper unless GS W narrows
+        // the print area.
+        paperWidth = options.columns > 0      ? options.columns * charWidth
+                     : options.paperWidth > 0 ? options.paperWidth
+                                              : 48 * charWidth;
+        width = paperWidth + 2 * leftMargin;
+        lineHeight = fontSize + 4; // of an empty line
+        cutMarks = options.cutMarks;
+        twoColour = options.twoColour;
+        canvas.image = image;
+        canvas.twoColour = twoColour;
+        ResetInk(0);
+    }
+
+    Pen Start() const {
+        Pen pen = {};
+        pen.y = leftMargin;
+        pen.x = leftMargin;
+        pen.lineMaxHeight = lineHeight;
+        pen.atLineStart = true;
+        return pen;
+    }
+
+    void ResetInk(int y) { inkTop = inkBottom = y; }
+    void Ink(int top, int bottom) {
+        if (inkTop == inkBottom) {
+            inkTop = top;
+            inkBottom = bottom;
+            return;
+        }
+        if (top < inkTop) inkTop = top;
+        if (bottom > inkBottom) inkBottom = bottom;
+    }
+
+    // Left edge of the printable area for an element, honouring GS L.
+    int BaseX(const PrinterElement& el) const {
+        return leftMargin + DotsToPixels(el.Style().marginLeft, charWidth);
+    }
+
+    // Width of the printable area: GS W if set, else the rest of the paper.
+    int AreaWidth(const PrinterElement& el) const {
+        if (el.Style().areaWidth > 0) return DotsToPixels(el.Style().areaWidth, charWidth);
+        return leftMargin + paperWidth - BaseX(el);
+    }
+
+    int AlignStartX(int contentWidth, const PrinterElement& el) const {
+        int base = BaseX(el);
+        int areaW = AreaWidth(el);
+        int startX = base;
+        if (el.Style().align == 1) startX = base + (areaW - contentWidth) / 2;
+        else if (el.Style().align == 2) startX = base + areaW - contentWidth;
+        if (startX < base) startX = base;
+        return startX;
+    }
+
+    // Whether, after an element, the paper is at the start of a line whose
+    // layout depends on nothing before it but the pen.
+    static bool LineStarts(const PrinterElement& el, const Pen& pen) {
+        if (pen.inPage || !pen.atLineStart) return false;
+        switch (el.type) {
+        case ELEMENT_NEWLINE:
+        case ELEMENT_FEED:
+        case ELEMENT_CUT:
+        case ELEMENT_BITMAP:
+        case ELEMENT_PAGE_END:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // Lays out element `idx` and returns the index of the next one: an
+    // upside-down line is laid out as a whole.
+    size_t Step(size_t idx, Pen& pen);
+};
+
+size_t Typesetter::Step(size_t idx, Pen& pen) {
+    const PrinterElement& el = elements[idx];
+
+    if (el.type == ELEMENT_PAGE_BEGIN) {
+        if (!pen.atLineStart) {
+            pen.y += pen.lineMaxHeight + 4;
+            pen.lineMaxHeight = lineHeight;
+        }
+        pen.x = leftMargin;
+        pen.atLineStart = true;
+
+        // One scale on both axes, so a page turned by ESC T keeps its shape;
+        // the horizontal one is used since text is laid out on the character
+        // grid.
+        PageBox& page = pen.page;
+        page.left = leftMargin + DotsToPixels(el.pageX, charWidth);
+        page.top = pen.y + DotsToPixels(el.pageY, charWidth);
+        page.w = DotsToPixels(el.width, charWidth);
+        page.h = DotsToPixels(el.height, charWidth);
+        if (page.w <= 0) page.w = leftMargin + paperWidth - page.left;
+        if (page.h <= 0) {
+            // ESC W never ran, so there is no stated page height: take only
+            // as much paper as the content needs.
+            page.h = MeasurePageContentHeight(elements, count, idx + 1, fontSize, charWidth);
+        }
+        if (page.w < 1) page.w = 1;
+        if (page.h < 1) page.h = 1;
+        pen.inPage = true;
+        Ink(page.top, page.top + page.h);
+        return idx + 1;
+    }
+
+    if (el.type == ELEMENT_PAGE_END) {
+        // The printer feeds the whole print area, whether it was filled or
+        // not, so the next line starts below the page.
+        pen.y = pen.page.top + pen.page.h;
+        pen.inPage = false;
+        pen.x = leftMargin;
+        pen.atLineStart = true;
+        pen.lineMaxHeight = lineHeight;
+        return idx + 1;
+    }
+
+    if (pen.inPage) {
+        if (el.type != ELEMENT_TEXT && el.type != ELEMENT_BITMAP) return idx + 1;
+        PageBox& page = pen.page;
+        if (!canvas.Shows(page.top, page.h)) return idx + 1;
+
+        page.dir = el.pageDir;
+        int localX = DotsToPixels(el.pageX, charWidth);
+        int localY = DotsToPixels(el.pageY, charWidth);
+        if (el.type == ELEMENT_TEXT) {
+            BuildTextBitmap(el, fontSize, charWidth, &bits);
+            page.Blit(canvas, bits, localX, localY, bits.w, bits.h, el.Style().isRed);
+        } else {
+            BuildElementBitmap(el, &bits);
+            page.Blit(canvas, bits, localX, localY, DotsToPixels(el.width, charWidth),
+                      DotsToPixels(el.height, charWidth), false);
+        }
+        return idx + 1;
+    }
+
+    switch (el.type) {
+    case ELEMENT_TEXT: {
+        // At the first text segment of a line, offset the start position for
+        // center/right justification based on the whole line width.
+        if (pen.atLineStart) {
+            int lineWidth = MeasureTextLineWidth(elements, count, idx, fontSize, charWidth);
+            pen.x = AlignStartX(lineWidth, el);
+            pen.atLineStart = false;
+
+            // ESC {: the printer turns the whole line 180 degrees, so render
+            // it apart and ink it turned. Rotating per line rather than per
+            // segment is what puts the segments back in the order a real
+            // printer produces.
+            int textHeight = MeasureTextLineHeight(elements, count, idx, fontSize);
+            if (LineHasUpsideDown(elements, count, idx) && lineWidth > 0 && textHeight > 0) {
+                size_t j = idx;
+                if (canvas.Shows(pen.y, textHeight)) {
+                    PaperImage line;
+                    line.Reset(lineWidth, 0, textHeight, twoColour);
+                    Canvas lineCanvas = { &line, twoColour };
+                    int offscreenX = 0;
+                    for (; j < count && elements[j].type == ELEMENT_TEXT; ++j) {
+                        BuildTextBitmap(elements[j], fontSize, charWidth, &bits);
+                        lineCanvas.Blit(bits, offscreenX, 0, elements[j].Style().isRed);
+                        offscreenX += ElementTextWidth(elements[j], fontSize, charWidth);
+                    }
+                    Bits plane;
+                    plane.w = line.width;
+                    plane.h = line.height;
+                    plane.stride = line.stride;
+                    plane.data.swap(line.black);
+                    canvas.BlitTurned(plane, pen.x, pen.y, false);
+                    if (twoColour) {
+                        plane.data.swap(line.red);
+                        canvas.BlitTurned(plane, pen.x, pen.y, true);
+                    }
+                } else {
+                    while (j < count && elements[j].type == ELEMENT_TEXT) ++j;
+                }
+
+                Ink(pen.y, pen.y + textHeight);
+                if (textHeight > pen.lineMaxHeight) pen.lineMaxHeight = textHeight;
+                pen.x += lineWidth;
+                return j;
+            }
+        }
+
+        int h = ElementFontHeight(el, fontSize);
+        if (canvas.Shows(pen.y, h)) {
+            BuildTextBitmap(el, fontSize, charWidth, &bits);
+            canvas.Blit(bits, pen.x, pen.y, el.Style().isRed);
+        }
+        Ink(pen.y, pen.y + h);
+        if (h > pen.lineMaxHeight) pen.lineMaxHeight = h;
+        pen.x += ElementTextWidth(el, fontSize, charWidth);
+        break;
+    }
+
+    case ELEMENT_SETPOS: {
+        // ESC $ / ESC \: an explicit position replaces the justified start,
+        // so the line is no longer "at its start".
+        int base = BaseX(el);
+        pen.x = el.absolutePos ? base + DotsToPixels(el.width, charWidth)
+                               : pen.x + DotsToPixels(el.width, charWidth);
+        if (pen.x < base) pen.x = base;
+        pen.atLineStart = false;
+        break;
+    }
+
+    case ELEMENT_FEED:
+        // ESC J / ESC K: vertical dots map 1:1 to pixels, as ESC 3 line
+        // spacing does.
+        pen.y += el.height;
+        pen.x = BaseX(el);
+        pen.atLineStart = true;
+        pen.lineMaxHeight = lineHeight;
+        break;
+
+    case ELEMENT_NEWLINE:
+        pen.x = leftMargin;
+        pen.atLineStart = true;
+        // ESC 3 spacing if set, else the tallest thing on the line.
+        if (el.height > 0) pen.y += el.height;
+        else pen.y += pen.lineMaxHeight + 4;
+        pen.lineMaxHeight = lineHeight;
+        break;
+
+    case ELEMENT_CUT:
+        if (pen.x != leftMargin) {
+            pen.x = leftMargin;
+            pen.y += pen.lineMaxHeight + 4;
+            pen.lineMaxHeight = lineHeight;
+        }
+
+        pen.y += 10;
+        {
+            // A dashed line up to a "[CUT]" at the right edge. Its rows count
+            // as ink either way, so a layout serves with marks or without.
+            int labelH = ElementFontHeight(PrinterElement(), fontSize);
+            int labelTop = pen.y - labelH / 2;
+            if (cutMarks && canvas.Shows(labelTop, labelH)) {
+                PrinterElement label;
+                label.text = L"[CUT]";
+                label.width = 5;
+                BuildTextBitmap(label, fontSize, charWidth, &bits);
+                int labelX = width - bits.w - 2;
+                for (int x = 0; x < labelX - 4; ++x) {
+                    if (x % 10 < 5) canvas.Dot(x, pen.y, false);
+                }
+                canvas.Blit(bits, labelX, labelTop, false);
+            }
+            Ink(labelTop, labelTop + labelH);
+        }
+        pen.y += 10;
+        pen.y += lineHeight; // the paper advances a line past the cut
+        pen.atLineStart = true;
+        break;
+
+    case ELEMENT_BITMAP:
+        if (pen.x != leftMargin) {
+            pen.x = leftMargin;
+            pen.y += pen.lineMaxHeight + 4;
+            pen.lineMaxHeight = lineHeight;
+        }
+        pen.atLineStart = true;
+
+        // A dot maps 1:1 to a pixel, as it does for ESC J feeds.
+        if (canvas.Shows(pen.y, el.height)) {
+            BuildElementBitmap(el, &bits);
+            canvas.Blit(bits, AlignStartX(el.width, el), pen.y, false);
+        }
+        Ink(pen.y, pen.y + el.height);
+
+        pen.y += el.height;
+        pen.y += 5; // spacing
+        pen.x = leftMargin;
+        break;
+
+    default:
+        break;
+    }
+    return idx + 1;
+}
+
+// ---------------------------------------------------------------------------
+// The layout index
+// ---------------------------------------------------------------------------
+
+void PaperLayoutIndex::Clear() {
+    lines.clear();
+    laidOut = 0;
+    width = height = 0;
+    overhang = 0;
+    changedTop = 0;
+    fontSize = paperWidth = margin = -1;
+}
+
+void PaperLayoutIndex::Update(const PrinterElement* elements, size_t count,
+                              const RasterOptions& options, size_t unchanged) {
+    Typesetter setter(elements, count, options, NULL);
+    if (setter.fontSize != fontSize || setter.paperWidth != paperWidth ||
+        setter.leftMargin != margin) {
+        Clear();
+        fontSize = setter.fontSize;
+        paperWidth = setter.paperWidth;
+        margin = setter.leftMargin;
+        width = setter.width;
+    }
+    if (unchanged > laidOut) unchanged = laidOut;
+    if (unchanged > count) unchanged = count;
+    changedTop = lines.empty() ? 0 : INT_MAX;
+    if (unchanged == count && count == laidOut && !lines.empty()) return;
+
+    // Lay out again from the start of the line holding the first element
+    // that changed: its own layout may depend on any element in it, such as
+    // the end of the line it centres, but where it starts does not.
+    Pen pen = setter.Start();
+    size_t idx = 0;
+    if (!lines.empty()) {
+        size_t lo = 0, hi = lines.size();
+        while (hi - lo > 1) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (lines[mid].first <= unchanged) lo = mid;
+            else hi = mid;
+        }
+        const Line& from = lines[lo];
+        idx = from.first;
+        pen.y = from.y;
+        pen.x = from.x;
+        pen.lineMaxHeight = from.maxHeight;
+        // Whatever the lines from there on drew may be gone or moved.
+        changedTop = from.y;
+        for (size_t i = lo; i < lines.size(); ++i)
+            changedTop = std::min(changedTop, lines[i].inkTop);
+        lines.resize(lo);
+    }
+
+    Line line = { idx, pen.y, pen.x, pen.lineMaxHeight, pen.y, pen.y, 0, 0 };
+    setter.ResetInk(pen.y);
+    auto close = [&](Line& l) {
+        l.inkTop = setter.inkTop;
+        l.inkBottom = setter.inkBottom;
+        l.reach = lines.empty() ? l.inkBottom : std::max(lines.back().reach, l.inkBottom);
+        l.deepest = lines.empty() ? l.y : std::max(lines.back().deepest, l.y);
+        if (l.deepest - l.inkTop > overhang) overhang = l.deepest - l.inkTop;
+        if (l.inkTop < changedTop) changedTop = l.inkTop;
+        lines.push_back(l);
+    };
+    while (idx < count) {
+        size_t next = setter.Step(idx, pen);
+        bool starts = Typesetter::LineStarts(elements[next - 1], pen);
+        idx = next;
+        if (starts) {
+            close(line);
+            line = { idx, pen.y, pen.x, pen.lineMaxHeight, pen.y, pen.y, 0, 0 };
+            setter.ResetInk(pen.y);
+        }
+    }
+    close(line); // the open line, if only to keep the pen for next time
+
+    laidOut = count;
+    height = pen.y;
+}
+
+int PaperLayoutIndex::LineTop(size_t element) const {
+    if (lines.empty()) return height;
+    size_t lo = 0, hi = lines.size();
+    while (hi - lo > 1) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (lines[mid].first <= element) lo = mid;
+        else hi = mid;
+    }
+    return lines[lo].y;
+}
+
+void PaperLayoutIndex::Draw(const PrinterElement* elements, const RasterOptions& options,
+                            PaperImage* image) const {
+    image->Reset(width, image->top, image->height, options.twoColour);
+    if (image->height <= 0 || lines.empty()) return;
+    int top = image->top, bottom = image->top + image->height;
+
+    // The first line whose ink, or that of a line above it, reaches the top
+    // of the image: the ones above cannot show.
+    size_t lo = 0, hi = lines.size();
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (lines[mid].reach <= top) lo = mid + 1;
+        else hi = mid;
+    }
+
+    Typesetter setter(elements, laidOut, options, image);
+    for (size_t i = lo; i < lines.size() && lines[i].deepest - overhang < bottom; ++i) {
+        const Line& line = lines[i];
+        if (line.inkBottom <= top || line.inkTop >= bottom) continue;
+        Pen pen = setter.Start();
+        pen.y = line.y;
+        pen.x = line.x;
+        pen.lineMaxHeight = line.maxHeight;
+        size_t end = i + 1 < lines.size() ? lines[i + 1].first : laidOut;
+        for (size_t idx = line.first; idx < end;) idx = setter.Step(idx, pen);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// The tile cache
+// ---------------------------------------------------------------------------
+
+PaperTileCache::PaperTileCache(size_t maxBytes)
+    : bytes(0), maxBytes(maxBytes), drawn(0), width(-1) {}
+
+void PaperTileCache::Invalidate(int top) {
+    for (std::list<Tile>::iterator it = tiles.begin(); it != tiles.end();) {
+        if ((it->index + 1) * kTileRows > top) {
+            bytes -= it->image.black.size() + it->image.red.size();
+            byIndex.erase(it->index);
+            it = tiles.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void PaperTileCache::Clear() {
+    tiles.clear();
+    byIndex.clear();
+    bytes = 0;
+}
+
+void PaperTileCache::Draw(const PaperLayoutIndex& layout, const PrinterElement* elements,
+                          const RasterOptions& options, PaperImage* image) {
+    if (layout.Width() != width || options.fontSize != drawnWith.fontSize ||
+        options.columns != drawnWith.columns || options.paperWidth != drawnWith.paperWidth ||
+        options.margin != drawnWith.margin || options.cutMarks != drawnWith.cutMarks ||
+        options.twoColour != drawnWith.twoColour) {
+        Clear();
+        drawnWith = options;
+        width = layout.Width();
+    }
+    image->Reset(width, image->top, image->height, options.twoColour);
+    int top = std::max(image->top, 0), bottom = image->top + image->height;
+    if (top >= bottom) return;
+
+    for (int index = top / kTileRows; index * kTileRows < bottom; ++index) {
+        std::unordered_map<int, std::list<Tile>::iterator>::iterator found =
+            byIndex.find(index);
+        if (found != byIndex.end()) {
+            tiles.splice(tiles.begin(), tiles, found->second);
+        } else {
+            tiles.push_front(Tile());
+            Tile& tile = tiles.front();
+            tile.index = index;
+            tile.image.top = index * kTileRows;
+            tile.image.height = kTileRows;
+            layout.Draw(elements, options, &tile.image);
+            byIndex[index] = tiles.begin();
+            bytes += tile.image.black.size() + tile.image.red.size();
+            ++drawn;
+            // Keep at least the tile just drawn, however little is allowed.
+            while (bytes > maxBytes && tiles.size() > 1) {
+                Tile& last = tiles.back();
+                bytes -= last.image.black.size() + last.image.red.size();
+                byIndex.erase(last.index);
+                tiles.pop_back();
+            }
+        }
+
+        // Rows are as wide in the tile as in the image, so the rows they
+        // share are one block in each.
+        const PaperImage& tile = tiles.front().image;
+        int from = std::max(top, tile.top), to = std::min(bottom, tile.top + kTileRows);
+        size_t offset = (size_t)(from - tile.top) * tile.stride;
+        size_t at = (size_t)(from - image->top) * image->stride;
+        size_t length = (size_t)(to - from) * image->stride;
+        memcpy(&image->black[at], &tile.black[offset], length);
+        if (!image->red.empty()) memcpy(&image->red[at], &tile.red[offset], length);
+    }
+}
+
+PaperLayout RenderPaper(const PrinterElement* elements, size_t count,
+                        const RasterOptions& options, PaperImage* image, size_t mark) {
+    PaperLayoutIndex index;
+    index.Update(elements, count, options, 0);
+
+    PaperLayout layout;
+    layout.width = index.Width();
+    layout.height = index.Height();
+    layout.markTop = index.LineTop(mark);
+    if (image) {
+        if (image->height < 0) {
+            image->top = 0;
+            image->height = layout.height;
+        }
+        index.Draw(elements, options, image);
+    }
+    return layout;
+}
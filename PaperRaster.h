@@ -0,0 +1,207 @@
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "VirtualPrinter.h"
+
+// Draws the paper without a window: the elements a printer produced, laid
+// out the way it would print them, onto a 1 bit per dot image a GUI only has
+// to copy to the screen. It needs nothing from the platform, so a headless
+// box can render receipts in batch or time the renderer (see
+// tools/renderpaper.cpp). The apps still draw with their own code until they
+// are moved onto it and built on Windows and macOS.
+//
+// At the default font size of 24 one dot is one pixel: 576 dots across 80 mm
+// paper at 203 dpi, as the printer prints it. Other sizes scale everything on
+// the character grid, as the viewer's zoom does.
+
+// How to lay the paper out.
+struct RasterOptions {
+  // Height of the Font A cell in pixels; its width follows from the 12x24
+  // cell. 24 draws dot for dot.
+  int fontSize = 24;
+  // Width of the paper, which ESC a centres and right-aligns within unless
+  // GS W sets a print area: `columns` Font A cells, or else paperWidth
+  // pixels, or else 48 cells - 576 dots at the default size.
+  int columns = 0;
+  int paperWidth = 0;
+  // White around the paper, left and right and above the first line.
+  int margin = 10;
+  // Mark each cut with a dashed line and "[CUT]". That is the viewer's doing
+  // rather than the printer's; a rendering of the receipt itself leaves it
+  // out.
+  bool cutMarks = true;
+  // Red text (ESC r, and ESC E, which the viewer shows in red) on a plane
+  // of its own; otherwise it is black.
+  bool twoColour = false;
+};
+
+// Some rows of the paper. A set bit is ink. Rows are padded to a multiple of
+// 4 bytes, so a GDI DIB or a CGImage can take them as they are.
+struct PaperImage {
+  int width = 0;
+  int top = 0; // the paper row the first row of the image shows
+  int height = 0;
+  int stride = 0; // bytes per row
+  std::vector<unsigned char> black;
+  std::vector<unsigned char> red; // empty unless RasterOptions::twoColour
+
+  // Blank rows [top, top + height) of a paper `width` pixels wide.
+  void Reset(int width, int top, int height, bool twoColour);
+  bool Black(int x, int y) const { return Dot(black, x, y); }
+  bool Red(int x, int y) const { return Dot(red, x, y); }
+
+private:
+  bool Dot(const std::vector<unsigned char> &plane, int x, int y) const {
+    if (plane.empty() || x < 0 || x >= width || y < 0 || y >= height)
+      return false;
+    return (plane[(size_t)y * stride + x / 8] >> (7 - x % 8)) & 1;
+  }
+};
+
+// What laying the paper out found.
+struct PaperLayout {
+  int width = 0;  // of the whole paper, margins included
+  int height = 0; // down to the end of the last line
+  // Top of the line holding element `mark` of the RenderPaper() call, or of
+  // the last line when there is no such element (see
+  // PaperLayoutIndex::LineTop()).
+  int markTop = 0;
+};
+
+// The paper laid out once and kept: where each line starts and how far its
+// ink reaches, in an index that only ever grows at the end. Appending elements
+// lays out only those and the line they join, so keeping it up to date costs
+// what changed rather than the length of the roll, and drawing a window onto
+// the paper finds its first line by binary search.
+//
+// A line here runs from one element that starts a new line on the paper
+// (after a line feed, feed, cut, bitmap or page) to the next; the layout at
+// its start depends on nothing after it.
+class PaperLayoutIndex {
+public:
+  PaperLayoutIndex() { Clear(); }
+
+  // Lays out `count` elements, of which the first `unchanged` are the ones
+  // it was last given, as they were; the rest are new or replaced. If the
+  // options lay the paper out differently from last time, everything is
+  // laid out again.
+  void Update(const PrinterElement *elements, size_t count,
+              const RasterOptions &options, size_t unchanged);
+  void Update(const std::vector<PrinterElement> &elements,
+              const RasterOptions &options, size_t unchanged) {
+    Update(elements.data(), elements.size(), options, unchanged);
+  }
+  // Forgets the layout, as for a different paper.
+  void Clear();
+
+  size_t Lines() const { return lines.size(); }
+  int Width() const { return width; }
+  int Height() const { return height; }
+  // Top of the line holding `element`; the last line's for one past the
+  // end. Nothing above it can change while elements from there on do.
+  int LineTop(size_t element) const;
+  // The highest row whose ink the last Update() may have changed, ink that
+  // went away included; INT_MAX if it changed nothing.
+  int ChangedTop() const { return changedTop; }
+
+  // Draws rows [image->top, image->top + image->height) into `image`, from
+  // the same elements last given to Update(). Only the lines whose ink
+  // reaches those rows are visited.
+  void Draw(const PrinterElement *elements, const RasterOptions &options,
+            PaperImage *image) const;
+  void Draw(const std::vector<PrinterElement> &elements,
+            const RasterOptions &options, PaperImage *image) const {
+    Draw(elements.data(), options, image);
+  }
+
+private:
+  // Where the layout stands at the start of a line.
+  struct Line {
+    size_t first; // its first element
+    int y;        // its top
+    int x;        // where text goes if no justification moves it
+    int maxHeight; // what the line's height starts from
+    // Rows its ink covers, and the furthest down the ink of this line or any
+    // line before it reaches, which only grows and is what Draw() searches.
+    int inkTop, inkBottom, reach;
+    // The lowest top of this line or any line before it: a reverse feed
+    // (ESC K) can put a line above the one before.
+    int deepest;
+  };
+
+  std::vector<Line> lines; // the last one is open: elements may still join
+  size_t laidOut;          // elements laid out
+  int width, height;
+  int overhang; // the most any line's ink starts above `deepest`
+  int changedTop;
+  // What the layout was made with; any other value invalidates it.
+  int fontSize, paperWidth, margin;
+};
+
+// Rows of the paper kept drawn, in tiles of kTileRows rows across the whole
+// width, so that scrolling back over the paper copies them rather than
+// drawing it again. The tiles least recently used go once they take more
+// than the memory given; drawing in the same place again after that only
+// costs the drawing.
+//
+// The tiles are only as good as the layout they were drawn from: after
+// PaperLayoutIndex::Update(), pass its ChangedTop() to Invalidate(). As the
+// printer only appends, that is the last tile or two.
+class PaperTileCache {
+public:
+  static const int kTileRows = 512;
+
+  explicit PaperTileCache(size_t maxBytes = 8 << 20);
+
+  // Forgets the tiles holding row `top` and below.
+  void Invalidate(int top);
+  void Clear();
+
+  // Fills rows [image->top, image->top + image->height) of `image` from the
+  // tiles, drawing those not kept through `layout` first. Other options than
+  // last time forget every tile.
+  void Draw(const PaperLayoutIndex &layout, const PrinterElement *elements,
+            const RasterOptions &options, PaperImage *image);
+  void Draw(const PaperLayoutIndex &layout,
+            const std::vector<PrinterElement> &elements,
+            const RasterOptions &options, PaperImage *image) {
+    Draw(layout, elements.data(), options, image);
+  }
+
+  size_t Tiles() const { return tiles.size(); }
+  size_t Bytes() const { return bytes; }
+  // Tiles drawn since the cache was made, for telling how well it does.
+  unsigned long long Drawn() const { return drawn; }
+
+private:
+  struct Tile {
+    int index; // rows [index * kTileRows, (index + 1) * kTileRows)
+    PaperImage image;
+  };
+
+  std::list<Tile> tiles; // most recently used first
+  std::unordered_map<int, std::list<Tile>::iterator> byIndex;
+  size_t bytes, maxBytes;
+  unsigned long long drawn;
+  // What the tiles were drawn with.
+  RasterOptions drawnWith;
+  int width;
+};
+
+// Lays out `count` elements from the top of the paper and draws rows
+// [image->top, image->top + image->height) of it into `image`, which is
+// reset to the paper's width first. Pass a null image to lay out only, or a
+// negative height to draw the whole paper.
+PaperLayout RenderPaper(const PrinterElement *elements, size_t count,
+                        const RasterOptions &options, PaperImage *image,
+                        size_t mark = (size_t)-1);
+
+inline PaperLayout RenderPaper(const std::vector<PrinterElement> &elements,
+                               const RasterOptions &options, PaperImage *image,
+                               size_t mark = (size_t)-1) {
+  return RenderPaper(elements.data(), elements.size(), options, image, mark);
+}
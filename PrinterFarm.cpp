@@ -0,0 +1,172 @@
+#include "PrinterFarm.h"
+
+#include <cstdlib>
+#include <set>
+#include <sstream>
+
+// "9100" or "9102-9105"; false if it is neither, or a port is out of range.
+static bool ParsePorts(const std::string &text, int &first, int &last) {
+    std::string::size_type dash = text.find('-');
+    std::string a = text.substr(0, dash);
+    std::string b = dash == std::string::npos ? a : text.substr(dash + 1);
+    char *end = NULL;
+    first = (int)strtol(a.c_str(), &end, 10);
+    if (a.empty() || *end != '\0') return false;
+    last = (int)strtol(b.c_str(), &end, 10);
+    if (b.empty() || *end != '\0') return false;
+    return first >= 1 && last <= 65535 && first <= last;
+}
+
+bool PrinterFarm::ParseConfig(std::istream &in, std::vector<PrinterConfig> &out,
+                              std::string &error) {
+    out.clear();
+    std::string line;
+    for (int number = 1; std::getline(in, line); ++number) {
+        std::string::size_type hash = line.find('#');
+        if (hash != std::string::npos) line.erase(hash);
+        std::istringstream fields(line);
+        std::string name, ports, extra;
+        if (!(fields >> name)) continue; // blank or only a comment
+
+        std::string where = "line " + std::to_string(number) + ": ";
+        int first, last;
+        if (!(fields >> ports) || !ParsePorts(ports, first, last)) {
+            error = where + "expected a port or a range of ports after the name";
+            return false;
+        }
+        size_t maxPaperBytes = 0;
+        bool haveBudget = false;
+        PrinterProfile profile;
+        while (fields >> extra) {
+            std::string::size_type equals = extra.find('=');
+            std::string key = equals == std::string::npos ? std::string()
+                                                          : extra.substr(0, equals);
+            const char *number = extra.c_str() + (key.empty() ? 0 : equals + 1);
+            char *end = NULL;
+            long value = strtol(number, &end, 10);
+            if (end == number || *end != '\0' || value < 0) {
+                error = where + "\"" + extra + "\" is not a number";
+                return false;
+            }
+            if (key.empty() && !haveBudget) {
+                maxPaperBytes = (size_t)value << 20;
+                haveBudget = true;
+            } else if (key == "speed") {
+                profile.printSpeedMmPerSec = (int)value;
+            } else if (key == "feed") {
+                profile.lineFeedMs = (int)value;
+            } else if (key == "cut") {
+                profile.cutMs = (int)value;
+            } else if (key == "buffer") {
+                profile.receiveBufferBytes = (size_t)value;
+            } else {
+                error = where + "unexpected \"" + extra + "\"";
+                return false;
+            }
+        }
+
+        for (int port = first; port <= last; ++port) {
+            PrinterConfig config;
+            config.name = first == last ? name
+                                        : name + "-" + std::to_string(port - first + 1);
+            config.port = port;
+            config.maxPaperBytes = maxPaperBytes;
+            config.profile = profile;
+            out.push_back(config);
+        }
+    }
+    if (out.empty()) {
+        error = "no printers listed";
+        return false;
+    }
+    return true;
+}
+
+PrinterFarm::~PrinterFarm() {
+    Stop();
+}
+
+bool PrinterFarm::Start(const std::vector<PrinterConfig> &configs,
+                        const std::string &archiveDir) {
+    Stop();
+    printers.clear();
+
+    std::set<int> ports;
+    for (size_t i = 0; i < configs.size(); ++i) {
+        if (!ports.insert(configs[i].port).second) return false;
+    }
+
+    std::vector<NetworkServer::Endpoint> endpoints;
+    for (size_t i = 0; i < configs.size(); ++i) {
+        Printer *p = new Printer;
+        printers.push_back(std::unique_ptr<Printer>(p));
+        p->config = configs[i];
+        p->printer.reset(new VirtualPrinter());
+        p->printer->SetMaxPaperBytes(configs[i].maxPaperBytes);
+        p->printer->SetProfile(configs[i].profile);
+        p->printer->SetSessionBufferLimit(sessionBufferBytes);
+        if (!archiveDir.empty() &&
+            !p->printer->OpenArchive(archiveDir + "/" + configs[i].name + ".bin")) {
+            printers.clear();
+            return false;
+        }
+
+        // As in the apps: a session per connection, fed from the network
+        // and parsed on the printer's own thread. A printer with no room
+        // holds its connections unread, not a worker the others need.
+        NetworkServer::Endpoint endpoint;
+        endpoint.port = configs[i].port;
+        endpoint.receiveBufferBytes = (int)configs[i].profile.receiveBufferBytes;
+        endpoint.onAccept = [p](const NetworkServer::Writer &writer) {
+            ++p->connections;
+            ++p->openConnections;
+            std::shared_ptr<PrinterSession> session = p->printer->OpenSession(
+                [writer](const unsigned char *data, int len) { writer.Send(data, len); },
+                [writer]() { writer.Resume(); });
+            if (writer.PaperOut()) session->ReportPaperOut();
+            NetworkServer::ConnectionCallbacks callbacks;
+            callbacks.onData = [p, session](const unsigned char *data, int len) {
+                int taken = session->Feed(data, len);
+                p->bytesReceived += taken;
+                return taken;
+            };
+            callbacks.onClose = [p, session]() {
+                session->Close();
+                --p->openConnections;
+            };
+            return callbacks;
+        };
+        endpoints.push_back(endpoint);
+    }
+
+    if (!server.Start(endpoints)) {
+        printers.clear();
+        return false;
+    }
+    return true;
+}
+
+void PrinterFarm::Stop() {
+    server.Stop();
+}
+
+std::vector<PrinterFarm::PrinterStats> PrinterFarm::GetStats() {
+    std::vector<PrinterStats> stats(printers.size());
+    for (size_t i = 0; i < printers.size(); ++i) {
+        Printer &p = *printers[i];
+        stats[i].name = p.config.name;
+        stats[i].port = p.config.port;
+        stats[i].connections = p.connections;
+        stats[i].openConnections = p.openConnections;
+        stats[i].bytesReceived = p.bytesReceived;
+        stats[i].jobs = p.printer->GetJobCount() + p.printer->GetArchivedJobCount();
+        PrintJob last;
+        size_t onPaper = p.printer->GetJobCount();
+        if (onPaper > 0 && p.printer->GetJob(onPaper - 1, last)) {
+            stats[i].lastJobPrintMicros = last.printMicros;
+        }
+        stats[i].paper = p.printer->GetPaperUsage();
+        stats[i].ingest = p.printer->GetIngestStats();
+    }
+    return stats;
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Network.h"
+#include "VirtualPrinter.h"
+
+// Many virtual printers in one process, each on a port of its own, as a test
+// lab needs to stand in for a whole store: kitchen, bar and the tills.
+//
+// All the ports are served by one NetworkServer, so the printers share its
+// reactor and worker pool rather than each having a server of its own. A
+// printer that nobody prints to holds no thread and almost no memory; each
+// one's paper is capped by its own memory budget.
+class PrinterFarm {
+public:
+  struct PrinterConfig {
+    std::string name;
+    int port = 0;
+    size_t maxPaperBytes = 0; // memory budget of its paper; 0 = no limit
+    PrinterProfile profile;   // the default prints instantly
+  };
+
+  struct PrinterStats {
+    std::string name;
+    int port = 0;
+    unsigned long long connections = 0; // accepted since Start()
+    int openConnections = 0;
+    unsigned long long bytesReceived = 0;
+    size_t jobs = 0; // on the paper, plus archived ones
+    long long lastJobPrintMicros = 0; // PrintJob::printMicros of the last one
+    PaperUsage paper;
+    IngestStats ingest;
+  };
+
+  PrinterFarm() : sessionBufferBytes(0) {}
+  ~PrinterFarm(); // stops the server before the printers go
+
+  PrinterFarm(const PrinterFarm &) = delete;
+  PrinterFarm &operator=(const PrinterFarm &) = delete;
+
+  // Reads a farm description: one printer or range of printers per line,
+  //
+  //   # name   port(s)     memory MB (optional)
+  //   kitchen  9100        64
+  //   bar      9101
+  //   till     9102-9105   32      speed=250 buffer=4096 cut=300
+  //
+  // A range gives one printer per port, named till-1, till-2 and so on.
+  // speed= (mm/s), feed= and cut= (ms) and buffer= (bytes) give a printer
+  // the PrinterProfile of a real one. Blank lines and # comments are
+  // skipped. On failure `error` says which line was wrong.
+  static bool ParseConfig(std::istream &in, std::vector<PrinterConfig> &out,
+                          std::string &error);
+
+  // Takes effect at the next Start(). See NetworkServer::SetBackend().
+  void SetBackend(NetworkServer::Backend backend) { server.SetBackend(backend); }
+  // Take effect at the next Start(). The connection limits apply to all the
+  // ports together; see NetworkServer::SetLimits() and
+  // VirtualPrinter::SetSessionBufferLimit().
+  void SetLimits(const NetworkServer::Limits &limits) {
+    server.SetLimits(limits);
+  }
+  void SetSessionBufferLimit(size_t bytes) { sessionBufferBytes = bytes; }
+  NetworkServer::ConnectionStats GetConnectionStats() {
+    return server.GetConnectionStats();
+  }
+  // Takes effect at the next Start(). See NetworkServer::SetFaultPlan(); the
+  // paper-out fault makes the connection's session ReportPaperOut().
+  void SetFaultPlan(const NetworkServer::FaultPlan &plan) {
+    server.SetFaultPlan(plan);
+  }
+  NetworkServer::FaultStats GetFaultStats() const {
+    return server.GetFaultStats();
+  }
+
+  // Creates the printers and listens on all their ports. If `archiveDir` is
+  // not empty, each printer archives the receipts that leave its paper to
+  // <archiveDir>/<name>.bin. Fails, listening on nothing, if a port cannot
+  // be opened or is listed twice.
+  bool Start(const std::vector<PrinterConfig> &printers,
+             const std::string &archiveDir = std::string());
+  // Closes every connection, committing its job, and stops listening. The
+  // printers and their paper stay until the next Start().
+  void Stop();
+
+  size_t GetPrinterCount() const { return printers.size(); }
+  VirtualPrinter &GetPrinter(size_t n) { return *printers[n]->printer; }
+  std::vector<PrinterStats> GetStats();
+
+private:
+  struct Printer {
+    PrinterConfig config;
+    std::unique_ptr<VirtualPrinter> printer;
+    std::atomic<unsigned long long> connections{0};
+    std::atomic<int> openConnections{0};
+    std::atomic<unsigned long long> bytesReceived{0};
+  };
+
+  // By pointer: the server's callbacks keep pointing at their printer's
+  // entry however the vector moves.
+  std::vector<std::unique_ptr<Printer> > printers;
+  size_t sessionBufferBytes;
+  NetworkServer server;
+};
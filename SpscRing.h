@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+
+// A fixed-size byte queue between exactly one writer thread and one reader
+// thread, without a lock.
+//
+// `head` counts every byte ever written and `tail` every byte ever read; only
+// the writer stores to head and only the reader to tail. The writer copies
+// bytes in past head and then publishes them with a release store; the reader
+// loads head with acquire and may read everything below it, then hands the
+// space back the same way through tail. Both counters live on cache lines of
+// their own so that the two sides do not keep stealing them from each other.
+//
+// The buffer is not cleared when allocated, so the pages of a ring that never
+// fills are never touched.
+class SpscRing {
+public:
+  // The capacity is rounded up to a power of two.
+  explicit SpscRing(size_t capacity) : head(0), tail(0) {
+    size_t size = 1;
+    while (size < capacity) size <<= 1;
+    buffer.reset(new unsigned char[size]);
+    mask = size - 1;
+  }
+
+  SpscRing(const SpscRing &) = delete;
+  SpscRing &operator=(const SpscRing &) = delete;
+
+  size_t Capacity() const { return mask + 1; }
+
+  // Bytes waiting to be read. Exact on either side; from any other thread, a
+  // snapshot that may already be stale.
+  size_t Size() const {
+    size_t t = tail.load(std::memory_order_acquire);
+    return head.load(std::memory_order_acquire) - t;
+  }
+
+  // --- Writer -----------------------------------------------------------------
+  // Copies in as much of `data` as there is room for; returns how much.
+  size_t Write(const unsigned char *data, size_t length) {
+    size_t h = head.load(std::memory_order_relaxed);
+    size_t room = Capacity() - (h - tail.load(std::memory_order_acquire));
+    size_t n = std::min(length, room);
+    size_t at = h & mask;
+    size_t first = std::min(n, Capacity() - at);
+    std::memcpy(&buffer[at], data, first);
+    std::memcpy(&buffer[0], data + first, n - first);
+    head.store(h + n, std::memory_order_release);
+    return n;
+  }
+
+  size_t Free() const { return Capacity() - Size(); }
+
+  // --- Reader -----------------------------------------------------------------
+  // The oldest unread bytes that are contiguous in the buffer: all of them,
+  // or those up to the end of the buffer when they wrap. Stays valid until
+  // Consume().
+  size_t Peek(const unsigned char **data) const {
+    size_t t = tail.load(std::memory_order_relaxed);
+    size_t available = head.load(std::memory_order_acquire) - t;
+    *data = &buffer[t & mask];
+    return std::min(available, Capacity() - (t & mask));
+  }
+
+  // Hands the first `length` bytes Peek() returned back to the writer.
+  void Consume(size_t length) {
+    tail.store(tail.load(std::memory_order_relaxed) + length,
+               std::memory_order_release);
+  }
+
+private:
+  std::unique_ptr<unsigned char[]> buffer;
+  size_t mask;
+  alignas(64) std::atomic<size_t> head;
+  alignas(64) std::atomic<size_t> tail;
+};
@@ -1,73 +1,480 @@
 #include "VirtualPrinter.h"
 #include "Barcode.h"
 #include "CodePages.h"
+#include "PaperArchive.h"
 #include "QRCode.h"
 #include <iostream>
+#include <algorithm>
+#include <iterator>
 
 #include <string>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VP_HAVE_SSE2 1
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
 
 // ---------------------------------------------------------------------------
-// Commands that are recognised but not rendered.
+// The command grammar.
+//
+// Every command that opens with ESC, GS, FS or DLE is one row here: its prefix
+// and command byte, how many fixed parameter bytes follow, whether a
+// little-endian payload length follows those, and the handler that acts on
+// it. A row without a handler is a command we recognise but do not render; its
+// parameters and payload still have to be consumed, or they would fall through
+// to the text stream and print as garbage.
 //
-// These still have to consume their parameters: the parser returns to
-// STATE_NORMAL after the command byte, so any parameter left behind is treated
-// as printable text and shows up as garbage on the paper. Each entry is the
-// command byte followed by its fixed parameter count.
+// The parser never searches this table: the dense dispatch arrays below are
+// built from it at compile time, so the byte after a prefix is one index away
+// from its row.
 // ---------------------------------------------------------------------------
-struct CmdParams {
-    unsigned char cmd;
-    int params;
+struct CommandSpec {
+    unsigned char prefix;   // ESC, GS, FS or DLE
+    unsigned char cmd;      // the byte after the prefix
+    unsigned char params;   // fixed parameter bytes (at most 8)
+    unsigned char lenBytes; // width of the payload length after them, 0 = none
+    void (PrinterSession::*handler)(const unsigned char *params);
 };
 
-static const CmdParams ESC_SKIP[] = {
-    {0x25, 1}, // ESC % n  - select/cancel user-defined character set
-    {0x34, 0}, // ESC 4    - select italic (non-Epson) / user char set
-    {0x35, 0}, // ESC 5    - cancel italic
-    {0x3D, 1}, // ESC = n  - select peripheral device
-    {0x3F, 1}, // ESC ? n  - cancel user-defined character
-    {0x52, 1}, // ESC R n  - select international character set
-    {0x70, 3}, // ESC p m t1 t2 - generate cash drawer pulse
-    {0x75, 1}, // ESC u n  - transmit peripheral device status
-    {0x76, 0}, // ESC v    - transmit paper sensor status
-};
+static const unsigned char ESC = 0x1B;
+static const unsigned char GS = 0x1D;
+static const unsigned char FS = 0x1C;
+static const unsigned char DLE = 0x10;
+
+struct CommandTable {
+    typedef PrinterSession VP;
+
+    static constexpr CommandSpec kSpecs[] = {
+        {ESC, 0x40, 0, 0, &VP::CmdInitialize},     // ESC @
+        {ESC, 0x45, 1, 0, &VP::CmdEmphasized},     // ESC E n
+        {ESC, 0x2D, 1, 0, &VP::CmdUnderline},      // ESC - n
+        {ESC, 0x64, 1, 0, &VP::CmdFeedLines},      // ESC d n
+        {ESC, 0x74, 1, 0, &VP::CmdCodePage},       // ESC t n
+        {ESC, 0x33, 1, 0, &VP::CmdLineSpacing},    // ESC 3 n
+        {ESC, 0x32, 0, 0, &VP::CmdDefaultSpacing}, // ESC 2
+        {ESC, 0x21, 1, 0, &VP::CmdPrintMode},      // ESC ! n
+        {ESC, 0x2A, 3, 0, &VP::CmdBitImage},       // ESC * m nL nH d...
+        {ESC, 0x61, 1, 0, &VP::CmdJustification},  // ESC a n
+        {ESC, 0x69, 0, 0, &VP::CmdCut},            // ESC i - full cut
+        {ESC, 0x6D, 0, 0, &VP::CmdCut},            // ESC m - partial cut
+        {ESC, 0x26, 3, 0, &VP::CmdUserChars},      // ESC & y c1 c2 ...
+        {ESC, 0x44, 0, 0, &VP::CmdTabPositions},   // ESC D n1...nk NUL
+        {ESC, 0x7B, 1, 0, &VP::CmdUpsideDown},     // ESC { n
+        {ESC, 0x4D, 1, 0, &VP::CmdFont},           // ESC M n
+        {ESC, 0x47, 1, 0, &VP::CmdDoubleStrike},   // ESC G n
+        {ESC, 0x67, 1, 0, &VP::CmdDoubleStrike},   // ESC g n
+        {ESC, 0x72, 1, 0, &VP::CmdColor},          // ESC r n
+        {ESC, 0x20, 1, 0, &VP::CmdCharSpacing},    // ESC SP n
+        {ESC, 0x56, 1, 0, &VP::CmdRotate90},       // ESC V n
+        {ESC, 0x24, 2, 0, &VP::CmdAbsolutePos},    // ESC $ nL nH
+        {ESC, 0x5C, 2, 0, &VP::CmdRelativePos},    // ESC \ nL nH
+        {ESC, 0x4A, 1, 0, &VP::CmdFeedDots},       // ESC J n
+        {ESC, 0x4B, 1, 0, &VP::CmdReverseDots},    // ESC K n
+        {ESC, 0x65, 1, 0, &VP::CmdReverseLines},   // ESC e n
+        {ESC, 0x4C, 0, 0, &VP::CmdPageMode},       // ESC L
+        {ESC, 0x53, 0, 0, &VP::CmdStandardMode},   // ESC S
+        {ESC, 0x0C, 0, 0, &VP::CmdPrintPage},      // ESC FF
+        {ESC, 0x54, 1, 0, &VP::CmdPrintDirection}, // ESC T n
+        {ESC, 0x57, 8, 0, &VP::CmdPrintArea},      // ESC W xL xH yL yH dxL dxH dyL dyH
+        {ESC, 0x28, 1, 2, nullptr},  // ESC ( fn pL pH d1...dk
+        {ESC, 0x63, 2, 0, nullptr},  // ESC c 0/1/3/4/5 n - sheet, sensors, panel
+        {ESC, 0x25, 1, 0, nullptr},  // ESC % n  - select/cancel user-defined character set
+        {ESC, 0x34, 0, 0, nullptr},  // ESC 4    - select italic (non-Epson) / user char set
+        {ESC, 0x35, 0, 0, nullptr},  // ESC 5    - cancel italic
+        {ESC, 0x3D, 1, 0, nullptr},  // ESC = n  - select peripheral device
+        {ESC, 0x3F, 1, 0, nullptr},  // ESC ? n  - cancel user-defined character
+        {ESC, 0x52, 1, 0, nullptr},  // ESC R n  - select international character set
+        {ESC, 0x70, 3, 0, nullptr},  // ESC p m t1 t2 - generate cash drawer pulse
+        {ESC, 0x75, 1, 0, &VP::CmdDrawerStatus},   // ESC u n
+        {ESC, 0x76, 0, 0, &VP::CmdPaperStatus},    // ESC v
+
+        {GS, 0x56, 1, 0, &VP::CmdCutPaper},        // GS V m [n]
+        {GS, 0x76, 1, 0, &VP::CmdRasterSelect},    // GS v 0 ...
+        {GS, 0x2A, 2, 0, &VP::CmdDefineImage},     // GS * x y d...
+        {GS, 0x2F, 1, 0, &VP::CmdPrintImage},      // GS / m
+        {GS, 0x28, 1, 2, &VP::CmdParenGroup},      // GS ( <id> pL pH d1...dk
+        {GS, 0x38, 1, 4, &VP::CmdLargeGraphics},   // GS 8 L p1 p2 p3 p4 d...
+        {GS, 0x6B, 1, 0, &VP::CmdBarcode},         // GS k m ...
+        {GS, 0x68, 1, 0, &VP::CmdBarcodeHeight},   // GS h n
+        {GS, 0x77, 1, 0, &VP::CmdBarcodeModule},   // GS w n
+        {GS, 0x48, 1, 0, &VP::CmdHriPosition},     // GS H n
+        {GS, 0x66, 1, 0, &VP::CmdHriFont},         // GS f n
+        {GS, 0x21, 1, 0, &VP::CmdCharSize},        // GS ! n
+        {GS, 0x42, 1, 0, &VP::CmdReverse},         // GS B n
+        {GS, 0x4C, 2, 0, &VP::CmdLeftMargin},      // GS L nL nH
+        {GS, 0x57, 2, 0, &VP::CmdAreaWidth},       // GS W nL nH
+        {GS, 0x24, 2, 0, &VP::CmdPageAbsoluteY},   // GS $ nL nH
+        {GS, 0x5C, 2, 0, &VP::CmdPageRelativeY},   // GS \ nL nH
+        {GS, 0x72, 1, 0, &VP::CmdTransmitStatus},  // GS r n
+        {GS, 0x49, 1, 0, &VP::CmdTransmitId},      // GS I n
+        {GS, 0x61, 1, 0, &VP::CmdAsb},             // GS a n
+        {GS, 0x3A, 0, 0, nullptr},   // GS :     - start/end macro definition
+        {GS, 0x50, 2, 0, nullptr},   // GS P x y - set motion units
+        {GS, 0x54, 1, 0, nullptr},   // GS T n   - move to beginning of print line
+        {GS, 0x5E, 3, 0, nullptr},   // GS ^ r t m - execute macro
+        {GS, 0x62, 1, 0, nullptr},   // GS b n   - turn smoothing on/off
+        {GS, 0x6A, 1, 0, nullptr},   // GS j n   - enable/disable ASB for ink
+
+        {FS, 0x71, 1, 0, &VP::CmdDefineNvImages},  // FS q n [xL xH yL yH d...]...
+        {FS, 0x70, 2, 0, &VP::CmdPrintNvImage},    // FS p n m
+        {FS, 0x21, 1, 0, nullptr},   // FS ! n   - set print mode for Kanji
+        {FS, 0x26, 0, 0, nullptr},   // FS &     - select Kanji mode
+        {FS, 0x2D, 1, 0, nullptr},   // FS - n   - underline mode for Kanji
+        {FS, 0x2E, 0, 0, nullptr},   // FS .     - cancel Kanji mode
+        {FS, 0x43, 1, 0, nullptr},   // FS C n   - select Kanji code system
+        {FS, 0x53, 2, 0, nullptr},   // FS S n1 n2 - set Kanji character spacing
+        {FS, 0x57, 1, 0, nullptr},   // FS W n   - Kanji quadruple size
+
+        {DLE, 0x14, 1, 0, &VP::CmdRealtimeDc4},    // DLE DC4 fn ...
+        {DLE, 0x04, 1, 0, &VP::CmdRealtimeStatus}, // DLE EOT n
+        {DLE, 0x05, 1, 0, nullptr},  // DLE ENQ n - real-time request
+    };
+    static constexpr size_t kCount = sizeof(kSpecs) / sizeof(kSpecs[0]);
+
+    // GS v 0 m xL xH yL yH: reached through GS v once its function byte is
+    // known to be '0', so it has no slot in the dispatch arrays.
+    static constexpr CommandSpec kRasterImage = {GS, 0x76, 5, 0,
+                                                 &VP::CmdRasterImage};
+    // GS V 65/66 n: function B cuts once its feed amount n is in.
+    static constexpr CommandSpec kFeedAndCut = {GS, 0x56, 1, 0, &VP::CmdCut};
+
+    // Row of a prefix in the dispatch arrays.
+    static constexpr int Slot(unsigned char prefix) {
+        return prefix == ESC ? 0 : prefix == GS ? 1 : prefix == FS ? 2 : 3;
+    }
 
-static const CmdParams GS_SKIP[] = {
-    {0x3A, 0}, // GS :     - start/end macro definition
-    {0x49, 1}, // GS I n   - transmit printer ID
-    {0x50, 2}, // GS P x y - set motion units
-    {0x54, 1}, // GS T n   - move to beginning of print line
-    {0x5E, 3}, // GS ^ r t m - execute macro
-    {0x61, 1}, // GS a n   - enable/disable automatic status back
-    {0x62, 1}, // GS b n   - turn smoothing on/off
-    {0x6A, 1}, // GS j n   - enable/disable ASB for ink
-    {0x72, 1}, // GS r n   - transmit status
-};
+    // For each prefix, the row index + 1 of every command byte (0 = unknown).
+    struct Dispatch {
+        unsigned char row[4][256];
+    };
+
+    static constexpr Dispatch Build() {
+        Dispatch d{};
+        for (size_t i = 0; i < kCount; ++i) {
+            d.row[Slot(kSpecs[i].prefix)][kSpecs[i].cmd] = (unsigned char)(i + 1);
+        }
+        return d;
+    }
+    static const Dispatch kDispatch;
 
-static const CmdParams FS_SKIP[] = {
-    {0x21, 1}, // FS ! n   - set print mode for Kanji
-    {0x26, 0}, // FS &     - select Kanji mode
-    {0x2D, 1}, // FS - n   - underline mode for Kanji
-    {0x2E, 0}, // FS .     - cancel Kanji mode
-    {0x43, 1}, // FS C n   - select Kanji code system
-    {0x53, 2}, // FS S n1 n2 - set Kanji character spacing
-    {0x57, 1}, // FS W n   - Kanji quadruple size
+    static_assert(kCount < 255, "dispatch arrays index rows with a byte");
+
+    static const CommandSpec *Find(unsigned char prefix, unsigned char cmd) {
+        unsigned char row = kDispatch.row[Slot(prefix)][cmd];
+        return row ? &kSpecs[row - 1] : nullptr;
+    }
 };
 
-// Upper bound on a single stored image. A malformed stream can claim a huge
-// length; past this we consume the bytes without buffering them.
+// Built from kSpecs by a constant expression, so it is filled in at compile
+// time like the table itself.
+const CommandTable::Dispatch CommandTable::kDispatch = CommandTable::Build();
+
+// A connection that goes quiet for this long has finished its job; what it
+// sends afterwards is a new one. Terminals that keep one connection open for
+// the whole shift would otherwise print the entire shift as a single job.
+static const int DEFAULT_JOB_IDLE_MS = 5000;
+
+// Viewers are told of paper changes at most this often: about once per frame
+// of a 60 Hz display, however fast the data comes in.
+static const int DEFAULT_FRAME_INTERVAL_MS = 16;
+
+// Input ring of a fed connection: a few of the largest chunks the network
+// hands over at once, so a burst is taken in whole while a big image parses.
+static const size_t INPUT_RING_BYTES = 1 << 20;
+// The parser thread moves on to the next connection after this much of one,
+// so one busy connection cannot keep the others waiting.
+static const size_t PARSE_BATCH_BYTES = 64 * 1024;
+// While throttled, the parser waits for the paper after every step this big,
+// so the input ring empties as the receipt prints instead of in one burst.
+static const size_t THROTTLED_STEP_BYTES = 256;
+
+// Paper motion, for PrinterProfile: 203 dpi is 8 dots per mm, and a line
+// feed with no spacing set moves the paper 30 dots (see ESC 2).
+static const int DOTS_PER_MM = 8;
+static const int DEFAULT_LINE_DOTS = 30;
+
+static long long SteadyMicros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Default bound on any one parse buffer of a session (see
+// SetSessionBufferLimit). A malformed stream can claim a huge length; past
+// this we consume the bytes without buffering them.
 static const long long MAX_IMAGE_BYTES = 8LL * 1024 * 1024;
 
-static int LookupParams(const CmdParams *table, size_t count, unsigned char cmd) {
-    for (size_t i = 0; i < count; ++i) {
-        if (table[i].cmd == cmd) return table[i].params;
+// Moves as much of a payload as this chunk holds into `dst`: up to `expected`
+// bytes in total, and no more than the `available` bytes at `src`. Returns the
+// number of bytes taken, so the caller can step past them in one go.
+static size_t TakePayload(std::vector<unsigned char> &dst, long long expected,
+                          const unsigned char *src, size_t available) {
+    long long missing = expected - (long long)dst.size();
+    size_t n = (missing < (long long)available) ? (size_t)missing : available;
+    dst.insert(dst.end(), src, src + n);
+    return n;
+}
+
+// Length of the run of printable bytes at the start of `p`, i.e. the offset of
+// the first byte below 0x20. Every control code the parser acts on (LF, HT,
+// FF, CAN, DLE, ESC, FS, GS) is in that range, and the rest of it is dropped,
+// so a whole run can be appended without looking at the bytes one by one.
+static size_t ScanPrintable(const unsigned char *p, size_t n) {
+    size_t i = 0;
+#ifdef VP_HAVE_SSE2
+    // x <= 0x1F exactly when min(x, 0x1F) == x; SSE2 has no unsigned compare.
+    const __m128i limit = _mm_set1_epi8(0x1F);
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(v, limit), v));
+        if (mask != 0) {
+#ifdef _MSC_VER
+            unsigned long bit;
+            _BitScanForward(&bit, (unsigned long)mask);
+            return i + bit;
+#else
+            return i + (size_t)__builtin_ctz((unsigned)mask);
+#endif
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        if (p[i] < 0x20) break;
+    }
+    return i;
+}
+
+// ---------------------------------------------------------------------------
+// Status
+// ---------------------------------------------------------------------------
+
+// DLE EOT n: one byte with bits 1 and 4 always set. 0 for a request the
+// printer does not answer.
+static unsigned char RealtimeStatusByte(const PrinterStatus &s, int n) {
+    unsigned char b = 0x12;
+    switch (n) {
+    case 1: // printer
+        if (s.drawerOpen) b |= 0x04;
+        if (s.Offline()) b |= 0x08;
+        return b;
+    case 2: // offline cause
+        if (s.coverOpen) b |= 0x04;
+        if (s.paperEnd) b |= 0x20;
+        if (s.cutterError) b |= 0x40;
+        return b;
+    case 3: // error cause
+        if (s.cutterError) b |= 0x08;
+        return b;
+    case 4: // roll paper sensor
+        if (s.paperNearEnd) b |= 0x0C;
+        if (s.paperEnd) b |= 0x60;
+        return b;
     }
-    return -1; // not in the table
+    return 0;
 }
 
-VirtualPrinter::VirtualPrinter() {
+// GS r 1, ESC v: near end in bits 0-1, paper end in bits 2-3.
+static unsigned char PaperSensorByte(const PrinterStatus &s) {
+    return (s.paperNearEnd ? 0x03 : 0) | (s.paperEnd ? 0x0C : 0);
+}
+
+// The four bytes of Automatic Status Back. Bit 4 is set in the first byte
+// only, which is how a client tells them from other replies.
+static void AsbBytes(const PrinterStatus &s, unsigned char out[4]) {
+    out[0] = 0x10;
+    if (s.drawerOpen) out[0] |= 0x04;
+    if (s.Offline()) out[0] |= 0x08;
+    if (s.coverOpen) out[0] |= 0x20;
+    out[1] = s.cutterError ? 0x08 : 0;
+    out[2] = PaperSensorByte(s);
+    out[3] = 0;
+}
+
+// The GS a bits whose status differs between `a` and `b`: 0 drawer,
+// 1 online/offline, 2 error, 3 roll paper sensor.
+static unsigned char AsbChanges(const PrinterStatus &a, const PrinterStatus &b) {
+    unsigned char changed = 0;
+    if (a.drawerOpen != b.drawerOpen) changed |= 0x01;
+    if (a.Offline() != b.Offline() || a.coverOpen != b.coverOpen) changed |= 0x02;
+    if (a.cutterError != b.cutterError) changed |= 0x04;
+    if (a.paperNearEnd != b.paperNearEnd || a.paperEnd != b.paperEnd) changed |= 0x08;
+    return changed;
+}
+
+// ---------------------------------------------------------------------------
+// Element storage
+// ---------------------------------------------------------------------------
+
+// Text is packed into blocks that start small, since a session's arena is
+// emptied with every job, and grow while the arena keeps filling.
+static const size_t MIN_TEXT_BLOCK = 256;
+static const size_t MAX_TEXT_BLOCK = 16384;
+
+StyleTable::StyleTable() {
+    styles.Append(ElementStyle()); // id 0
+    index[ElementStyle()] = 0;
+}
+
+size_t StyleTable::Hash::operator()(const ElementStyle &s) const {
+    size_t h = (size_t)s.isRed | (size_t)s.isReverse << 1 |
+               (size_t)s.isUpsideDown << 2 | (size_t)s.isBold << 3 |
+               (size_t)s.isRotated90 << 4 | (size_t)s.isUnderline << 5 |
+               (size_t)(s.align & 3) << 6 | (size_t)(s.font & 3) << 8 |
+               (size_t)(s.widthScale & 15) << 10 |
+               (size_t)(s.heightScale & 15) << 14;
+    h = h * 31 + (size_t)s.charSpacing;
+    h = h * 31 + (size_t)s.marginLeft;
+    h = h * 31 + (size_t)s.areaWidth;
+    return h;
+}
+
+StyleId StyleTable::Intern(const ElementStyle &style) {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::unordered_map<ElementStyle, StyleId, Hash>::const_iterator it =
+        index.find(style);
+    if (it != index.end()) return it->second;
+    StyleId id = (StyleId)styles.Size();
+    styles.Append(style);
+    index[style] = id;
+    return id;
+}
+
+ElementArena::ElementArena(ElementArena &&other)
+    : textBlocks(std::move(other.textBlocks)), textBlock(other.textBlock),
+      textUsed(other.textUsed), textCapacity(other.textCapacity),
+      bitmaps(std::move(other.bitmaps)), bytes(other.bytes) {
+    other.textBlocks.clear();
+    other.bitmaps.clear();
+    other.textBlock = nullptr;
+    other.textUsed = other.textCapacity = other.bytes = 0;
+}
+
+ElementArena &ElementArena::operator=(ElementArena &&other) {
+    if (this != &other) {
+        textBlocks = std::move(other.textBlocks);
+        textBlock = other.textBlock;
+        textUsed = other.textUsed;
+        textCapacity = other.textCapacity;
+        bitmaps = std::move(other.bitmaps);
+        bytes = other.bytes;
+        other.textBlocks.clear();
+        other.bitmaps.clear();
+        other.textBlock = nullptr;
+        other.textUsed = other.textCapacity = other.bytes = 0;
+    }
+    return *this;
+}
+
+const wchar_t *ElementArena::AddText(const wchar_t *text, size_t length) {
+    if (length == 0) return nullptr;
+    if (length > textCapacity - textUsed) {
+        size_t size = textCapacity ? textCapacity * 2 : MIN_TEXT_BLOCK;
+        if (size > MAX_TEXT_BLOCK) size = MAX_TEXT_BLOCK;
+        if (length > size / 2) {
+            // Too long to share a block: it gets one of its own, and the
+            // block being packed stays open for the runs after it.
+            textBlocks.push_back(std::unique_ptr<wchar_t[]>(new wchar_t[length]));
+            bytes += length * sizeof(wchar_t);
+            wchar_t *own = textBlocks.back().get();
+            std::copy(text, text + length, own);
+            return own;
+        }
+        textBlocks.push_back(std::unique_ptr<wchar_t[]>(new wchar_t[size]));
+        bytes += size * sizeof(wchar_t);
+        textBlock = textBlocks.back().get();
+        textUsed = 0;
+        textCapacity = size;
+    }
+    wchar_t *dst = textBlock + textUsed;
+    std::copy(text, text + length, dst);
+    textUsed += length;
+    return dst;
+}
+
+void ElementArena::ReserveText(size_t length) {
+    if (length <= textCapacity - textUsed) return;
+    textBlocks.push_back(std::unique_ptr<wchar_t[]>(new wchar_t[length]));
+    bytes += length * sizeof(wchar_t);
+    textBlock = textBlocks.back().get();
+    textUsed = 0;
+    textCapacity = length;
+}
+
+const std::vector<unsigned char> *ElementArena::AddBitmap(std::vector<unsigned char> data) {
+    bytes += data.size();
+    bitmaps.push_back(std::unique_ptr<std::vector<unsigned char> >(
+        new std::vector<unsigned char>(std::move(data))));
+    return bitmaps.back().get();
+}
+
+void ElementArena::TakeBitmaps(ElementArena &from) {
+    for (size_t i = 0; i < from.bitmaps.size(); ++i) {
+        // Counted as they are now: a session grows ESC * bands in place.
+        size_t size = from.bitmaps[i]->size();
+        bytes += size;
+        from.bytes -= std::min(from.bytes, size);
+        bitmaps.push_back(std::move(from.bitmaps[i]));
+    }
+    from.bitmaps.clear();
+}
+
+void ElementArena::TakeAll(ElementArena &from) {
+    TakeBitmaps(from);
+    for (size_t i = 0; i < from.textBlocks.size(); ++i) {
+        textBlocks.push_back(std::move(from.textBlocks[i]));
+    }
+    bytes += from.bytes;
+    from.Clear();
+}
+
+void ElementArena::Clear() {
+    textBlocks.clear();
+    bitmaps.clear();
+    textBlock = nullptr;
+    textUsed = textCapacity = bytes = 0;
+}
+
+void ElementList::clear() {
+    elements.clear();
+    arena.Clear();
+}
+
+void ElementList::CopyElement(const PrinterElement &el) {
+    PrinterElement copy = el;
+    if (el.type == ELEMENT_TEXT) {
+        copy.text = arena.AddText(el.text, el.TextLength());
+    } else if (el.type == ELEMENT_BITMAP && el.bitmap) {
+        copy.bitmap = arena.AddBitmap(*el.bitmap);
+    }
+    elements.push_back(copy);
+}
+
+void ElementList::Splice(ElementList &other) {
+    arena.TakeAll(other.arena);
+    elements.insert(elements.end(), other.elements.begin(), other.elements.end());
+    other.elements.clear();
+}
+
+PrinterSession::PrinterSession(VirtualPrinter &printer) : printer(printer) {
+    closed = false;
+    asbMask = 0;
+    paperOut = false;
+    bufferLimit = printer.sessionBufferLimit;
+    motionCounted = 0;
+    motionLineDots = 0;
+    motionAheadDots = 0;
+    inputQueued = false;
+    inputParsing = false;
+    wantsRoom = false;
+    closing = false;
+    internedStyleId = 0; // internedStyle starts out as the default style
+    jobOpen = false;
+    jobBoundary = false;
+    lastActivity = std::chrono::steady_clock::now();
     state = STATE_NORMAL;
-    repaintCallback = nullptr;
-    repaintParam = nullptr;
     isEmphasizedMode = false;
     isColorRedMode = false;
     widthScaleMode = 1;
@@ -88,13 +495,15 @@ VirtualPrinter::VirtualPrinter() {
     currentCodePage = 0; // Default PC437
     currentText = L"";
     currentAlign = 0; // Left
-    maxColumns = 0;
+    maxColumns = printer.maxColumns.load();
     currentColumn = 0;
     escStarMode = 0;
     escStarColumns = 0;
     escStarBytesPerColumn = 0;
     escStarBandHeight = 0;
     escStarDataExpected = 0;
+    activeCommand = nullptr;
+    cmdParamCount = 0;
     skipRemaining = 0;
     skipReturnState = STATE_NORMAL;
     lenBytesRemaining = 0;
@@ -127,13 +536,15 @@ VirtualPrinter::VirtualPrinter() {
     pageCursorY = 0;
 }
 
-VirtualPrinter::~VirtualPrinter() {
+PrinterSession::~PrinterSession() {
     // Cleanup if needed
 }
 
-void VirtualPrinter::Reset() {
-    std::lock_guard<std::mutex> lock(mutex);
+void PrinterSession::ResetState(bool clearCaches) {
     elements.clear();
+    motionCounted = 0;
+    motionLineDots = 0;
+    motionAheadDots = 0;
     state = STATE_NORMAL;
     isEmphasizedMode = false;
     isColorRedMode = false;
@@ -149,61 +560,17 @@ void VirtualPrinter::Reset() {
     currentFont = FONT_A;
     isUnderlineMode = false;
     currentLineSpacing = -1; // Auto
-    // Do NOT clear downloaded bitmap on Reset? 
-    // Usually printers keep it until power cycle or clear command.
-    // We'll keep it.
-    currentCodePage = 0; // Default PC437
-    currentText = L"";
-    currentAlign = 0; // Left
-    currentColumn = 0;
-    tabStops.clear();
-    pageMode = false;
-    pageOriginX = 0;
-    pageOriginY = 0;
-    pageAreaW = 0;
-    pageAreaH = 0;
-    pageDirection = 0;
-    pageCursorX = 0;
-    pageCursorY = 0;
-    pageElements.clear();
-    barcodeHeight = 162;
-    barcodeModule = 3;
-    barcodeHriPos = 0;
-    barcodeHriFont = 0;
-    barcodeData.clear();
-    qrModuleSize = 3;
-    qrEcLevel = QR_ECC_LOW;
-    qrStoredData.clear();
-    if (repaintCallback) repaintCallback(repaintParam);
-}
 
-void VirtualPrinter::Clear() {
-    std::lock_guard<std::mutex> lock(mutex);
-    elements.clear();
-    state = STATE_NORMAL;
-    isEmphasizedMode = false;
-    isColorRedMode = false;
-    widthScaleMode = 1;
-    heightScaleMode = 1;
-    isReverseMode = false;
-    isUpsideDownMode = false;
-    isBoldMode = false;
-    isRotated90Mode = false;
-    charSpacingDots = 0;
-    marginLeftDots = 0;
-    areaWidthDots = 0;
-    currentFont = FONT_A;
-    isUnderlineMode = false;
-    currentLineSpacing = -1; // Auto
-    
-    // Clear cache
-    downloadedBitmap.clear();
-    downloadedBitmapWidthBytes = 0;
-    downloadedBitmapHeightBytes = 0;
-    downloadedBitmapExpected = 0;
-    nvImages.clear();
-    nvBuffer.clear();
-    graphicsBuffer = StoredImage();
+    if (clearCaches) {
+        downloadedBitmap.clear();
+        downloadedBitmapWidthBytes = 0;
+        downloadedBitmapHeightBytes = 0;
+        downloadedBitmapExpected = 0;
+        nvBuffer.clear();
+        graphicsBuffer = StoredImage();
+    }
+    // Otherwise keep the downloaded bitmap: printers keep it until power
+    // cycle or a clear command.
 
     currentCodePage = 0; // Default PC437
     currentText = L"";
@@ -224,53 +591,65 @@ void VirtualPrinter::Clear() {
     barcodeHriPos = 0;
     barcodeHriFont = 0;
     barcodeData.clear();
+    barcodeOverflow = false;
     qrModuleSize = 3;
     qrEcLevel = QR_ECC_LOW;
     qrStoredData.clear();
-    if (repaintCallback) repaintCallback(repaintParam);
 }
 
-void VirtualPrinter::ApplyStyle(PrinterElement &el) {
+void PrinterSession::ApplyStyle(PrinterElement &el) {
+    ElementStyle style;
     // ESC E (emphasized) and ESC r (colour) both render red here.
-    el.isRed = isEmphasizedMode || isColorRedMode;
-    el.widthScale = widthScaleMode;
-    el.heightScale = heightScaleMode;
-    el.isReverse = isReverseMode;
-    el.isUpsideDown = isUpsideDownMode;
-    el.isBold = isBoldMode;
-    el.isRotated90 = isRotated90Mode;
-    el.charSpacing = charSpacingDots;
-    el.marginLeft = marginLeftDots;
-    el.areaWidth = areaWidthDots;
-    el.font = currentFont;
-    el.isUnderline = isUnderlineMode;
-    el.align = currentAlign;
-}
-
-std::vector<PrinterElement>& VirtualPrinter::Target() {
+    style.isRed = isEmphasizedMode || isColorRedMode;
+    style.widthScale = widthScaleMode;
+    style.heightScale = heightScaleMode;
+    style.isReverse = isReverseMode;
+    style.isUpsideDown = isUpsideDownMode;
+    style.isBold = isBoldMode;
+    style.isRotated90 = isRotated90Mode;
+    style.charSpacing = charSpacingDots;
+    style.marginLeft = marginLeftDots;
+    style.areaWidth = areaWidthDots;
+    style.font = currentFont;
+    style.isUnderline = isUnderlineMode;
+    style.align = currentAlign;
+    if (style != internedStyle) {
+        internedStyleId = StyleTable::Instance().Intern(style);
+        internedStyle = style;
+    }
+    el.style = internedStyleId;
+}
+
+void PrinterSession::ApplyAlign(PrinterElement &el) {
+    ElementStyle style;
+    style.align = currentAlign;
+    el.style = StyleTable::Instance().Intern(style);
+}
+
+ElementList& PrinterSession::Target() {
     return pageMode ? pageElements : elements;
 }
 
-int VirtualPrinter::CharWidthDots() const {
+int PrinterSession::CharWidthDots() const {
     int base = (currentFont == FONT_B) ? 10 : (currentFont == FONT_C ? 8 : 12);
     return base * widthScaleMode + charSpacingDots;
 }
 
-int VirtualPrinter::CharHeightDots() const {
+int PrinterSession::CharHeightDots() const {
     // Font B is narrower than Font A but stands in a cell just as tall.
     int base = (currentFont == FONT_C) ? 16 : 24;
     return base * heightScaleMode;
 }
 
-int VirtualPrinter::PageFlowLength() const {
+int PrinterSession::PageFlowLength() const {
     // Directions 1 and 3 print along the short axis of the print area, so the
     // room available for a line of text is the area's height, not its width.
     return (pageDirection == 1 || pageDirection == 3) ? pageAreaH : pageAreaW;
 }
 
-void VirtualPrinter::PushElement(PrinterElement& el) {
+void PrinterSession::PushElement(PrinterElement& el) {
     if (!pageMode) {
-        elements.push_back(el);
+        elements.push_back(std::move(el));
         return;
     }
     // In page mode the element keeps the position it was printed at; the print
@@ -279,14 +658,14 @@ void VirtualPrinter::PushElement(PrinterElement& el) {
     el.pageY = pageCursorY;
     el.pageDir = pageDirection;
     if (el.type == ELEMENT_TEXT) {
-        pageCursorX += (int)el.text.length() * CharWidthDots();
+        pageCursorX += (int)el.TextLength() * CharWidthDots();
     } else if (el.type == ELEMENT_BITMAP) {
         pageCursorX += el.width;
     }
-    pageElements.push_back(el);
+    pageElements.push_back(std::move(el));
 }
 
-void VirtualPrinter::EnterPageMode() {
+void PrinterSession::EnterPageMode() {
     if (pageMode) return; // ESC L in page mode does nothing
     FlushSegment();
     pageMode = true;
@@ -296,7 +675,7 @@ void VirtualPrinter::EnterPageMode() {
     currentColumn = 0;
 }
 
-void VirtualPrinter::LeavePageMode(bool print, bool stayInPageMode) {
+void PrinterSession::LeavePageMode(bool print, bool stayInPageMode) {
     if (!pageMode) return;
     FlushSegment();
     if (print && !pageElements.empty()) {
@@ -307,7 +686,7 @@ void VirtualPrinter::LeavePageMode(bool print, bool stayInPageMode) {
         begin.width = pageAreaW;
         begin.height = pageAreaH;
         elements.push_back(begin);
-        elements.insert(elements.end(), pageElements.begin(), pageElements.end());
+        elements.Splice(pageElements);
 
         PrinterElement end;
         end.type = ELEMENT_PAGE_END;
@@ -324,18 +703,19 @@ void VirtualPrinter::LeavePageMode(bool print, bool stayInPageMode) {
     pageMode = stayInPageMode;
 }
 
-void VirtualPrinter::FlushSegment() {
+void PrinterSession::FlushSegment() {
     if (!currentText.empty()) {
         PrinterElement el;
         el.type = ELEMENT_TEXT;
-        el.text = currentText;
+        el.text = Target().AddText(currentText);
+        el.width = (int)currentText.size();
+        currentText.clear();
         ApplyStyle(el);
         PushElement(el);
-        currentText = L"";
     }
 }
 
-void VirtualPrinter::AddSetPos(int dots, bool absolute) {
+void PrinterSession::AddSetPos(int dots, bool absolute) {
     FlushSegment();
     if (pageMode) {
         // ESC $ / ESC \ move along the text flow of the current print
@@ -350,10 +730,10 @@ void VirtualPrinter::AddSetPos(int dots, bool absolute) {
     ApplyStyle(el);
     el.width = dots;
     el.absolutePos = absolute;
-    elements.push_back(el);
+    elements.push_back(std::move(el));
 }
 
-void VirtualPrinter::AddFeed(int dots) {
+void PrinterSession::AddFeed(int dots) {
     FlushSegment();
     if (pageMode) {
         pageCursorY += dots;
@@ -365,11 +745,11 @@ void VirtualPrinter::AddFeed(int dots) {
     el.type = ELEMENT_FEED;
     ApplyStyle(el);
     el.height = dots;
-    elements.push_back(el);
+    elements.push_back(std::move(el));
     currentColumn = 0;
 }
 
-void VirtualPrinter::AddNewLine() {
+void PrinterSession::AddNewLine() {
     FlushSegment();
     if (pageMode) {
         // A line feed in page mode moves down one line inside the print area
@@ -388,20 +768,21 @@ void VirtualPrinter::AddNewLine() {
     } else {
         el.height = 0; // Use default auto logic
     }
-    elements.push_back(el);
+    elements.push_back(std::move(el));
     currentColumn = 0; // Reset column on newline
 }
 
-void VirtualPrinter::AddCutLine() {
+void PrinterSession::AddCutLine() {
     // Cutting is not available in page mode; real printers ignore the command.
     if (pageMode) return;
     FlushSegment();
     PrinterElement el;
     el.type = ELEMENT_CUT;
-    elements.push_back(el);
+    elements.push_back(std::move(el));
+    if (printer.jobPerCut) jobBoundary = true;
 }
 
-void VirtualPrinter::CommitEscStarBand() {
+void PrinterSession::CommitEscStarBand() {
     int columns = escStarColumns;
     int bandHeight = escStarBandHeight;
     int bytesPerCol = escStarBytesPerColumn;
@@ -428,15 +809,15 @@ void VirtualPrinter::CommitEscStarBand() {
     // line, each followed by a line feed. Merge a new band with the immediately
     // preceding band (separated only by that single feed) so the image renders
     // as one contiguous bitmap instead of being sliced by line spacing.
-    std::vector<PrinterElement>& target = Target();
+    ElementList& target = Target();
     if (!pageMode && target.size() >= 2 &&
         target.back().type == ELEMENT_NEWLINE) {
         PrinterElement& prev = target[target.size() - 2];
         if (prev.type == ELEMENT_BITMAP && prev.mergeableBand &&
             !prev.isColumnFormat && prev.width == columns) {
             target.pop_back(); // drop the inter-band newline
-            prev.bitmapData.insert(prev.bitmapData.end(), raster.begin(),
-                                   raster.end());
+            std::vector<unsigned char>& data = target.EditBitmap(prev);
+            data.insert(data.end(), raster.begin(), raster.end());
             prev.height += bandHeight;
             return;
         }
@@ -449,8 +830,8 @@ void VirtualPrinter::CommitEscStarBand() {
             !prev.isColumnFormat && prev.width == columns &&
             prev.pageX == 0 && pageCursorX == 0 &&
             prev.pageY + prev.height <= pageCursorY) {
-            prev.bitmapData.insert(prev.bitmapData.end(), raster.begin(),
-                                   raster.end());
+            std::vector<unsigned char>& data = target.EditBitmap(prev);
+            data.insert(data.end(), raster.begin(), raster.end());
             prev.height += bandHeight;
             pageCursorY = prev.pageY + prev.height;
             return;
@@ -459,16 +840,16 @@ void VirtualPrinter::CommitEscStarBand() {
 
     PrinterElement el;
     el.type = ELEMENT_BITMAP;
-    el.bitmapData = raster;
+    el.bitmap = target.AddBitmap(std::move(raster));
     el.width = columns;
     el.height = bandHeight;
     el.isColumnFormat = false; // already converted to raster above
     el.mergeableBand = true;
-    el.align = currentAlign; // Justification active when the band began
+    ApplyAlign(el); // Justification active when the band began
     PushElement(el);
 }
 
-void VirtualPrinter::CommitBarcode() {
+void PrinterSession::CommitBarcode() {
     FlushSegment();
 
     std::vector<bool> dots;
@@ -511,11 +892,11 @@ void VirtualPrinter::CommitBarcode() {
 
     PrinterElement el;
     el.type = ELEMENT_BITMAP;
-    el.bitmapData = raster;
+    el.bitmap = Target().AddBitmap(std::move(raster));
     el.width = width;
     el.height = height;
     el.isColumnFormat = false;
-    el.align = currentAlign;
+    ApplyAlign(el);
     PushElement(el);
 
     if (hriBelow && !hri.empty()) {
@@ -527,21 +908,21 @@ void VirtualPrinter::CommitBarcode() {
     barcodeData.clear();
 }
 
-void VirtualPrinter::AddBitmapElement(const std::vector<unsigned char> &raster,
+void PrinterSession::AddBitmapElement(const std::vector<unsigned char> &raster,
                                       int widthDots, int heightDots) {
     if (raster.empty() || widthDots <= 0 || heightDots <= 0) return;
     FlushSegment();
     PrinterElement el;
     el.type = ELEMENT_BITMAP;
     ApplyStyle(el);
-    el.bitmapData = raster;
+    el.bitmap = Target().AddBitmap(raster);
     el.width = widthDots;
     el.height = heightDots;
     el.isColumnFormat = false;
     PushElement(el);
 }
 
-void VirtualPrinter::CommitQRCode() {
+void PrinterSession::CommitQRCode() {
     std::vector<std::vector<bool> > matrix;
     if (!EncodeQRCode(qrStoredData, qrEcLevel, matrix) || matrix.empty()) {
         // Too much data for even a version 40 symbol: a real printer prints
@@ -576,7 +957,7 @@ void VirtualPrinter::CommitQRCode() {
     AddBitmapElement(raster, widthDots, widthDots);
 }
 
-void VirtualPrinter::Handle2DCodeCommand() {
+void PrinterSession::Handle2DCodeCommand() {
     // GS ( k pL pH cn fn [parameters], with cn = 49 for QR Code.
     if (parenData.size() < 2) return;
     int cn = parenData[0];
@@ -613,7 +994,7 @@ void VirtualPrinter::Handle2DCodeCommand() {
     }
 }
 
-void VirtualPrinter::PrintStoredImage(const StoredImage &img, int widthScale,
+void PrinterSession::PrintStoredImage(const StoredImage &img, int widthScale,
                                       int heightScale) {
     if (img.raster.empty() || img.widthDots <= 0 || img.heightDots <= 0) return;
     if (widthScale < 1) widthScale = 1;
@@ -647,7 +1028,7 @@ void VirtualPrinter::PrintStoredImage(const StoredImage &img, int widthScale,
     AddBitmapElement(scaled, dstWidth, dstHeight);
 }
 
-void VirtualPrinter::HandleGraphicsCommand() {
+void PrinterSession::HandleGraphicsCommand() {
     // GS ( L pL pH m fn [parameters] - m is 48 for all the functions we draw.
     if (parenData.size() < 2) return;
     int fn = parenData[1];
@@ -680,7 +1061,7 @@ void VirtualPrinter::HandleGraphicsCommand() {
     }
 }
 
-void VirtualPrinter::HandleParenCommand() {
+void PrinterSession::HandleParenCommand() {
     if (parenId == 0x6B) { // 'k' - 2D codes
         Handle2DCodeCommand();
     } else if (parenId == 0x4C) { // 'L' - raster graphics
@@ -689,7 +1070,7 @@ void VirtualPrinter::HandleParenCommand() {
     parenData.clear();
 }
 
-void VirtualPrinter::StoreNvImage() {
+void PrinterSession::StoreNvImage() {
     // FS q stores images column-wise: x bytes across, y bytes down, so the
     // symbol is x*8 dots wide and y*8 tall and each byte holds 8 vertical dots.
     int xBytes = nvHeader[0] + nvHeader[1] * 256;
@@ -717,11 +1098,11 @@ void VirtualPrinter::StoreNvImage() {
             }
         }
     }
-    nvImages.push_back(img);
+    printer.AddNvImage(img);
     nvBuffer.clear();
 }
 
-void VirtualPrinter::SkipBytes(long long n, ParseState next) {
+void PrinterSession::SkipBytes(long long n, ParseState next) {
     if (n > 0) {
         skipRemaining = n;
         skipReturnState = next;
@@ -731,958 +1112,883 @@ void VirtualPrinter::SkipBytes(long long n, ParseState next) {
     }
 }
 
-void VirtualPrinter::BeginLengthSkip(int numLenBytes) {
-    lenBytesRemaining = numLenBytes;
-    lenShift = 0;
-    pendingLen = 0;
-    state = STATE_READ_LEN;
+bool PrinterSession::FitsBuffer(long long bytes) {
+    if (bytes <= (long long)bufferLimit) return true;
+    ++printer.bufferCaps;
+    return false;
 }
 
-void VirtualPrinter::HandleTab() {
-    // Advance to the next tab stop. ESC D installs explicit stops; without them
-    // printers default to every 8 columns.
-    int target = -1;
-    for (size_t i = 0; i < tabStops.size(); ++i) {
-        if (tabStops[i] > currentColumn) {
-            target = tabStops[i];
-            break;
-        }
+void PrinterSession::DispatchCommand(unsigned char prefix, unsigned char cmd) {
+    const CommandSpec *spec = CommandTable::Find(prefix, cmd);
+    if (spec) {
+        BeginCommand(spec);
+    } else {
+        state = STATE_NORMAL;
     }
-    if (target < 0) {
-        // Past the last defined stop (or none defined): fall back to every 8.
-        target = ((currentColumn / 8) + 1) * 8;
+}
+
+void PrinterSession::BeginCommand(const CommandSpec *spec) {
+    activeCommand = spec;
+    cmdParamCount = 0;
+    if (spec->params > 0) {
+        state = STATE_CMD_PARAMS;
+    } else {
+        CommandParamsComplete();
     }
-    if (maxColumns > 0 && target >= maxColumns) {
-        AddNewLine();
-        return;
+}
+
+void PrinterSession::CommandParamsComplete() {
+    if (activeCommand->lenBytes > 0) {
+        lenBytesRemaining = activeCommand->lenBytes;
+        lenShift = 0;
+        pendingLen = 0;
+        state = STATE_CMD_LEN;
+    } else {
+        RunCommand();
     }
-    while (currentColumn < target) {
-        currentText += L' ';
-        currentColumn++;
+}
+
+void PrinterSession::RunCommand() {
+    const CommandSpec *spec = activeCommand;
+    state = STATE_NORMAL;
+    if (spec->handler) {
+        (this->*spec->handler)(cmdParams);
+    } else if (spec->lenBytes > 0) {
+        SkipBytes(pendingLen);
     }
 }
 
-void VirtualPrinter::ProcessData(const unsigned char* data, int length) {
-    if (length <= 0) return;
+// --- ESC commands -------------------------------------------------------------
 
-    {
-        std::lock_guard<std::mutex> lock(mutex);
+void PrinterSession::CmdInitialize(const unsigned char *) {
+    // ESC @ cancels page mode; anything buffered for the page is discarded,
+    // exactly as on a real printer.
+    LeavePageMode(false);
+    pageOriginX = 0;
+    pageOriginY = 0;
+    pageAreaW = 0;
+    pageAreaH = 0;
+    pageDirection = 0;
+    // Reset formatting modes only. On a real printer ESC @ does NOT erase
+    // already-printed paper, so we must not clear `elements` here: legacy jobs
+    // send ESC @ mid-stream (to reset state before the footer) and clearing
+    // would wipe earlier content such as a QR code. Display separation between
+    // print jobs is handled at the connection level.
+    FlushSegment();
+    isEmphasizedMode = false;
+    isColorRedMode = false;
+    widthScaleMode = 1;
+    heightScaleMode = 1;
+    isReverseMode = false;
+    isUpsideDownMode = false;
+    isBoldMode = false;
+    isRotated90Mode = false;
+    charSpacingDots = 0;
+    marginLeftDots = 0;
+    areaWidthDots = 0;
+    currentFont = FONT_A;
+    isUnderlineMode = false;
+    currentLineSpacing = -1;
+    currentAlign = 0; // Left
+    tabStops.clear();
+    barcodeHeight = 162;
+    barcodeModule = 3;
+    barcodeHriPos = 0;
+    barcodeHriFont = 0;
+}
 
+void PrinterSession::CmdEmphasized(const unsigned char *p) {
+    FlushSegment(); // Flush current text with old style
+    isEmphasizedMode = (p[0] & 1) == 1;
+}
 
+void PrinterSession::CmdUnderline(const unsigned char *p) {
+    // n = 0, 48: Off
+    // n = 1, 49: 1-dot width
+    // n = 2, 50: 2-dot width
+    FlushSegment();
+    isUnderlineMode = !(p[0] == 0 || p[0] == 48);
+}
 
-        for (int i = 0; i < length; ++i) {
-            unsigned char b = data[i];
+void PrinterSession::CmdFeedLines(const unsigned char *p) {
+    // n lines to feed
+    FlushSegment();
+    for (int j = 0; j < p[0]; ++j) {
+        AddNewLine();
+    }
+}
 
+void PrinterSession::CmdCodePage(const unsigned char *p) {
+    currentCodePage = p[0];
+}
 
-            
-            switch (state) {
-            case STATE_NORMAL:
-                if (b == 0x0A) { // LF
-                    AddNewLine();
-                }
-                else if (b == 0x0D) { // CR
-                }
-                else if (b == 0x09) { // HT - horizontal tab
-                    HandleTab();
-                }
-                else if (b == 0x0C) { // FF - print the page and leave page mode
-                    // In standard mode FF only matters on label printers
-                    // (feed to the next black mark), so it is ignored there.
-                    LeavePageMode(true);
-                }
-                else if (b == 0x18) { // CAN - discard the page mode buffer
-                    if (pageMode) {
-                        currentText = L"";
-                        pageElements.clear();
-                        pageCursorX = 0;
-                        pageCursorY = 0;
-                    }
-                }
-                else if (b == 0x10) { // DLE - real-time commands
-                    state = STATE_DLE;
-                }
-                else if (b == 0x1B) { // ESC
-                    state = STATE_ESC;
-                }
-                else if (b == 0x1C) { // FS - two-byte command set
-                    state = STATE_FS;
-                }
-                else if (b == 0x1D) { // GS
-                    state = STATE_GS;
-                }
-                else {
-                    // Printable
-                    // Filter out non-printable control codes (0x00-0x1F) that are not handled above
-                    // Included handled: 0x0A (LF), 0x0D (CR), 0x1B (ESC), 0x1D (GS)
-                    // We should definitely ignore 0x00 (NUL)
-                    if (b >= 0x20 || (b > 0x7F && b != 0xFF)) { // 0x80+ are extended chars. 0xFF often ignored?
-                         // In page mode a character that would stick out of the
-                         // print area moves to the next line inside the area
-                         // instead of being printed outside it.
-                         int flowLen = pageMode ? PageFlowLength() : 0;
-                         if (flowLen > 0) {
-                             int used = pageCursorX +
-                                 ((int)currentText.length() + 1) * CharWidthDots();
-                             if (used > flowLen && (pageCursorX > 0 || !currentText.empty())) {
-                                 AddNewLine();
-                             }
-                         }
-                         currentText += MapCodePageChar(b, currentCodePage);
-                         currentColumn++;
-                         // Auto-CRLF if maxColumns is set (standard mode only:
-                         // in page mode the print area does the wrapping)
-                         if (!pageMode && maxColumns > 0 && currentColumn >= maxColumns) {
-                             AddNewLine();
-                         }
-                    }
-                }
-                break;
+void PrinterSession::CmdLineSpacing(const unsigned char *p) {
+    currentLineSpacing = p[0];
+}
 
-            case STATE_ESC:
-                if (b == 0x40) { // @ Initialize
-                    // ESC @ cancels page mode; anything buffered for the page
-                    // is discarded, exactly as on a real printer.
-                    LeavePageMode(false);
-                    pageOriginX = 0;
-                    pageOriginY = 0;
-                    pageAreaW = 0;
-                    pageAreaH = 0;
-                    pageDirection = 0;
-                    // Reset formatting modes only. On a real printer ESC @ does
-                    // NOT erase already-printed paper, so we must not clear
-                    // `elements` here: legacy jobs send ESC @ mid-stream (to
-                    // reset state before the footer) and clearing would wipe
-                    // earlier content such as a QR code. Display separation
-                    // between print jobs is handled at the connection level.
-                    FlushSegment();
-                    isEmphasizedMode = false;
-                    isColorRedMode = false;
-                    widthScaleMode = 1;
-                    heightScaleMode = 1;
-                    isReverseMode = false;
-                    isUpsideDownMode = false;
-                    isBoldMode = false;
-                    isRotated90Mode = false;
-                    charSpacingDots = 0;
-                    marginLeftDots = 0;
-                    areaWidthDots = 0;
-                    currentFont = FONT_A;
-                    isUnderlineMode = false;
-                    currentLineSpacing = -1;
-                    currentAlign = 0; // Left
-                    tabStops.clear();
-                    barcodeHeight = 162;
-                    barcodeModule = 3;
-                    barcodeHriPos = 0;
-                    barcodeHriFont = 0;
-                    state = STATE_NORMAL;
-                }
-                else if (b == 0x45) { // E - Emphasized / Red
-                    state = STATE_ESC_E; 
-                }
-                else if (b == 0x2D) { // - - Underline
-                    state = STATE_ESC_MINUS;
-                }
-                else if (b == 0x64) { // d - Print and feed n lines
-                    state = STATE_ESC_d;
-                }
-                else if (b == 0x74) { // t - Select character code table
-                    state = STATE_ESC_t;
-                }
-                else if (b == 0x63) { // c - Button/Sensor commands
-                    state = STATE_ESC_c;
-                }
-                else if (b == 0x33) { // 3 - Set line spacing n
-                    state = STATE_ESC_3;
-                }
-                else if (b == 0x32) { // 2 - Default line spacing
-                    // ESC 2 usually sets to approx 1/6 inch (approx 30 dots).
-                    currentLineSpacing = 30; 
-                    state = STATE_NORMAL;
-                }
-                else if (b == 0x21) { // ! - Select print mode
-                    state = STATE_ESC_EXCLAMATION;
-                }
-                else if (b == 0x2A) { // * - Select bit image mode (legacy)
-                    state = STATE_ESC_STAR;
-                }
-                else if (b == 0x61) { // a - Select justification
-                    state = STATE_ESC_a;
-                }
-                else if (b == 0x69) { // i - Full cut
-                    AddCutLine();
-                    state = STATE_NORMAL;
-                }
-                else if (b == 0x6D) { // m - Partial cut
-                    AddCutLine();
-                    state = STATE_NORMAL;
-                }
-                else if (b == 0x28) { // ( - ESC ( fn pL pH d1...dk
-                    state = STATE_PAREN_fn;
-                }
-                else if (b == 0x26) { // & - Define user-defined characters
-                    state = STATE_ESC_AMP_y;
-                }
-                else if (b == 0x44) { // D - Set horizontal tab positions
-                    tabStops.clear();
-                    state = STATE_ESC_D;
-                }
-                else if (b == 0x7B) { // { - Upside-down printing
-                    state = STATE_ESC_BRACE;
-                }
-                else if (b == 0x4D) { // M - Select character font
-                    state = STATE_ESC_M;
-                }
-                else if (b == 0x47 || b == 0x67) { // G / g - Double-strike
-                    state = STATE_ESC_G;
-                }
-                else if (b == 0x72) { // r - Select print colour
-                    state = STATE_ESC_r;
-                }
-                else if (b == 0x20) { // SP - Right-side character spacing
-                    state = STATE_ESC_SP;
-                }
-                else if (b == 0x56) { // V - 90 degree clockwise rotation
-                    state = STATE_ESC_V;
-                }
-                else if (b == 0x24) { // $ - Absolute print position
-                    state = STATE_ESC_DOLLAR_nL;
-                }
-                else if (b == 0x5C) { // \ - Relative print position
-                    state = STATE_ESC_BSLASH_nL;
-                }
-                else if (b == 0x4A) { // J - Print and feed n dots
-                    state = STATE_ESC_J;
-                }
-                else if (b == 0x4B) { // K - Print and reverse feed n dots
-                    state = STATE_ESC_K;
-                }
-                else if (b == 0x65) { // e - Print and reverse feed n lines
-                    state = STATE_ESC_e;
-                }
-                else if (b == 0x4C) { // L - Select page mode
-                    EnterPageMode();
-                    state = STATE_NORMAL;
-                }
-                else if (b == 0x53) { // S - Select standard mode
-                    // Leaving page mode this way throws the page buffer away.
-                    LeavePageMode(false);
-                    state = STATE_NORMAL;
-                }
-                else if (b == 0x0C) { // FF - print the page, stay in page mode
-                    LeavePageMode(true, true);
-                    state = STATE_NORMAL;
-                }
-                else if (b == 0x54) { // T - Select print direction in page mode
-                    state = STATE_ESC_T;
-                }
-                else if (b == 0x57) { // W - Set print area in page mode
-                    pendingParams.clear();
-                    state = STATE_ESC_W;
-                }
-                else {
-                    int params = LookupParams(ESC_SKIP,
-                                              sizeof(ESC_SKIP) / sizeof(ESC_SKIP[0]), b);
-                    if (params >= 0) {
-                        SkipBytes(params);
-                    } else {
-                        state = STATE_NORMAL;
-                    }
-                }
-                break;
-            
-            case STATE_ESC_EXCLAMATION:
-                // n parsing
-                // Bit 0: Font B (vs Font A)
-                // Bit 3: Emphasized (Red in our case)
-                // Bit 4: Double Height
-                // Bit 5: Double Width
-                // Bit 7: Underline
-                FlushSegment();
-                currentFont = (b & 0x01) ? FONT_B : FONT_A;
-                isEmphasizedMode = (b & 0x08) != 0;
-                // ESC ! and GS ! drive the same character-size register, so the
-                // last one wins rather than combining.
-                heightScaleMode = (b & 0x10) ? 2 : 1;
-                widthScaleMode = (b & 0x20) ? 2 : 1;
-                isUnderlineMode = (b & 0x80) != 0;
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdDefaultSpacing(const unsigned char *) {
+    // ESC 2 usually sets to approx 1/6 inch (approx 30 dots).
+    currentLineSpacing = 30;
+}
 
-            case STATE_GS_EXCLAMATION:
-                // GS ! n - bits 0-2 are the height multiplier - 1,
-                //          bits 4-6 the width multiplier - 1 (both 1..8).
-                FlushSegment();
-                heightScaleMode = (b & 0x07) + 1;
-                widthScaleMode = ((b >> 4) & 0x07) + 1;
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdPrintMode(const unsigned char *p) {
+    // n parsing
+    // Bit 0: Font B (vs Font A)
+    // Bit 3: Emphasized (Red in our case)
+    // Bit 4: Double Height
+    // Bit 5: Double Width
+    // Bit 7: Underline
+    unsigned char n = p[0];
+    FlushSegment();
+    currentFont = (n & 0x01) ? FONT_B : FONT_A;
+    isEmphasizedMode = (n & 0x08) != 0;
+    // ESC ! and GS ! drive the same character-size register, so the last one
+    // wins rather than combining.
+    heightScaleMode = (n & 0x10) ? 2 : 1;
+    widthScaleMode = (n & 0x20) ? 2 : 1;
+    isUnderlineMode = (n & 0x80) != 0;
+}
 
-            case STATE_GS_B:
-                // GS B n - the least significant bit turns reverse printing on.
-                FlushSegment();
-                isReverseMode = (b & 0x01) != 0;
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdBitImage(const unsigned char *p) {
+    // ESC * m nL nH d1...dk - Select bit image mode.
+    // Legacy applications emit graphics (e.g. QR codes) as a series of these
+    // bands instead of GS v 0 / GS *. Data is column-major.
+    escStarMode = p[0];
+    escStarColumns = p[1] + p[2] * 256; // horizontal dots
+    // Vertical size depends on the mode:
+    //   m = 0, 1  -> 8-dot  density (1 byte per column)
+    //   m = 32,33 -> 24-dot density (3 bytes per column)
+    escStarBytesPerColumn = (escStarMode == 32 || escStarMode == 33) ? 3 : 1;
+    escStarBandHeight = escStarBytesPerColumn * 8;
+    escStarDataExpected = escStarColumns * escStarBytesPerColumn;
+    if (escStarDataExpected <= 0) return;
+    FlushSegment(); // Flush text before graphics
+    if (FitsBuffer(escStarDataExpected)) {
+        escStarData.clear();
+        escStarData.reserve(escStarDataExpected);
+        state = STATE_ESC_STAR_DATA;
+    } else {
+        SkipBytes(escStarDataExpected);
+    }
+}
 
-            case STATE_ESC_BRACE:
-                // ESC { n - the least significant bit turns upside-down mode on.
-                FlushSegment();
-                isUpsideDownMode = (b & 0x01) != 0;
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdJustification(const unsigned char *p) {
+    // Select justification: n = 0/'0' left, 1/'1' center, 2/'2' right
+    if (p[0] == 1 || p[0] == 49) {
+        currentAlign = 1; // Center
+    } else if (p[0] == 2 || p[0] == 50) {
+        currentAlign = 2; // Right
+    } else {
+        currentAlign = 0; // Left
+    }
+}
 
-            case STATE_ESC_M:
-                // ESC M n - 0/48 = Font A, 1/49 = Font B, 2/50 = Font C.
-                FlushSegment();
-                if (b == 1 || b == 49)      currentFont = FONT_B;
-                else if (b == 2 || b == 50) currentFont = FONT_C;
-                else                        currentFont = FONT_A;
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdCut(const unsigned char *) {
+    AddCutLine();
+}
 
-            case STATE_ESC_G:
-                // ESC G n / ESC g n - double-strike, rendered as bold.
-                FlushSegment();
-                isBoldMode = (b & 0x01) != 0;
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdUserChars(const unsigned char *p) {
+    // Characters c1..c2 follow, each as "x d1...d(x*y)".
+    userCharY = p[0];
+    userCharRemaining = (int)p[2] - (int)p[1] + 1;
+    if (userCharRemaining > 0) state = STATE_ESC_AMP_x;
+}
 
-            case STATE_ESC_r:
-                // ESC r n - 0/48 = black, 1/49 = red.
-                FlushSegment();
-                isColorRedMode = (b == 1 || b == 49);
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdTabPositions(const unsigned char *) {
+    tabStops.clear();
+    state = STATE_ESC_D;
+}
 
-            case STATE_ESC_SP:
-                // ESC SP n - extra space to the right of each character, in dots.
-                FlushSegment();
-                charSpacingDots = b;
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdUpsideDown(const unsigned char *p) {
+    // ESC { n - the least significant bit turns upside-down mode on.
+    FlushSegment();
+    isUpsideDownMode = (p[0] & 0x01) != 0;
+}
 
-            case STATE_ESC_V:
-                // ESC V n - rotate each character 90 degrees clockwise.
-                FlushSegment();
-                isRotated90Mode = (b == 1 || b == 49);
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdFont(const unsigned char *p) {
+    // ESC M n - 0/48 = Font A, 1/49 = Font B, 2/50 = Font C.
+    FlushSegment();
+    if (p[0] == 1 || p[0] == 49)      currentFont = FONT_B;
+    else if (p[0] == 2 || p[0] == 50) currentFont = FONT_C;
+    else                              currentFont = FONT_A;
+}
 
-            case STATE_ESC_DOLLAR_nL:
-                pendingParam = b;
-                state = STATE_ESC_DOLLAR_nH;
-                break;
+void PrinterSession::CmdDoubleStrike(const unsigned char *p) {
+    // ESC G n / ESC g n - double-strike, rendered as bold.
+    FlushSegment();
+    isBoldMode = (p[0] & 0x01) != 0;
+}
 
-            case STATE_ESC_DOLLAR_nH:
-                // ESC $ nL nH - absolute position, in dots from the left margin.
-                AddSetPos(pendingParam + b * 256, true);
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdColor(const unsigned char *p) {
+    // ESC r n - 0/48 = black, 1/49 = red.
+    FlushSegment();
+    isColorRedMode = (p[0] == 1 || p[0] == 49);
+}
 
-            case STATE_ESC_BSLASH_nL:
-                pendingParam = b;
-                state = STATE_ESC_BSLASH_nH;
-                break;
+void PrinterSession::CmdCharSpacing(const unsigned char *p) {
+    // ESC SP n - extra space to the right of each character, in dots.
+    FlushSegment();
+    charSpacingDots = p[0];
+}
 
-            case STATE_ESC_BSLASH_nH:
-            {
-                // ESC \ nL nH - relative move; the 16-bit value is signed, so
-                // negative offsets move back towards the left margin.
-                int offset = pendingParam + b * 256;
-                if (offset > 32767) offset -= 65536;
-                AddSetPos(offset, false);
-                state = STATE_NORMAL;
-                break;
-            }
+void PrinterSession::CmdRotate90(const unsigned char *p) {
+    // ESC V n - rotate each character 90 degrees clockwise.
+    FlushSegment();
+    isRotated90Mode = (p[0] == 1 || p[0] == 49);
+}
 
-            case STATE_ESC_J:
-                // ESC J n - print and feed n dots forward.
-                AddFeed(b);
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdAbsolutePos(const unsigned char *p) {
+    // ESC $ nL nH - absolute position, in dots from the left margin.
+    AddSetPos(p[0] + p[1] * 256, true);
+}
 
-            case STATE_ESC_K:
-                // ESC K n - print and feed n dots backwards.
-                AddFeed(-(int)b);
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdRelativePos(const unsigned char *p) {
+    // ESC \ nL nH - relative move; the 16-bit value is signed, so negative
+    // offsets move back towards the left margin.
+    int offset = p[0] + p[1] * 256;
+    if (offset > 32767) offset -= 65536;
+    AddSetPos(offset, false);
+}
 
-            case STATE_ESC_e:
-                // ESC e n - print and feed n lines backwards.
-                FlushSegment();
-                AddFeed(-(int)b * (currentLineSpacing >= 0 ? currentLineSpacing : 30));
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdFeedDots(const unsigned char *p) {
+    // ESC J n - print and feed n dots forward.
+    AddFeed(p[0]);
+}
 
-            case STATE_ESC_T:
-                // ESC T n - print direction in page mode: 0/48 left to right,
-                // 1/49 bottom to top, 2/50 right to left, 3/51 top to bottom.
-                // Changing direction moves the print position back to the
-                // starting corner of the print area.
-                FlushSegment();
-                if (b >= 48) pageDirection = (b - 48) & 0x03;
-                else         pageDirection = b & 0x03;
-                pageCursorX = 0;
-                pageCursorY = 0;
-                currentColumn = 0;
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdReverseDots(const unsigned char *p) {
+    // ESC K n - print and feed n dots backwards.
+    AddFeed(-(int)p[0]);
+}
 
-            case STATE_ESC_W:
-                // ESC W xL xH yL yH dxL dxH dyL dyH - print area in page mode.
-                pendingParams.push_back(b);
-                if (pendingParams.size() >= 8) {
-                    int x  = pendingParams[0] + pendingParams[1] * 256;
-                    int yy = pendingParams[2] + pendingParams[3] * 256;
-                    int dx = pendingParams[4] + pendingParams[5] * 256;
-                    int dy = pendingParams[6] + pendingParams[7] * 256;
-                    pendingParams.clear();
-                    // A zero-sized area is an invalid request and is ignored.
-                    if (dx > 0 && dy > 0) {
-                        FlushSegment();
-                        pageOriginX = x;
-                        pageOriginY = yy;
-                        pageAreaW = dx;
-                        pageAreaH = dy;
-                        pageCursorX = 0;
-                        pageCursorY = 0;
-                        currentColumn = 0;
-                    }
-                    state = STATE_NORMAL;
-                }
-                break;
+void PrinterSession::CmdReverseLines(const unsigned char *p) {
+    // ESC e n - print and feed n lines backwards.
+    FlushSegment();
+    AddFeed(-(int)p[0] * (currentLineSpacing >= 0 ? currentLineSpacing : 30));
+}
 
-            case STATE_GS_DOLLAR_nL:
-                pendingParam = b;
-                state = STATE_GS_DOLLAR_nH;
-                break;
+void PrinterSession::CmdPageMode(const unsigned char *) {
+    EnterPageMode();
+}
 
-            case STATE_GS_DOLLAR_nH:
-                // GS $ nL nH - absolute vertical print position inside the page
-                // area; it has no effect outside page mode.
-                FlushSegment();
-                if (pageMode) {
-                    pageCursorY = pendingParam + b * 256;
-                    currentColumn = 0;
-                }
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdStandardMode(const unsigned char *) {
+    // Leaving page mode this way throws the page buffer away.
+    LeavePageMode(false);
+}
 
-            case STATE_GS_BSLASH_nL:
-                pendingParam = b;
-                state = STATE_GS_BSLASH_nH;
-                break;
+void PrinterSession::CmdPrintPage(const unsigned char *) {
+    // ESC FF - print the page, stay in page mode.
+    LeavePageMode(true, true);
+}
 
-            case STATE_GS_BSLASH_nH:
-            {
-                // GS \ nL nH - relative vertical move; the 16-bit value is
-                // signed, so large values move back up the page.
-                FlushSegment();
-                int offset = pendingParam + b * 256;
-                if (offset > 32767) offset -= 65536;
-                if (pageMode) {
-                    pageCursorY += offset;
-                    if (pageCursorY < 0) pageCursorY = 0;
-                    currentColumn = 0;
-                }
-                state = STATE_NORMAL;
-                break;
-            }
+void PrinterSession::CmdPrintDirection(const unsigned char *p) {
+    // ESC T n - print direction in page mode: 0/48 left to right, 1/49 bottom
+    // to top, 2/50 right to left, 3/51 top to bottom. Changing direction moves
+    // the print position back to the starting corner of the print area.
+    FlushSegment();
+    if (p[0] >= 48) pageDirection = (p[0] - 48) & 0x03;
+    else            pageDirection = p[0] & 0x03;
+    pageCursorX = 0;
+    pageCursorY = 0;
+    currentColumn = 0;
+}
 
-            case STATE_GS_L_nL:
-                pendingParam = b;
-                state = STATE_GS_L_nH;
-                break;
+void PrinterSession::CmdPrintArea(const unsigned char *p) {
+    // ESC W xL xH yL yH dxL dxH dyL dyH - print area in page mode.
+    int x  = p[0] + p[1] * 256;
+    int yy = p[2] + p[3] * 256;
+    int dx = p[4] + p[5] * 256;
+    int dy = p[6] + p[7] * 256;
+    // A zero-sized area is an invalid request and is ignored.
+    if (dx > 0 && dy > 0) {
+        FlushSegment();
+        pageOriginX = x;
+        pageOriginY = yy;
+        pageAreaW = dx;
+        pageAreaH = dy;
+        pageCursorX = 0;
+        pageCursorY = 0;
+        currentColumn = 0;
+    }
+}
 
-            case STATE_GS_L_nH:
-                // GS L nL nH - left margin in dots.
-                FlushSegment();
-                marginLeftDots = pendingParam + b * 256;
-                state = STATE_NORMAL;
-                break;
+// --- GS commands --------------------------------------------------------------
 
-            case STATE_GS_W_nL:
-                pendingParam = b;
-                state = STATE_GS_W_nH;
-                break;
+void PrinterSession::CmdCutPaper(const unsigned char *p) {
+    // Function A: GS V m (0,1,48,49) - direct cut
+    // Function B: GS V m n (65,66) - feed n lines then cut
+    if (p[0] == 65 || p[0] == 66) {
+        BeginCommand(&CommandTable::kFeedAndCut); // Wait for n
+    } else {
+        // Assume Function A or unknown - just cut
+        AddCutLine();
+    }
+}
 
-            case STATE_GS_W_nH:
-                // GS W nL nH - print area width in dots (0 restores the full
-                // paper width).
-                FlushSegment();
-                areaWidthDots = pendingParam + b * 256;
-                state = STATE_NORMAL;
-                break;
-            
-            case STATE_ESC_MINUS:
-                // n = 0, 48: Off
-                // n = 1, 49: 1-dot width
-                // n = 2, 50: 2-dot width
-                FlushSegment();
-                if (b == 0 || b == 48) {
-                    isUnderlineMode = false;
-                } else {
-                    isUnderlineMode = true;
-                }
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdRasterSelect(const unsigned char *p) {
+    if (p[0] == 0x30) { // '0'
+        BeginCommand(&CommandTable::kRasterImage);
+    }
+}
 
-            case STATE_ESC_d:
-                // n lines to feed
-                FlushSegment();
-                for (int j = 0; j < b; ++j) {
-                    AddNewLine();
-                }
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdRasterImage(const unsigned char *p) {
+    bitmapMode = p[0]; // m
+    bitmapWidthBytes = p[1] + p[2] * 256;
+    bitmapHeightDots = p[3] + p[4] * 256;
+
+    // Calculate total bytes expected; up to 4 GB, past an int.
+    long long expected = (long long)bitmapWidthBytes * bitmapHeightDots;
+    if (expected <= 0) return;
+    FlushSegment(); // Flush text before bitmap
+    if (FitsBuffer(expected)) {
+        bitmapDataExpected = (int)expected;
+        currentBitmapData.clear();
+        currentBitmapData.reserve(bitmapDataExpected);
+        state = STATE_GS_v_0_DATA;
+    } else {
+        bitmapDataExpected = 0;
+        SkipBytes(expected);
+    }
+}
 
-            case STATE_ESC_3:
-                // Set line spacing n
-                currentLineSpacing = b;
-                state = STATE_NORMAL;
-                break;
+void PrinterSession::CmdDefineImage(const unsigned char *p) {
+    FlushSegment(); // Flush before consuming data
+    downloadedBitmapWidthBytes = p[0];  // x
+    downloadedBitmapHeightBytes = p[1]; // y
+    // GS * x y d1...dk
+    // x is horizontal byte count.
+    // y = number of vertical bytes (1 to 48) ??
 
-            case STATE_ESC_a:
-                // Select justification: n = 0/'0' left, 1/'1' center, 2/'2' right
-                if (b == 1 || b == 49) {
-                    currentAlign = 1; // Center
-                } else if (b == 2 || b == 50) {
-                    currentAlign = 2; // Right
-                } else {
-                    currentAlign = 0; // Left
-                }
-                state = STATE_NORMAL;
-                break;
+    // Spec says: "Defines a downloaded bit image using x*8 dots in horizontal and y*8 dots in vertical."
+    // Data length k = x * y * 8.
+    downloadedBitmapExpected = downloadedBitmapWidthBytes * downloadedBitmapHeightBytes * 8;
 
-            // ESC * m nL nH d1...dk - Select bit image mode.
-            // Legacy applications emit graphics (e.g. QR codes) as a series of
-            // these bands instead of GS v 0 / GS *. Data is column-major.
-            case STATE_ESC_STAR:
-                escStarMode = b; // m
-                state = STATE_ESC_STAR_nL;
-                break;
+    if (downloadedBitmapExpected <= 0) {
+        return;
+    } else if (FitsBuffer(downloadedBitmapExpected)) {
+        downloadedBitmap.clear();
+        downloadedBitmap.reserve(downloadedBitmapExpected);
+        state = STATE_GS_STAR_DATA;
+    } else {
+        SkipBytes(downloadedBitmapExpected);
+    }
+}
 
-            case STATE_ESC_STAR_nL:
-                escStarColumns = b; // nL
-                state = STATE_ESC_STAR_nH;
-                break;
+void PrinterSession::CmdPrintImage(const unsigned char *) {
+    // GS / m
+    // m values: 0-3, 48-51
+    // We should print the downloadedBitmap if m is valid and bitmap exists.
+    // Standard: 0=Normal, 1=DoubleWidth, 2=DoubleHeight, 3=Quad.
+    FlushSegment(); // Flush preceding text
 
-            case STATE_ESC_STAR_nH:
-                escStarColumns += (b * 256); // + nH*256 = horizontal dots
-                // Vertical size depends on the mode:
-                //   m = 0, 1  -> 8-dot  density (1 byte per column)
-                //   m = 32,33 -> 24-dot density (3 bytes per column)
-                escStarBytesPerColumn =
-                    (escStarMode == 32 || escStarMode == 33) ? 3 : 1;
-                escStarBandHeight = escStarBytesPerColumn * 8;
-                escStarDataExpected = escStarColumns * escStarBytesPerColumn;
-                if (escStarDataExpected > 0) {
-                    FlushSegment(); // Flush text before graphics
-                    escStarData.clear();
-                    escStarData.reserve(escStarDataExpected);
-                    state = STATE_ESC_STAR_DATA;
-                } else {
-                    state = STATE_NORMAL;
-                }
-                break;
+    if (!downloadedBitmap.empty()) {
+        PrinterElement el;
+        el.type = ELEMENT_BITMAP;
 
-            case STATE_ESC_STAR_DATA:
-                escStarData.push_back(b);
-                if ((int)escStarData.size() >= escStarDataExpected) {
-                    CommitEscStarBand();
-                    state = STATE_NORMAL;
-                }
-                break;
+        // Logic to scale?
+        // ELEMENT_BITMAP supports width/height in dots.
+        // If m requests scaling, we handle it here or in display.
+        // For now, let's just dump it 1:1.
 
-            case STATE_ESC_t:
-                // Consume n
-                currentCodePage = b;
-                state = STATE_NORMAL;
-                break;
-            
-            case STATE_ESC_c:
-                // ESC c 0/1 (sheet select), ESC c 3 (paper sensors), ESC c 4
-                // (sensors that stop printing), ESC c 5 (panel buttons).
-                // All of them take a single parameter byte.
-                SkipBytes(1);
-                break;
+        el.bitmap = Target().AddBitmap(downloadedBitmap);
+        el.width = downloadedBitmapWidthBytes * 8;
+        el.height = downloadedBitmapHeightBytes * 8; // Yes, * 8. See GS * above.
+        el.isColumnFormat = true; // Column format (GS *)
+        ApplyAlign(el);
 
-            case STATE_ESC_E:
-                FlushSegment(); // Flush current text with old style
-                isEmphasizedMode = (b & 1) == 1;
-                state = STATE_NORMAL;
-                break;
+        PushElement(el);
+    }
+}
 
-            case STATE_GS:
-                if (b == 0x56) { // V Cut
-                    state = STATE_GS_V;
-                }
-                else if (b == 0x76) { // v Raster Bit Image
-                    state = STATE_GS_v;
-                }
-                else if (b == 0x2A) { // * Define download bit image
-                    FlushSegment(); // Flush before consuming data
-                    state = STATE_GS_STAR;
-                }
-                else if (b == 0x2F) { // / Print download bit image
-                    state = STATE_GS_SLASH;
-                }
-                else if (b == 0x28) { // ( GS ( <id> pL pH d1...dk
-                    state = STATE_GS_PAREN_id;
-                }
-                else if (b == 0x38) { // 8 GS 8 L p1 p2 p3 p4 ... (large graphics)
-                    state = STATE_GS_8;
-                }
-                else if (b == 0x6B) { // k Print barcode
-                    state = STATE_GS_k;
-                }
-                else if (b == 0x68) { // h Set barcode height
-                    state = STATE_GS_h;
+void PrinterSession::CmdParenGroup(const unsigned char *p) {
+    // GS ( <id> pL pH d1...dk. The identifier selects a command group: 'k' is
+    // the 2D code group (QR Code), 'L' the raster graphics group.
+    parenId = p[0];
+    parenExpected = pendingLen;
+    parenData.clear();
+    if (parenExpected <= 0) {
+        return;
+    } else if ((parenId == 0x6B || parenId == 0x4C) &&
+               FitsBuffer(parenExpected)) {
+        // 'k' (2D codes) and 'L' (raster graphics) are drawn, so their
+        // payloads are collected rather than skipped.
+        parenData.reserve((size_t)parenExpected);
+        state = STATE_GS_PAREN_DATA;
+    } else {
+        // Other groups are recognised but not drawn; swallow them.
+        SkipBytes(parenExpected);
+    }
+}
+
+void PrinterSession::CmdLargeGraphics(const unsigned char *p) {
+    // GS 8 L p1 p2 p3 p4 m fn ... - a 32-bit length instead of GS ( L's 16-bit
+    // one. The payload is the same shape as GS ( L, so it is routed through
+    // the same handler.
+    parenId = p[0];
+    parenExpected = pendingLen;
+    parenData.clear();
+    if (parenExpected <= 0) {
+        return;
+    } else if (parenId == 0x4C && FitsBuffer(parenExpected)) {
+        parenData.reserve((size_t)parenExpected);
+        state = STATE_GS_PAREN_DATA;
+    } else {
+        SkipBytes(parenExpected);
+    }
+}
+
+void PrinterSession::CmdBarcode(const unsigned char *p) {
+    // Function A (m = 0..6) is NUL-terminated; function B (m = 65..73) is
+    // preceded by a length byte.
+    // An unrecognised m still has its payload consumed: leaking it into the
+    // text stream is worse than printing nothing.
+    if (p[0] >= 65) {
+        barcodeType = BarcodeTypeFromM(p[0], false);
+        state = STATE_GS_k_n;
+    } else {
+        barcodeType = BarcodeTypeFromM(p[0], true);
+        barcodeData.clear();
+        barcodeOverflow = false;
+        state = STATE_GS_k_DATA_A;
+    }
+}
+
+void PrinterSession::CmdBarcodeHeight(const unsigned char *p) {
+    // GS h n - height in dots
+    barcodeHeight = p[0];
+}
+
+void PrinterSession::CmdBarcodeModule(const unsigned char *p) {
+    // GS w n - narrow element width in dots
+    // n = 2..6 for the standard symbologies; 68..76 select the wider modules
+    // some models offer. Anything else is ignored.
+    if (p[0] >= 2 && p[0] <= 6) barcodeModule = p[0];
+}
+
+void PrinterSession::CmdHriPosition(const unsigned char *p) {
+    // GS H n - HRI position
+    if (p[0] == 1 || p[0] == 49)      barcodeHriPos = 1; // above
+    else if (p[0] == 2 || p[0] == 50) barcodeHriPos = 2; // below
+    else if (p[0] == 3 || p[0] == 51) barcodeHriPos = 3; // both
+    else                              barcodeHriPos = 0; // not printed
+}
+
+void PrinterSession::CmdHriFont(const unsigned char *p) {
+    // GS f n - HRI font
+    barcodeHriFont = p[0];
+}
+
+void PrinterSession::CmdCharSize(const unsigned char *p) {
+    // GS ! n - bits 0-2 are the height multiplier - 1,
+    //          bits 4-6 the width multiplier - 1 (both 1..8).
+    FlushSegment();
+    heightScaleMode = (p[0] & 0x07) + 1;
+    widthScaleMode = ((p[0] >> 4) & 0x07) + 1;
+}
+
+void PrinterSession::CmdReverse(const unsigned char *p) {
+    // GS B n - the least significant bit turns reverse printing on.
+    FlushSegment();
+    isReverseMode = (p[0] & 0x01) != 0;
+}
+
+void PrinterSession::CmdLeftMargin(const unsigned char *p) {
+    // GS L nL nH - left margin in dots.
+    FlushSegment();
+    marginLeftDots = p[0] + p[1] * 256;
+}
+
+void PrinterSession::CmdAreaWidth(const unsigned char *p) {
+    // GS W nL nH - print area width in dots (0 restores the full paper width).
+    FlushSegment();
+    areaWidthDots = p[0] + p[1] * 256;
+}
+
+void PrinterSession::CmdPageAbsoluteY(const unsigned char *p) {
+    // GS $ nL nH - absolute vertical print position inside the page area; it
+    // has no effect outside page mode.
+    FlushSegment();
+    if (pageMode) {
+        pageCursorY = p[0] + p[1] * 256;
+        currentColumn = 0;
+    }
+}
+
+void PrinterSession::CmdPageRelativeY(const unsigned char *p) {
+    // GS \ nL nH - relative vertical move; the 16-bit value is signed, so
+    // large values move back up the page.
+    FlushSegment();
+    int offset = p[0] + p[1] * 256;
+    if (offset > 32767) offset -= 65536;
+    if (pageMode) {
+        pageCursorY += offset;
+        if (pageCursorY < 0) pageCursorY = 0;
+        currentColumn = 0;
+    }
+}
+
+// --- FS and DLE commands ------------------------------------------------------
+
+void PrinterSession::CmdDefineNvImages(const unsigned char *p) {
+    // FS q n [xL xH yL yH d1...dk] * n - redefining the NV images replaces
+    // whatever was stored before.
+    nvImagesRemaining = p[0];
+    nvHeaderIndex = 0;
+    printer.ClearNvImages();
+    nvBuffer.clear();
+    if (nvImagesRemaining > 0) state = STATE_FS_q_HDR;
+}
+
+void PrinterSession::CmdPrintNvImage(const unsigned char *p) {
+    // FS p n m - n selects the stored image, counting from 1.
+    // m: 0/48 normal, 1/49 double width, 2/50 double height, 3/51 quadruple.
+    nvImageIndex = p[0];
+    int mode = (p[1] >= 48) ? p[1] - 48 : p[1];
+    int sx = (mode == 1 || mode == 3) ? 2 : 1;
+    int sy = (mode == 2 || mode == 3) ? 2 : 1;
+    StoredImage img;
+    if (printer.GetNvImage(nvImageIndex, img)) {
+        PrintStoredImage(img, sx, sy);
+    }
+}
+
+void PrinterSession::CmdRealtimeDc4(const unsigned char *p) {
+    // fn = 1: m t (drawer pulse); fn = 2: a b (power off);
+    // fn = 8: d1...d7 (clear buffers).
+    if (p[0] == 1 || p[0] == 2) {
+        SkipBytes(2);
+    } else if (p[0] == 8) {
+        SkipBytes(7);
+    }
+}
+
+void PrinterSession::Reply(const unsigned char *data, size_t length) {
+    if (reply) replyBuffer.insert(replyBuffer.end(), data, data + length);
+}
+
+void PrinterSession::ReportPaperOut() {
+    std::lock_guard<std::mutex> lock(mutex);
+    paperOut = true;
+}
+
+PrinterStatus PrinterSession::Status() {
+    PrinterStatus s = printer.GetStatus();
+    if (paperOut) s.paperNearEnd = s.paperEnd = true;
+    return s;
+}
+
+void PrinterSession::CmdRealtimeStatus(const unsigned char *p) {
+    // n = 7 and 8 (ink) take one more byte and are not answered, as by a
+    // printer without ink.
+    if (p[0] == 7 || p[0] == 8) {
+        SkipBytes(1);
+        return;
+    }
+    unsigned char b = RealtimeStatusByte(Status(), p[0]);
+    if (b) Reply(&b, 1);
+}
+
+void PrinterSession::CmdTransmitStatus(const unsigned char *p) {
+    // n = 1/49: paper sensor; n = 2/50: drawer kick-out connector.
+    PrinterStatus s = Status();
+    unsigned char b;
+    if (p[0] == 1 || p[0] == 49) {
+        b = PaperSensorByte(s);
+    } else if (p[0] == 2 || p[0] == 50) {
+        b = s.drawerOpen ? 0x01 : 0;
+    } else {
+        return;
+    }
+    Reply(&b, 1);
+}
+
+void PrinterSession::CmdTransmitId(const unsigned char *p) {
+    // n = 1..3 (or 49..51): one byte each. n = 65..68: a string, framed by
+    // 0x5F and NUL.
+    PrinterIdentity id = printer.GetIdentity();
+    unsigned char b;
+    const std::string *text = nullptr;
+    switch (p[0]) {
+    case 1: case 49: b = id.modelId; Reply(&b, 1); return;
+    case 2: case 50: b = id.typeId; Reply(&b, 1); return;
+    case 3: case 51: b = id.romVersion; Reply(&b, 1); return;
+    case 65: text = &id.firmware; break;
+    case 66: text = &id.maker; break;
+    case 67: text = &id.model; break;
+    case 68: text = &id.serial; break;
+    default: return;
+    }
+    b = 0x5F;
+    Reply(&b, 1);
+    Reply((const unsigned char *)text->data(), text->size());
+    b = 0;
+    Reply(&b, 1);
+}
+
+void PrinterSession::CmdAsb(const unsigned char *p) {
+    // Enabling any status sends the current one straight away.
+    asbMask = p[0] & 0x0F;
+    if (asbMask) {
+        unsigned char asb[4];
+        AsbBytes(Status(), asb);
+        Reply(asb, sizeof(asb));
+    }
+}
+
+void PrinterSession::CmdDrawerStatus(const unsigned char *) {
+    unsigned char b = Status().drawerOpen ? 0x01 : 0;
+    Reply(&b, 1);
+}
+
+void PrinterSession::CmdPaperStatus(const unsigned char *) {
+    unsigned char b = PaperSensorByte(Status());
+    Reply(&b, 1);
+}
+
+void PrinterSession::HandleTab() {
+    // Advance to the next tab stop. ESC D installs explicit stops; without them
+    // printers default to every 8 columns.
+    int target = -1;
+    for (size_t i = 0; i < tabStops.size(); ++i) {
+        if (tabStops[i] > currentColumn) {
+            target = tabStops[i];
+            break;
+        }
+    }
+    if (target < 0) {
+        // Past the last defined stop (or none defined): fall back to every 8.
+        target = ((currentColumn / 8) + 1) * 8;
+    }
+    if (maxColumns > 0 && target >= maxColumns) {
+        AddNewLine();
+        return;
+    }
+    while (currentColumn < target) {
+        currentText += L' ';
+        currentColumn++;
+    }
+}
+
+void PrinterSession::AppendText(const unsigned char *text, size_t length) {
+    while (length > 0) {
+        size_t take = length;
+        // In page mode a character that would stick out of the print area
+        // moves to the next line inside the area instead of being printed
+        // outside it.
+        int flowLen = pageMode ? PageFlowLength() : 0;
+        if (flowLen > 0) {
+            int charW = CharWidthDots();
+            long long room = (flowLen - pageCursorX) / charW - (long long)currentText.length();
+            if (room <= 0) {
+                if (pageCursorX > 0 || !currentText.empty()) {
+                    AddNewLine();
                 }
-                else if (b == 0x77) { // w Set barcode module width
-                    state = STATE_GS_w;
+                room = flowLen / charW;
+                if (room <= 0) room = 1; // a lone character is printed anyway
+            }
+            if ((size_t)room < take) take = (size_t)room;
+        }
+        // Auto-CRLF if maxColumns is set (standard mode only: in page mode the
+        // print area does the wrapping).
+        bool wrap = !pageMode && maxColumns > 0;
+        if (wrap) {
+            int room = maxColumns - currentColumn;
+            if (room < 1) room = 1;
+            if ((size_t)room < take) take = (size_t)room;
+        }
+
+        // A line with no end in sight is printed in pieces rather than held
+        // whole; one character per byte received.
+        if (currentText.length() >= bufferLimit) {
+            ++printer.bufferCaps;
+            FlushSegment();
+        }
+        if (bufferLimit - currentText.length() < take) {
+            take = bufferLimit - currentText.length();
+        }
+
+        size_t old = currentText.length();
+        currentText.resize(old + take);
+        MapCodePageRun(text, take, currentCodePage, &currentText[old]);
+        currentColumn += (int)take;
+        text += take;
+        length -= take;
+
+        if (wrap && currentColumn >= maxColumns) {
+            AddNewLine();
+        }
+    }
+}
+
+void PrinterSession::ProcessData(const unsigned char* data, int length) {
+    if (length <= 0) return;
+
+    std::vector<unsigned char> replies;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (closed) return;
+
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (jobOpen && JobIdle(now)) EndJob(JOB_END_IDLE);
+        if (!jobOpen) BeginJob();
+        lastActivity = now;
+        int jobStart = 0; // first byte of this chunk that belongs to `job`
+
+        // The column limit is a printer setting that can change while the
+        // connection is open; a new limit starts counting from column 0.
+        int cols = printer.maxColumns.load();
+        if (cols != maxColumns) {
+            maxColumns = cols;
+            currentColumn = 0;
+        }
+
+        for (int i = 0; i < length; ++i) {
+            unsigned char b = data[i];
+
+
+            
+            switch (state) {
+            case STATE_NORMAL:
+                if (b == 0x0A) { // LF
+                    AddNewLine();
                 }
-                else if (b == 0x48) { // H Select HRI print position
-                    state = STATE_GS_H;
+                else if (b == 0x0D) { // CR
                 }
-                else if (b == 0x66) { // f Select HRI font
-                    state = STATE_GS_f;
+                else if (b == 0x09) { // HT - horizontal tab
+                    HandleTab();
                 }
-                else if (b == 0x21) { // ! Select character size
-                    state = STATE_GS_EXCLAMATION;
+                else if (b == 0x0C) { // FF - print the page and leave page mode
+                    // In standard mode FF only matters on label printers
+                    // (feed to the next black mark), so it is ignored there.
+                    LeavePageMode(true);
                 }
-                else if (b == 0x42) { // B Reverse (white on black) printing
-                    state = STATE_GS_B;
+                else if (b == 0x18) { // CAN - discard the page mode buffer
+                    if (pageMode) {
+                        currentText = L"";
+                        pageElements.clear();
+                        pageCursorX = 0;
+                        pageCursorY = 0;
+                    }
                 }
-                else if (b == 0x4C) { // L Set left margin
-                    state = STATE_GS_L_nL;
+                else if (b == 0x10) { // DLE - real-time commands
+                    state = STATE_DLE;
                 }
-                else if (b == 0x57) { // W Set print area width
-                    state = STATE_GS_W_nL;
+                else if (b == 0x1B) { // ESC
+                    state = STATE_ESC;
                 }
-                else if (b == 0x24) { // $ Absolute vertical position (page mode)
-                    state = STATE_GS_DOLLAR_nL;
+                else if (b == 0x1C) { // FS - two-byte command set
+                    state = STATE_FS;
                 }
-                else if (b == 0x5C) { // \ Relative vertical position (page mode)
-                    state = STATE_GS_BSLASH_nL;
+                else if (b == 0x1D) { // GS
+                    state = STATE_GS;
                 }
-                else {
-                    int params = LookupParams(GS_SKIP,
-                                              sizeof(GS_SKIP) / sizeof(GS_SKIP[0]), b);
-                    if (params >= 0) {
-                        SkipBytes(params);
-                    } else {
-                        state = STATE_NORMAL;
-                    }
+                else if (b >= 0x20) {
+                    // Printable: take the whole run up to the next control
+                    // byte in one go. Anything else below 0x20 (NUL, CR, ...)
+                    // is not handled above and is dropped.
+                    size_t run = ScanPrintable(data + i, (size_t)(length - i));
+                    AppendText(data + i, run);
+                    i += (int)run - 1;
                 }
                 break;
 
-            case STATE_GS_V:
-                // Function A: GS V m (0,1,48,49) - direct cut
-                // Function B: GS V m n (65,66) - feed n lines then cut
-                if (b == 65 || b == 66) {
-                    state = STATE_GS_V_n; // Wait for n
-                } else {
-                    // Assume Function A or unknown - just cut
-                    AddCutLine();
-                    state = STATE_NORMAL;
-                }
+            case STATE_ESC:
+            case STATE_GS:
+            case STATE_FS:
+            case STATE_DLE:
+                DispatchCommand(state == STATE_ESC ? ESC :
+                                state == STATE_GS  ? GS  :
+                                state == STATE_FS  ? FS  : DLE, b);
                 break;
 
-            case STATE_GS_V_n:
-                // Consumed n (feed amount)
-                AddCutLine();
-                state = STATE_NORMAL;
-                break;
+            // --- Command parameters --------------------------------------
 
-            case STATE_GS_v:
-                if (b == 0x30) { // '0'
-                    state = STATE_GS_v_0;
-                }
-                else {
-                    state = STATE_NORMAL;
+            case STATE_CMD_PARAMS:
+                cmdParams[cmdParamCount++] = b;
+                if (cmdParamCount >= activeCommand->params) {
+                    CommandParamsComplete();
                 }
                 break;
 
-            case STATE_GS_v_0:
-                bitmapMode = b; // m
-                state = STATE_GS_v_0_xL;
-                break;
-
-            case STATE_GS_v_0_xL:
-                bitmapWidthBytes = b;
-                state = STATE_GS_v_0_xH;
+            case STATE_CMD_LEN:
+                pendingLen |= ((long long)b) << lenShift;
+                lenShift += 8;
+                if (--lenBytesRemaining <= 0) {
+                    RunCommand();
+                }
                 break;
 
-            case STATE_GS_v_0_xH:
-                bitmapWidthBytes += (b * 256);
-                state = STATE_GS_v_0_yL;
+            case STATE_SKIP_N:
+            {
+                // The whole rest of the skip, or of this chunk, in one step.
+                long long n = length - i;
+                if (skipRemaining < n) n = skipRemaining;
+                skipRemaining -= n;
+                i += (int)n - 1;
+                if (skipRemaining <= 0) state = skipReturnState;
                 break;
+            }
 
-            case STATE_GS_v_0_yL:
-                bitmapHeightDots = b;
-                state = STATE_GS_v_0_yH;
-                break;
+            // --- Payloads ------------------------------------------------
 
-            case STATE_GS_v_0_yH:
-                bitmapHeightDots += (b * 256);
-                
-                // Calculate total bytes expected
-                bitmapDataExpected = bitmapWidthBytes * bitmapHeightDots;
-                
-                if (bitmapDataExpected > 0) {
-                    FlushSegment(); // Flush text before bitmap
-                    currentBitmapData.clear();
-                    currentBitmapData.reserve(bitmapDataExpected);
-                    state = STATE_GS_v_0_DATA;
-                } else {
+            case STATE_ESC_STAR_DATA:
+                i += (int)TakePayload(escStarData, escStarDataExpected, data + i,
+                                      (size_t)(length - i)) - 1;
+                if ((int)escStarData.size() >= escStarDataExpected) {
+                    CommitEscStarBand();
                     state = STATE_NORMAL;
                 }
                 break;
 
             case STATE_GS_v_0_DATA:
-                currentBitmapData.push_back(b);
+                i += (int)TakePayload(currentBitmapData, bitmapDataExpected, data + i,
+                                      (size_t)(length - i)) - 1;
                 if (currentBitmapData.size() >= (size_t)bitmapDataExpected) {
                     // All data received
                     PrinterElement el;
                     el.type = ELEMENT_BITMAP;
-                    el.bitmapData = currentBitmapData; // Copy
+                    // Handed over rather than copied: the next GS v 0
+                    // clears the buffer before it collects again.
+                    el.bitmap = Target().AddBitmap(std::move(currentBitmapData));
                     el.width = bitmapWidthBytes * 8; // Width in dots
                     el.height = bitmapHeightDots;
                     el.isColumnFormat = false; // Raster format (GS v 0)
-                    el.align = currentAlign;
-                    PushElement(el);
-
-                    state = STATE_NORMAL;
-                }
-                break;
-
-            case STATE_GS_SLASH:
-            {
-                // GS / m
-                // m values: 0-3, 48-51
-                // We should print the downloadedBitmap if m is valid and bitmap exists.
-                // Standard: 0=Normal, 1=DoubleWidth, 2=DoubleHeight, 3=Quad.
-                FlushSegment(); // Flush preceding text
-                
-                if (!downloadedBitmap.empty()) {
-                    PrinterElement el;
-                    el.type = ELEMENT_BITMAP;
-                    
-                    // Logic to scale? 
-                    // ELEMENT_BITMAP supports width/height in dots.
-                    // If m requests scaling, we handle it here or in display.
-                    // For now, let's just dump it 1:1.
-                    
-                    el.bitmapData = downloadedBitmap;
-                    el.width = downloadedBitmapWidthBytes * 8;
-                    el.height = downloadedBitmapHeightBytes * 8; // Yes, * 8. See GS * below.
-                    el.isColumnFormat = true; // Column format (GS *)
-                    el.align = currentAlign;
-
+                    ApplyAlign(el);
                     PushElement(el);
-                }
-                
-                state = STATE_NORMAL;
-                break;
-            }
-
-            case STATE_GS_STAR:
-                downloadedBitmapWidthBytes = b; // x
-                state = STATE_GS_STAR_y;
-                break;
 
-            case STATE_GS_STAR_y:
-                downloadedBitmapHeightBytes = b; // y
-                // Calculate expected data size
-                // GS * x y d1...dk
-                // x is horizontal byte count.
-                // y = number of vertical bytes (1 to 48) ??
-                
-                // Spec says: "Defines a downloaded bit image using x*8 dots in horizontal and y*8 dots in vertical."
-                // Data length k = x * y * 8.
-                downloadedBitmapExpected = downloadedBitmapWidthBytes * downloadedBitmapHeightBytes * 8;
-                
-                if (downloadedBitmapExpected > 0) {
-                    downloadedBitmap.clear();
-                    downloadedBitmap.reserve(downloadedBitmapExpected);
-                    state = STATE_GS_STAR_DATA;
-                } else {
                     state = STATE_NORMAL;
                 }
                 break;
 
             case STATE_GS_STAR_DATA:
-                downloadedBitmap.push_back(b);
+                i += (int)TakePayload(downloadedBitmap, downloadedBitmapExpected, data + i,
+                                      (size_t)(length - i)) - 1;
                 if (downloadedBitmap.size() >= (size_t)downloadedBitmapExpected) {
                     state = STATE_NORMAL;
                 }
                 break;
 
-            // --- Generic parameter consumption -----------------------------
-
-            case STATE_SKIP_N:
-                if (--skipRemaining <= 0) state = skipReturnState;
-                break;
-
-            case STATE_READ_LEN:
-                pendingLen |= ((long long)b) << lenShift;
-                lenShift += 8;
-                if (--lenBytesRemaining <= 0) {
-                    SkipBytes(pendingLen);
-                }
-                break;
-
-            case STATE_PAREN_fn:
-                // ESC ( fn pL pH d1...dk - none of these are drawn, so the
-                // payload is only consumed.
-                BeginLengthSkip(2);
-                break;
-
-            case STATE_GS_PAREN_id:
-                parenId = b;
-                state = STATE_GS_PAREN_pL;
-                break;
-
-            case STATE_GS_PAREN_pL:
-                pendingParam = b;
-                state = STATE_GS_PAREN_pH;
-                break;
-
-            case STATE_GS_PAREN_pH:
-            {
-                parenExpected = pendingParam + b * 256;
-                parenData.clear();
-                if (parenExpected <= 0) {
-                    state = STATE_NORMAL;
-                } else if ((parenId == 0x6B || parenId == 0x4C) &&
-                           parenExpected <= MAX_IMAGE_BYTES) {
-                    // 'k' (2D codes) and 'L' (raster graphics) are drawn, so
-                    // their payloads are collected rather than skipped.
-                    parenData.reserve((size_t)parenExpected);
-                    state = STATE_GS_PAREN_DATA;
-                } else {
-                    // Other groups are recognised but not drawn; swallow them.
-                    SkipBytes(parenExpected);
-                }
-                break;
-            }
-
             case STATE_GS_PAREN_DATA:
-                parenData.push_back(b);
+                i += (int)TakePayload(parenData, parenExpected, data + i,
+                                      (size_t)(length - i)) - 1;
                 if ((long long)parenData.size() >= parenExpected) {
                     HandleParenCommand();
                     state = STATE_NORMAL;
                 }
                 break;
 
-            case STATE_GS_8:
-                // GS 8 L p1 p2 p3 p4 m fn ... - the identifier is consumed
-                // here; the four following bytes are a 32-bit little-endian
-                // length. The payload is the same shape as GS ( L, so it is
-                // routed through the same handler.
-                parenId = b;
-                lenBytesRemaining = 4;
-                lenShift = 0;
-                pendingLen = 0;
-                state = STATE_GS_8_LEN;
-                break;
-
-            case STATE_GS_8_LEN:
-                pendingLen |= ((long long)b) << lenShift;
-                lenShift += 8;
-                if (--lenBytesRemaining <= 0) {
-                    parenExpected = pendingLen;
-                    parenData.clear();
-                    if (parenExpected <= 0) {
-                        state = STATE_NORMAL;
-                    } else if (parenId == 0x4C && parenExpected <= MAX_IMAGE_BYTES) {
-                        parenData.reserve((size_t)parenExpected);
-                        state = STATE_GS_PAREN_DATA;
-                    } else {
-                        SkipBytes(parenExpected);
-                    }
-                }
-                break;
-
-            case STATE_ESC_AMP_y:
-                userCharY = b;
-                state = STATE_ESC_AMP_c1;
-                break;
-
-            case STATE_ESC_AMP_c1:
-                userCharRemaining = b; // holds c1 until c2 arrives
-                state = STATE_ESC_AMP_c2;
-                break;
-
-            case STATE_ESC_AMP_c2:
-                // Characters c1..c2 follow, each as "x d1...d(x*y)".
-                userCharRemaining = (int)b - userCharRemaining + 1;
-                state = (userCharRemaining > 0) ? STATE_ESC_AMP_x : STATE_NORMAL;
-                break;
-
-            case STATE_ESC_AMP_x:
-                userCharRemaining--;
-                SkipBytes((long long)b * userCharY,
-                          userCharRemaining > 0 ? STATE_ESC_AMP_x : STATE_NORMAL);
-                break;
-
-            case STATE_ESC_D:
-                // ESC D n1...nk NUL - tab stop columns, terminated by NUL.
-                if (b == 0x00) {
-                    state = STATE_NORMAL;
-                } else if (tabStops.size() < 32) {
-                    tabStops.push_back(b);
-                }
-                break;
-
-            case STATE_DLE:
-                if (b == 0x04 || b == 0x05) { // DLE EOT n / DLE ENQ n
-                    SkipBytes(1);
-                } else if (b == 0x14) { // DLE DC4 fn ...
-                    state = STATE_DLE_DC4;
-                } else {
-                    state = STATE_NORMAL;
-                }
-                break;
-
-            case STATE_DLE_DC4:
-                // fn = 1: m t (drawer pulse); fn = 2: a b (power off);
-                // fn = 8: d1...d7 (clear buffers).
-                if (b == 1 || b == 2) {
-                    SkipBytes(2);
-                } else if (b == 8) {
-                    SkipBytes(7);
-                } else {
-                    state = STATE_NORMAL;
-                }
-                break;
-
-            case STATE_FS:
-                if (b == 0x71) { // q - define NV bit images
-                    state = STATE_FS_q_n;
-                } else if (b == 0x70) { // p - print NV bit image
-                    state = STATE_FS_p_n;
-                } else {
-                    int params = LookupParams(FS_SKIP,
-                                              sizeof(FS_SKIP) / sizeof(FS_SKIP[0]), b);
-                    if (params >= 0) {
-                        SkipBytes(params);
-                    } else {
-                        state = STATE_NORMAL;
-                    }
-                }
+            case STATE_ESC_AMP_x:
+                userCharRemaining--;
+                SkipBytes((long long)b * userCharY,
+                          userCharRemaining > 0 ? STATE_ESC_AMP_x : STATE_NORMAL);
                 break;
 
-            case STATE_FS_q_n:
-                // FS q n [xL xH yL yH d1...dk] * n - redefining the NV images
-                // replaces whatever was stored before.
-                nvImagesRemaining = b;
-                nvHeaderIndex = 0;
-                nvImages.clear();
-                nvBuffer.clear();
-                state = (nvImagesRemaining > 0) ? STATE_FS_q_HDR : STATE_NORMAL;
+            case STATE_ESC_D:
+                // ESC D n1...nk NUL - tab stop columns, terminated by NUL.
+                if (b == 0x00) {
+                    state = STATE_NORMAL;
+                } else if (tabStops.size() < 32) {
+                    tabStops.push_back(b);
+                }
                 break;
 
             case STATE_FS_q_HDR:
@@ -1693,7 +1999,7 @@ void VirtualPrinter::ProcessData(const unsigned char* data, int length) {
                     nvHeaderIndex = 0;
                     nvExpected = xBytes * yBytes * 8;
                     nvImagesRemaining--;
-                    if (nvExpected > 0 && nvExpected <= MAX_IMAGE_BYTES) {
+                    if (nvExpected > 0 && FitsBuffer(nvExpected)) {
                         nvBuffer.clear();
                         nvBuffer.reserve((size_t)nvExpected);
                         state = STATE_FS_q_DATA;
@@ -1706,81 +2012,30 @@ void VirtualPrinter::ProcessData(const unsigned char* data, int length) {
                 break;
 
             case STATE_FS_q_DATA:
-                nvBuffer.push_back(b);
+                i += (int)TakePayload(nvBuffer, nvExpected, data + i,
+                                      (size_t)(length - i)) - 1;
                 if ((long long)nvBuffer.size() >= nvExpected) {
                     StoreNvImage();
                     state = (nvImagesRemaining > 0) ? STATE_FS_q_HDR : STATE_NORMAL;
                 }
                 break;
 
-            case STATE_FS_p_n:
-                // FS p n m - n selects the stored image, counting from 1.
-                nvImageIndex = b;
-                state = STATE_FS_p_m;
-                break;
-
-            case STATE_FS_p_m:
-            {
-                // m: 0/48 normal, 1/49 double width, 2/50 double height,
-                // 3/51 quadruple.
-                int mode = (b >= 48) ? b - 48 : b;
-                int sx = (mode == 1 || mode == 3) ? 2 : 1;
-                int sy = (mode == 2 || mode == 3) ? 2 : 1;
-                if (nvImageIndex >= 1 && nvImageIndex <= (int)nvImages.size()) {
-                    PrintStoredImage(nvImages[nvImageIndex - 1], sx, sy);
-                }
-                state = STATE_NORMAL;
-                break;
-            }
-
             // --- Barcodes ---------------------------------------------------
 
-            case STATE_GS_h: // GS h n - height in dots
-                barcodeHeight = b;
-                state = STATE_NORMAL;
-                break;
-
-            case STATE_GS_w: // GS w n - narrow element width in dots
-                // n = 2..6 for the standard symbologies; 68..76 select the
-                // wider modules some models offer. Anything else is ignored.
-                if (b >= 2 && b <= 6) barcodeModule = b;
-                state = STATE_NORMAL;
-                break;
-
-            case STATE_GS_H: // GS H n - HRI position
-                if (b == 1 || b == 49)      barcodeHriPos = 1; // above
-                else if (b == 2 || b == 50) barcodeHriPos = 2; // below
-                else if (b == 3 || b == 51) barcodeHriPos = 3; // both
-                else                        barcodeHriPos = 0; // not printed
-                state = STATE_NORMAL;
-                break;
-
-            case STATE_GS_f: // GS f n - HRI font
-                barcodeHriFont = b;
-                state = STATE_NORMAL;
-                break;
-
-            case STATE_GS_k:
-                // Function A (m = 0..6) is NUL-terminated; function B
-                // (m = 65..73) is preceded by a length byte.
-                // An unrecognised m still has its payload consumed: leaking it
-                // into the text stream is worse than printing nothing.
-                if (b >= 65) {
-                    barcodeType = BarcodeTypeFromM(b, false);
-                    state = STATE_GS_k_n;
-                } else {
-                    barcodeType = BarcodeTypeFromM(b, true);
-                    barcodeData.clear();
-                    state = STATE_GS_k_DATA_A;
-                }
-                break;
-
             case STATE_GS_k_DATA_A:
                 if (b == 0x00) {
-                    CommitBarcode();
+                    // Too long for any symbol: consumed, but not printed.
+                    if (barcodeOverflow) {
+                        barcodeData.clear();
+                    } else {
+                        CommitBarcode();
+                    }
                     state = STATE_NORMAL;
-                } else {
+                } else if (barcodeData.size() < bufferLimit) {
                     barcodeData.push_back(b);
+                } else if (!barcodeOverflow) {
+                    barcodeOverflow = true;
+                    ++printer.bufferCaps;
                 }
                 break;
 
@@ -1803,22 +2058,196 @@ void VirtualPrinter::ProcessData(const unsigned char* data, int length) {
                 }
                 break;
             }
+
+            if (jobBoundary) {
+                // The cut is the job's last byte; what follows is a new job.
+                jobBoundary = false;
+                job.bytes += i + 1 - jobStart;
+                jobStart = i + 1;
+                EndJob(JOB_END_CUT);
+                BeginJob();
+            }
         }
+        job.bytes += length - jobStart;
+        CountMotion();
+        replies.swap(replyBuffer);
     }
+    // Status replies go out before the paper is repainted: a client waiting
+    // for one is held up by nothing else.
+    if (!replies.empty()) reply(replies.data(), (int)replies.size());
 
     // Trigger repaint
-    if (repaintCallback) repaintCallback(repaintParam);
+    printer.Repaint();
 }
 
-std::vector<PrinterElement> VirtualPrinter::GetElements() {
-    std::lock_guard<std::mutex> lock(mutex);
-    std::vector<PrinterElement> result = elements;
+int PrinterSession::Feed(const unsigned char* data, int length) {
+    if (length <= 0) return 0;
+    if (!input) {
+        size_t ringBytes = printer.GetProfile().receiveBufferBytes;
+        std::lock_guard<std::mutex> lock(mutex); // against GetIngestStats()
+        input.reset(new SpscRing(ringBytes > 0 ? ringBytes : INPUT_RING_BYTES));
+    }
+    size_t n = input->Write(data, (size_t)length);
+    if (n < (size_t)length) {
+        // Full. Asked for before trying once more, so that room the parser
+        // makes in between is either seen here or signalled.
+        ++printer.ingestStalls;
+        wantsRoom = true;
+        n += input->Write(data + n, (size_t)length - n);
+        if (n == (size_t)length) wantsRoom = false;
+    }
+    if (n > 0) {
+        size_t used = input->Size();
+        size_t peak = printer.ingestPeak.load();
+        while (used > peak && !printer.ingestPeak.compare_exchange_weak(peak, used)) {}
+        ScheduleInput();
+    }
+    return (int)n;
+}
+
+void PrinterSession::ScheduleInput() {
+    if (inputQueued.exchange(true)) return; // the parser will get to it
+    {
+        std::lock_guard<std::mutex> lock(printer.parseMutex);
+        printer.parseQueue.push_back(this);
+        if (!printer.parseThread.joinable()) {
+            printer.parseThread = std::thread(&VirtualPrinter::ParseLoop, &printer);
+        }
+    }
+    printer.parseReady.notify_one();
+}
+
+void PrinterSession::Close() {
+    if (input) {
+        // What was fed is part of the job. Rather than hold up the
+        // connection's thread until it is parsed, leave the commit to the
+        // parser thread.
+        std::lock_guard<std::mutex> lock(printer.parseMutex);
+        if ((input->Size() > 0 || inputQueued || inputParsing) && !printer.parseStop) {
+            closing = true;
+            return;
+        }
+    }
+    printer.CommitSession(this);
+}
+
+void PrinterSession::BeginJob() {
+    job = PrintJob();
+    job.id = printer.nextJobId++;
+    job.started = std::chrono::system_clock::now();
+    jobOpen = true;
+}
+
+void PrinterSession::EndJob(JobEndReason reason) {
+    FlushSegment();
+    CountMotion();
+    job.ended = std::chrono::system_clock::now();
+    job.endReason = reason;
+    jobOpen = false;
+    // A connection that opened and closed without a byte (a port scan, a
+    // status probe) did not print anything worth a job.
+    if (job.bytes > 0 || !elements.empty()) printer.CommitJob(*this, job);
+    motionCounted = 0; // the elements went with the job
+}
+
+void PrinterSession::CountMotion() {
+    bool rasterArriving = state == STATE_GS_v_0_DATA && bitmapWidthBytes > 0;
+    if (motionCounted >= elements.size() && !rasterArriving) return;
+    PrinterProfile profile = printer.GetProfile();
+    if (profile.printSpeedMmPerSec <= 0) {
+        motionCounted = elements.size();
+        motionAheadDots = 0;
+        return;
+    }
+    long long dots = 0;
+    long long extraMs = 0;
+    bool inPage = false; // a page is spliced in whole, never split by a call
+    for (; motionCounted < elements.size(); ++motionCounted) {
+        const PrinterElement &el = elements[motionCounted];
+        if (inPage) {
+            // The page moves the paper as a whole, by its print area.
+            inPage = el.type != ELEMENT_PAGE_END;
+            continue;
+        }
+        switch (el.type) {
+        case ELEMENT_TEXT: {
+            const ElementStyle &style = el.Style();
+            int cell = style.font == FONT_C ? 16 : 24;
+            motionLineDots = std::max(motionLineDots, cell * style.heightScale);
+            break;
+        }
+        case ELEMENT_NEWLINE:
+            // A line is at least as tall as what is printed on it.
+            dots += std::max(el.height > 0 ? el.height : DEFAULT_LINE_DOTS,
+                             motionLineDots);
+            extraMs += profile.lineFeedMs;
+            motionLineDots = 0;
+            break;
+        case ELEMENT_FEED:
+            dots += el.height < 0 ? -el.height : el.height;
+            break;
+        case ELEMENT_BITMAP:
+            // An ESC * band is printed on the line; its line feed moves it.
+            if (el.mergeableBand) {
+                motionLineDots = std::max(motionLineDots, el.height);
+            } else {
+                dots += std::max(el.height - motionAheadDots, 0);
+                motionAheadDots = 0;
+            }
+            break;
+        case ELEMENT_CUT:
+            extraMs += profile.cutMs;
+            break;
+        case ELEMENT_PAGE_BEGIN:
+            dots += el.height;
+            inPage = true;
+            break;
+        default:
+            break;
+        }
+    }
+    if (rasterArriving) {
+        int rows = (int)(currentBitmapData.size() / bitmapWidthBytes);
+        dots += rows - motionAheadDots;
+        motionAheadDots = rows;
+    }
+
+    long long us = dots * 1000000 / ((long long)profile.printSpeedMmPerSec * DOTS_PER_MM) +
+                   extraMs * 1000;
+    job.printMicros += us;
+    if (us > 0 && printer.throttled) {
+        // The mechanism takes on the motion when it is done with what it had.
+        long long now = SteadyMicros();
+        long long busy = printer.mechanismFreeUs.load();
+        while (!printer.mechanismFreeUs.compare_exchange_weak(
+                   busy, std::max(busy, now) + us)) {}
+    }
+}
+
+bool PrinterSession::JobIdle(std::chrono::steady_clock::time_point now) const {
+    int idleMs = printer.jobIdleMs;
+    return jobOpen && idleMs > 0 && job.bytes > 0 &&
+           now - lastActivity > std::chrono::milliseconds(idleMs);
+}
+
+void PrinterSession::Finish() {
+    FlushSegment();
+    // A page that was never printed with FF is shown while the job runs, so
+    // it is printed rather than lost when the job ends.
+    LeavePageMode(true);
+    state = STATE_NORMAL;
+    closed = true;
+}
+
+void PrinterSession::AppendLiveElements(ElementList &result) {
+    for (size_t i = 0; i < elements.size(); ++i) result.CopyElement(elements[i]);
 
     PrinterElement pending;
     bool hasPending = false;
     if (!currentText.empty()) {
         pending.type = ELEMENT_TEXT;
-        pending.text = currentText;
+        pending.text = result.AddText(currentText);
+        pending.width = (int)currentText.size();
         ApplyStyle(pending);
         hasPending = true;
     }
@@ -1833,7 +2262,9 @@ std::vector<PrinterElement> VirtualPrinter::GetElements() {
         begin.width = pageAreaW;
         begin.height = pageAreaH;
         result.push_back(begin);
-        result.insert(result.end(), pageElements.begin(), pageElements.end());
+        for (size_t i = 0; i < pageElements.size(); ++i) {
+            result.CopyElement(pageElements[i]);
+        }
         if (hasPending) {
             pending.pageX = pageCursorX;
             pending.pageY = pageCursorY;
@@ -1847,21 +2278,604 @@ std::vector<PrinterElement> VirtualPrinter::GetElements() {
         end.width = pageAreaW;
         end.height = pageAreaH;
         result.push_back(end);
-        return result;
+        return;
     }
 
     // Append pending text as a temporary element so it's visible
     if (hasPending) result.push_back(pending);
+}
+
+// ---------------------------------------------------------------------------
+// VirtualPrinter
+// ---------------------------------------------------------------------------
+
+VirtualPrinter::VirtualPrinter() {
+    repaintCallback = nullptr;
+    repaintParam = nullptr;
+    parseStop = false;
+    ingestPeak = 0;
+    ingestStalls = 0;
+    sessionBufferLimit = (size_t)MAX_IMAGE_BYTES;
+    bufferCaps = 0;
+    mechanismFreeUs = 0;
+    throttled = false;
+    notifyStop = false;
+    repaintPending = false;
+    frameIntervalMs = DEFAULT_FRAME_INTERVAL_MS;
+    maxColumns = 0;
+    jobIdleMs = DEFAULT_JOB_IDLE_MS;
+    jobPerCut = false;
+    nextJobId = 1;
+    paperGeneration = 0;
+    jobsDropped = 0;
+    jobsEvicted = 0;
+    paperBytes = 0;
+    maxJobs = 0;
+    maxPaperBytes = 0;
+    maxJobAgeSeconds = 0;
+    archive.reset(new PaperArchive());
+    NewRoll();
+    localSession = std::make_shared<PrinterSession>(*this);
+    sessions.push_back(localSession);
+}
+
+VirtualPrinter::~VirtualPrinter() {
+    {
+        std::lock_guard<std::mutex> lock(parseMutex);
+        parseStop = true;
+    }
+    parseReady.notify_one();
+    if (parseThread.joinable()) parseThread.join();
+    {
+        std::lock_guard<std::mutex> lock(notifyMutex);
+        notifyStop = true;
+    }
+    notifyChanged.notify_one();
+    if (notifyThread.joinable()) notifyThread.join();
+    // The archive goes first: its writer may still hold rolls of this paper.
+    archive.reset();
+}
+
+void VirtualPrinter::Reset() {
+    {
+        std::lock_guard<std::mutex> registry(sessionsMutex);
+        for (size_t i = 0; i < sessions.size(); ++i) {
+            std::lock_guard<std::mutex> lock(sessions[i]->mutex);
+            sessions[i]->ResetState(false);
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        ArchiveJobs(jobs.size());
+        NewRoll();
+        jobsDropped += jobs.size();
+        jobs.clear();
+        jobIndex.clear();
+        paperBytes = 0;
+    }
+    Repaint();
+}
+
+void VirtualPrinter::Clear() {
+    {
+        std::lock_guard<std::mutex> registry(sessionsMutex);
+        for (size_t i = 0; i < sessions.size(); ++i) {
+            std::lock_guard<std::mutex> lock(sessions[i]->mutex);
+            sessions[i]->ResetState(true);
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        ArchiveJobs(jobs.size());
+        NewRoll();
+        jobsDropped += jobs.size();
+        jobs.clear();
+        jobIndex.clear();
+        paperBytes = 0;
+    }
+    ClearNvImages();
+    Repaint();
+}
+
+void VirtualPrinter::ProcessData(const unsigned char* data, int length) {
+    localSession->ProcessData(data, length);
+}
+
+std::shared_ptr<PrinterSession> VirtualPrinter::OpenSession(
+        std::function<void(const unsigned char *, int)> reply,
+        std::function<void()> room) {
+    std::shared_ptr<PrinterSession> session = std::make_shared<PrinterSession>(*this);
+    session->reply = reply;
+    session->room = room;
+    session->BeginJob(); // the job starts at accept, not with its first byte
+    std::lock_guard<std::mutex> registry(sessionsMutex);
+    sessions.push_back(session);
+    return session;
+}
+
+void VirtualPrinter::CommitSession(PrinterSession *session) {
+    {
+        std::lock_guard<std::mutex> registry(sessionsMutex);
+        size_t i = 0;
+        while (i < sessions.size() && sessions[i].get() != session) ++i;
+        if (i == sessions.size()) return; // already committed
+        // Keep the session alive until its elements have been moved out.
+        std::shared_ptr<PrinterSession> keep = sessions[i];
+        sessions.erase(sessions.begin() + i);
+
+        std::lock_guard<std::mutex> sessionLock(session->mutex);
+        session->Finish();
+        // An idle or cut boundary may have ended the last job already, but a
+        // page still open at the time is only printed now, by Finish().
+        if (!session->jobOpen && !session->elements.empty()) session->BeginJob();
+        if (session->jobOpen) session->EndJob(JOB_END_CLOSE);
+    }
+    Repaint();
+}
+
+void VirtualPrinter::NewRoll() {
+    std::shared_ptr<PaperRoll> roll = std::make_shared<PaperRoll>();
+    roll->generation = ++paperGeneration;
+    std::atomic_store(&paper, roll);
+}
+
+void VirtualPrinter::CommitJob(PrinterSession &session, PrintJob &job) {
+    std::lock_guard<std::mutex> lock(mutex);
+    job.firstElement = paper->elements.Size();
+    job.elementCount = session.elements.size();
+    // Bitmaps change owner as they are; text is packed into one block of the
+    // job's own, which the session's half-empty ones would otherwise waste.
+    std::vector<PrinterElement> &added = session.elements.elements;
+    std::shared_ptr<ElementArena> payload = std::make_shared<ElementArena>();
+    payload->TakeBitmaps(session.elements.arena);
+    size_t textLength = 0;
+    for (size_t i = 0; i < added.size(); ++i) textLength += added[i].TextLength();
+    payload->ReserveText(textLength);
+    for (size_t i = 0; i < added.size(); ++i) {
+        if (added[i].type == ELEMENT_TEXT) {
+            added[i].text = payload->AddText(added[i].text, added[i].width);
+        }
+    }
+    job.memoryBytes = added.size() * sizeof(PrinterElement) + payload->Bytes();
+    paper->payloads.push_back(payload);
+    // The job is published as a whole, so no reader sees half a receipt.
+    paper->elements.Append(added.begin(), added.end());
+    session.elements.clear();
+    jobIndex[job.id] = jobsDropped + jobs.size();
+    jobs.push_back(job);
+    paperBytes += job.memoryBytes;
+    ApplyRetention();
+}
 
+void VirtualPrinter::ApplyRetention() {
+    size_t jobLimit = maxJobs;
+    size_t byteLimit = maxPaperBytes;
+    int ageLimit = maxJobAgeSeconds;
+    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    if (jobs.empty()) return;
+    bool over = (jobLimit > 0 && jobs.size() > jobLimit) ||
+                (byteLimit > 0 && paperBytes > byteLimit) ||
+                (ageLimit > 0 && now - jobs.front().ended > std::chrono::seconds(ageLimit));
+    if (!over) return;
+
+    // Down to three quarters of every limit, so the next job does not start
+    // another rebuild straight away.
+    size_t jobTarget = jobLimit - jobLimit / 4;
+    size_t byteTarget = byteLimit - byteLimit / 4;
+    std::chrono::milliseconds ageTarget((long long)ageLimit * 750);
+    size_t drop = 0;
+    size_t bytes = paperBytes;
+    while (drop + 1 < jobs.size() &&
+           ((jobLimit > 0 && jobs.size() - drop > jobTarget) ||
+            (byteLimit > 0 && bytes > byteTarget) ||
+            (ageLimit > 0 && now - jobs[drop].ended > ageTarget))) {
+        bytes -= jobs[drop].memoryBytes;
+        ++drop;
+    }
+    if (drop == 0) return;
+    ArchiveJobs(drop);
+
+    // The kept jobs move to a new roll. Only their element records are
+    // copied; their text and bitmaps are shared with the old roll, which
+    // frees the dropped jobs' payloads when its last view goes.
+    std::shared_ptr<PaperRoll> old = paper;
+    size_t first = jobs[drop].firstElement;
+    size_t last = old->elements.Size();
+    std::vector<PrinterElement> kept;
+    kept.reserve(last - first);
+    for (size_t i = first; i < last; ++i) kept.push_back(old->elements.At(i));
+
+    std::shared_ptr<PaperRoll> roll = std::make_shared<PaperRoll>();
+    roll->generation = ++paperGeneration;
+    roll->elements.Append(kept.begin(), kept.end());
+    roll->payloads.assign(old->payloads.begin() + drop, old->payloads.end());
+
+    for (size_t i = 0; i < drop; ++i) jobIndex.erase(jobs[i].id);
+    jobs.erase(jobs.begin(), jobs.begin() + drop);
+    for (size_t i = 0; i < jobs.size(); ++i) jobs[i].firstElement -= first;
+    jobsDropped += drop;
+    jobsEvicted += drop;
+    paperBytes = bytes;
+    std::atomic_store(&paper, roll);
+}
+
+ElementList VirtualPrinter::GetElements() {
+    ElementList live;
+    PaperView view = GetElementsSince(PaperVersion(), &live);
+    ElementList result;
+    result.elements.reserve(view.size() + live.size());
+    for (size_t i = 0; i < view.size(); ++i) result.CopyElement(view[i]);
+    result.Splice(live);
     return result;
 }
 
-void VirtualPrinter::SetRepaintCallback(void (*callback)(void*), void* param) {
+PaperView VirtualPrinter::GetPaper() {
+    return GetElementsSince(PaperVersion());
+}
+
+PaperView VirtualPrinter::GetElementsSince(const PaperVersion &since,
+                                           ElementList *live) {
+    PaperView view;
+    if (!live) {
+        view.roll = std::atomic_load(&paper);
+        view.last = view.roll->elements.Size();
+    } else {
+        std::lock_guard<std::mutex> registry(sessionsMutex);
+        // Every session is held until the paper has been measured: a job
+        // committed in between would otherwise show up twice, or not at all.
+        std::vector<std::unique_lock<std::mutex> > held;
+        held.reserve(sessions.size());
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < sessions.size(); ++i) {
+            held.push_back(std::unique_lock<std::mutex>(sessions[i]->mutex));
+            // Idle jobs are ended here, lazily, rather than by a timer thread:
+            // nothing can tell them apart from open ones until someone looks.
+            if (sessions[i]->JobIdle(now)) sessions[i]->EndJob(JOB_END_IDLE);
+        }
+        view.roll = std::atomic_load(&paper);
+        view.last = view.roll->elements.Size();
+        live->clear();
+        for (size_t i = 0; i < sessions.size(); ++i) {
+            sessions[i]->AppendLiveElements(*live);
+        }
+    }
+
+    if (since.generation == view.roll->generation && since.length <= view.last) {
+        view.first = since.length;
+    } else {
+        view.first = 0;
+        view.restart = true;
+    }
+    return view;
+}
+
+void VirtualPrinter::Repaint() {
+    bool wake;
+    {
+        std::lock_guard<std::mutex> lock(notifyMutex);
+        wake = !repaintPending; // already pending: the next frame covers it
+        repaintPending = true;
+    }
+    if (wake) notifyChanged.notify_one();
+}
+
+void VirtualPrinter::NotifyLoop() {
+    std::unique_lock<std::mutex> lock(notifyMutex);
+    while (true) {
+        notifyChanged.wait(lock, [this] { return repaintPending || notifyStop; });
+        if (notifyStop) return;
+        repaintPending = false;
+        void (*callback)(const PaperChange&, void*) = repaintCallback;
+        void* param = repaintParam;
+        int intervalMs = frameIntervalMs;
+        lock.unlock();
+
+        // Everything since the last notification, read off the paper itself,
+        // so repaints that came in the meantime need no bookkeeping.
+        std::shared_ptr<PaperRoll> roll = std::atomic_load(&paper);
+        PaperChange change;
+        change.endElement = roll->elements.Size();
+        if (roll->generation == notifiedVersion.generation &&
+            change.endElement >= notifiedVersion.length) {
+            change.firstElement = notifiedVersion.length;
+        } else {
+            change.restarted = true;
+        }
+        notifiedVersion.generation = roll->generation;
+        notifiedVersion.length = change.endElement;
+        if (callback) callback(change, param);
+
+        // Frame pacing: changes made during the interval wait for its end
+        // and are delivered together. The first change after a quiet spell
+        // goes out at once.
+        lock.lock();
+        if (intervalMs > 0) {
+            notifyChanged.wait_for(lock, std::chrono::milliseconds(intervalMs),
+                                   [this] { return notifyStop; });
+        }
+    }
+}
+
+void VirtualPrinter::ParseLoop() {
+    std::unique_lock<std::mutex> lock(parseMutex);
+    while (true) {
+        parseReady.wait(lock, [this] { return !parseQueue.empty() || parseStop; });
+        if (parseStop) return;
+        PrinterSession* session = parseQueue.front();
+        parseQueue.pop_front();
+        session->inputParsing = true;
+        // Cleared before draining: bytes fed from here on queue it again.
+        session->inputQueued = false;
+        lock.unlock();
+
+        SpscRing& ring = *session->input;
+        size_t budget = PARSE_BATCH_BYTES;
+        while (budget > 0) {
+            const unsigned char* data;
+            size_t n = std::min(ring.Peek(&data), budget);
+            if (n == 0) break;
+            if (throttled) n = std::min(n, THROTTLED_STEP_BYTES);
+            session->ProcessData(data, (int)n);
+            if (throttled) {
+                // The bytes stay in the receive buffer until the paper has
+                // moved for them, as in the printer.
+                long long wait = mechanismFreeUs.load() - SteadyMicros();
+                if (wait > 0) {
+                    lock.lock();
+                    parseReady.wait_for(lock, std::chrono::microseconds(wait),
+                                        [this] { return parseStop || !throttled; });
+                    lock.unlock();
+                }
+            }
+            ring.Consume(n);
+            budget -= n;
+            // A full ring is only reopened once a quarter of it is free, so
+            // the connection is not woken for every step of a slow parse.
+            if (ring.Free() * 4 >= ring.Capacity() && session->wantsRoom.exchange(false) &&
+                session->room) {
+                session->room();
+            }
+        }
+
+        lock.lock();
+        session->inputParsing = false;
+        if (ring.Size() > 0 && !session->inputQueued.exchange(true)) {
+            parseQueue.push_back(session); // its turn is up; more next round
+        } else if (ring.Size() == 0 && !session->inputQueued && session->closing) {
+            // Closed while its input was still here: the job is complete now.
+            lock.unlock();
+            CommitSession(session);
+            lock.lock();
+        }
+    }
+}
+
+void VirtualPrinter::SetRepaintCallback(void (*callback)(const PaperChange&, void*), void* param) {
+    std::lock_guard<std::mutex> lock(notifyMutex);
     repaintCallback = callback;
     repaintParam = param;
+    if (callback && !notifyThread.joinable()) {
+        notifyThread = std::thread(&VirtualPrinter::NotifyLoop, this);
+    }
+}
+
+void VirtualPrinter::SetFrameInterval(int ms) {
+    std::lock_guard<std::mutex> lock(notifyMutex);
+    frameIntervalMs = ms > 0 ? ms : 0;
+}
+
+void VirtualPrinter::SetStatus(const PrinterStatus &newStatus) {
+    unsigned char changed;
+    {
+        std::lock_guard<std::mutex> lock(statusMutex);
+        changed = AsbChanges(status, newStatus);
+        status = newStatus;
+    }
+    if (!changed) return;
+
+    // A session told the paper is out (ReportPaperOut()) keeps saying so.
+    PrinterStatus noPaper = newStatus;
+    noPaper.paperNearEnd = noPaper.paperEnd = true;
+    unsigned char asb[2][4];
+    AsbBytes(newStatus, asb[0]);
+    AsbBytes(noPaper, asb[1]);
+    // Collected under the locks, sent after them.
+    std::vector<std::function<void(const unsigned char *, int)> > targets;
+    std::vector<bool> targetPaperOut;
+    {
+        std::lock_guard<std::mutex> registry(sessionsMutex);
+        for (size_t i = 0; i < sessions.size(); ++i) {
+            std::lock_guard<std::mutex> lock(sessions[i]->mutex);
+            if ((sessions[i]->asbMask & changed) && sessions[i]->reply) {
+                targets.push_back(sessions[i]->reply);
+                targetPaperOut.push_back(sessions[i]->paperOut);
+            }
+        }
+    }
+    for (size_t i = 0; i < targets.size(); ++i) {
+        targets[i](asb[targetPaperOut[i] ? 1 : 0], sizeof(asb[0]));
+    }
+}
+
+PrinterStatus VirtualPrinter::GetStatus() {
+    std::lock_guard<std::mutex> lock(statusMutex);
+    return status;
+}
+
+void VirtualPrinter::SetIdentity(const PrinterIdentity &newIdentity) {
+    std::lock_guard<std::mutex> lock(statusMutex);
+    identity = newIdentity;
+}
+
+PrinterIdentity VirtualPrinter::GetIdentity() {
+    std::lock_guard<std::mutex> lock(statusMutex);
+    return identity;
+}
+
+void VirtualPrinter::SetProfile(const PrinterProfile &newProfile) {
+    {
+        std::lock_guard<std::mutex> lock(statusMutex);
+        profile = newProfile;
+        throttled = newProfile.printSpeedMmPerSec > 0;
+    }
+    if (!throttled) {
+        // Whatever was still printing is done at once.
+        mechanismFreeUs = 0;
+        std::lock_guard<std::mutex> lock(parseMutex);
+        parseReady.notify_all();
+    }
+}
+
+PrinterProfile VirtualPrinter::GetProfile() {
+    std::lock_guard<std::mutex> lock(statusMutex);
+    return profile;
+}
+
+void VirtualPrinter::SetSessionBufferLimit(size_t bytes) {
+    sessionBufferLimit = bytes > 0 ? bytes : (size_t)MAX_IMAGE_BYTES;
 }
 
 void VirtualPrinter::SetMaxColumns(int cols) {
     maxColumns = cols;
-    currentColumn = 0;
+}
+
+void VirtualPrinter::ClearNvImages() {
+    std::lock_guard<std::mutex> lock(nvMutex);
+    nvImages.clear();
+}
+
+void VirtualPrinter::AddNvImage(const StoredImage &img) {
+    std::lock_guard<std::mutex> lock(nvMutex);
+    nvImages.push_back(img);
+}
+
+bool VirtualPrinter::GetNvImage(int index, StoredImage &out) {
+    std::lock_guard<std::mutex> lock(nvMutex);
+    if (index < 1 || index > (int)nvImages.size()) return false;
+    out = nvImages[index - 1];
+    return true;
+}
+
+void VirtualPrinter::SetJobIdleTimeout(int idleMs) {
+    jobIdleMs = idleMs;
+}
+
+void VirtualPrinter::SetJobPerCut(bool perCut) {
+    jobPerCut = perCut;
+}
+
+size_t VirtualPrinter::GetJobCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return jobs.size();
+}
+
+bool VirtualPrinter::GetJob(size_t n, PrintJob &out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (n >= jobs.size()) return false;
+    out = jobs[n];
+    return true;
+}
+
+bool VirtualPrinter::FindJob(unsigned long long id, PrintJob &out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::unordered_map<unsigned long long, unsigned long long>::const_iterator it =
+        jobIndex.find(id);
+    if (it == jobIndex.end()) return false;
+    out = jobs[(size_t)(it->second - jobsDropped)];
+    return true;
+}
+
+ElementList VirtualPrinter::GetJobElements(size_t n) {
+    std::lock_guard<std::mutex> lock(mutex);
+    ElementList result;
+    if (n >= jobs.size()) return result;
+    const PrintJob &job = jobs[n];
+    for (size_t i = 0; i < job.elementCount; ++i) {
+        result.CopyElement(paper->elements.At(job.firstElement + i));
+    }
+    return result;
+}
+
+void VirtualPrinter::SetMaxJobs(size_t limit) {
+    maxJobs = limit;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ApplyRetention();
+    }
+    Repaint();
+}
+
+void VirtualPrinter::SetMaxPaperBytes(size_t limit) {
+    maxPaperBytes = limit;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ApplyRetention();
+    }
+    Repaint();
+}
+
+void VirtualPrinter::SetMaxJobAge(int seconds) {
+    maxJobAgeSeconds = seconds;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ApplyRetention();
+    }
+    Repaint();
+}
+
+PaperUsage VirtualPrinter::GetPaperUsage() {
+    PaperUsage usage;
+    {
+        std::lock_guard<std::mutex> registry(sessionsMutex);
+        for (size_t i = 0; i < sessions.size(); ++i) {
+            std::lock_guard<std::mutex> lock(sessions[i]->mutex);
+            usage.liveBytes += sessions[i]->elements.Bytes() +
+                               sessions[i]->pageElements.Bytes();
+        }
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    usage.jobs = jobs.size();
+    usage.elements = paper->elements.Size();
+    usage.bytes = paperBytes;
+    usage.evictedJobs = jobsEvicted;
+    return usage;
+}
+
+IngestStats VirtualPrinter::GetIngestStats() {
+    IngestStats stats;
+    {
+        std::lock_guard<std::mutex> registry(sessionsMutex);
+        for (size_t i = 0; i < sessions.size(); ++i) {
+            std::lock_guard<std::mutex> lock(sessions[i]->mutex);
+            if (!sessions[i]->input) continue;
+            ++stats.rings;
+            stats.bufferedBytes += sessions[i]->input->Size();
+        }
+    }
+    stats.peakBytes = ingestPeak;
+    stats.stalls = ingestStalls;
+    stats.bufferCaps = bufferCaps;
+    return stats;
+}
+
+void VirtualPrinter::ArchiveJobs(size_t count) {
+    if (count == 0 || !archive->IsOpen()) return;
+    std::vector<PrintJob> leaving(jobs.begin(), jobs.begin() + count);
+    archive->Add(paper, leaving);
+}
+
+bool VirtualPrinter::OpenArchive(const std::string &path) {
+    return archive->Open(path);
+}
+
+void VirtualPrinter::CloseArchive() {
+    archive->Close();
+}
+
+size_t VirtualPrinter::GetArchivedJobCount() {
+    return archive->GetJobCount();
+}
+
+bool VirtualPrinter::GetArchivedJob(size_t n, PrintJob &out) {
+    return archive->GetJob(n, out);
+}
+
+ElementList VirtualPrinter::GetArchivedJobElements(size_t n) {
+    return archive->GetJobElements(n);
 }
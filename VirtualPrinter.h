@@ -5,13 +5,28 @@
 #include <windows.h>
 #endif
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
+#include "AppendLog.h"
+#include "SpscRing.h"
+
+// One row of the ESC/POS command grammar; the table lives in
+// VirtualPrinter.cpp.
+struct CommandSpec;
+
 // Represents a drawable element on the simulated paper
-enum ElementType {
+enum ElementType : unsigned char {
   ELEMENT_TEXT,
   ELEMENT_NEWLINE, // Explicit line break
   ELEMENT_BITMAP,
@@ -37,9 +52,10 @@ enum PrinterFont {
   FONT_C = 2  // smaller still on the models that offer it
 };
 
-struct PrinterElement {
-  ElementType type;
-  std::wstring text;  // For text elements
+// How an element is printed: everything ApplyStyle() copies from the
+// formatting registers. Elements do not carry their own copy; each distinct
+// style is stored once in the StyleTable and elements refer to it by index.
+struct ElementStyle {
   bool isRed = false; // For 1B 45 1 (Red) vs 0 (Black)
   // Character size multipliers, 1..8 (ESC ! bits 4/5 and GS ! n).
   int widthScale = 1;
@@ -51,180 +67,454 @@ struct PrinterElement {
   int charSpacing = 0;       // ESC SP n - extra dots after each character
   int marginLeft = 0;        // GS L - left margin, in dots
   int areaWidth = 0;         // GS W - print area width in dots (0 = full paper)
-  bool absolutePos = false;  // ELEMENT_SETPOS: absolute (ESC $) vs relative
   int font = FONT_A;         // ESC M n
-  bool isUnderline = false;              // For 1B 2D n
-  std::vector<unsigned char> bitmapData; // For bitmap elements
-  bool isColumnFormat; // True = Column-major (GS *), False = Row-major/Raster
-                       // (GS v 0)
-  bool mergeableBand = false; // True for ESC * graphics bands: consecutive
-                              // bands separated by a single line feed are
-                              // stacked into one contiguous bitmap.
+  bool isUnderline = false;  // For 1B 2D n
   int align = 0; // Justification: 0 = left, 1 = center, 2 = right (ESC a n)
+
+  bool operator==(const ElementStyle &o) const {
+    return isRed == o.isRed && widthScale == o.widthScale &&
+           heightScale == o.heightScale && isReverse == o.isReverse &&
+           isUpsideDown == o.isUpsideDown && isBold == o.isBold &&
+           isRotated90 == o.isRotated90 && charSpacing == o.charSpacing &&
+           marginLeft == o.marginLeft && areaWidth == o.areaWidth &&
+           font == o.font && isUnderline == o.isUnderline && align == o.align;
+  }
+  bool operator!=(const ElementStyle &o) const { return !(*this == o); }
+};
+
+typedef unsigned int StyleId; // 0 is the default ElementStyle
+
+// Every distinct style any session has printed with. Styles are never
+// removed, and a receipt uses a handful of them, so the table stays small. It
+// is shared by all printers and read without a lock: ids are only handed out
+// once their style is in place.
+class StyleTable {
+public:
+  static StyleTable &Instance() {
+    static StyleTable table;
+    return table;
+  }
+  const ElementStyle &Get(StyleId id) const { return styles.At(id); }
+  StyleId Intern(const ElementStyle &style);
+
+private:
+  StyleTable();
+  struct Hash {
+    size_t operator()(const ElementStyle &s) const;
+  };
+  AppendLog<ElementStyle> styles;
+  std::unordered_map<ElementStyle, StyleId, Hash> index;
+  std::mutex mutex; // guards index and appends to styles
+};
+
+// A compact element: 32 bytes, whatever it is. Its style is an index into the
+// StyleTable and its text or bitmap lives in the arena of the list or roll it
+// belongs to, so copying an element copies neither. The pointers stay valid
+// as long as that list or roll does.
+struct PrinterElement {
+  ElementType type;
+  bool absolutePos : 1;    // ELEMENT_SETPOS: absolute (ESC $) vs relative
+  bool isColumnFormat : 1; // True = Column-major (GS *), False = Row-major/Raster
+                           // (GS v 0)
+  bool mergeableBand : 1;  // True for ESC * graphics bands: consecutive
+                           // bands separated by a single line feed are
+                           // stacked into one contiguous bitmap.
+  unsigned char pageDir : 2; // ESC T n: 0 left-right, 1 bottom-top, 2 right-left,
+                             //          3 top-bottom
+  StyleId style;
+  union {
+    const wchar_t *text;                      // ELEMENT_TEXT: `width` chars
+    const std::vector<unsigned char> *bitmap; // ELEMENT_BITMAP
+  };
   // Meaning depends on the type: dots of movement for SETPOS/FEED, dot size
   // for BITMAP, print area size for PAGE_BEGIN/PAGE_END, line spacing for
-  // NEWLINE.
-  int width = 0;
-  int height = 0;
+  // NEWLINE. A TEXT element keeps its length in characters in `width`.
+  int width;
+  int height;
   // x is determined at render time for flow
   // --- Page mode -----------------------------------------------------------
   // For elements inside a page: the position, in dots, within the print area,
   // expressed in the coordinate system of pageDir. For ELEMENT_PAGE_BEGIN:
   // the origin of the print area (ESC W x, y) and width/height carry its size.
-  int pageX = 0;
-  int pageY = 0;
-  int pageDir = 0; // ESC T n: 0 left-right, 1 bottom-top, 2 right-left,
-                   //          3 top-bottom
+  int pageX;
+  int pageY;
+
+  PrinterElement()
+      : type(ELEMENT_TEXT), absolutePos(false), isColumnFormat(false),
+        mergeableBand(false), pageDir(0), style(0), text(nullptr), width(0),
+        height(0), pageX(0), pageY(0) {}
+
+  const ElementStyle &Style() const {
+    return StyleTable::Instance().Get(style);
+  }
+  size_t TextLength() const { return type == ELEMENT_TEXT ? width : 0; }
 };
 
-class VirtualPrinter {
+// Owns the text and bitmaps that elements point to. Nothing it stores ever
+// moves, so an element stays valid until its arena is cleared or destroyed,
+// and a reader on another thread may follow a pointer it got through a
+// release/acquire pair (see AppendLog) while the owner keeps adding.
+class ElementArena {
 public:
-  VirtualPrinter();
-  ~VirtualPrinter();
-
-  void Reset();
+  ElementArena() : textBlock(nullptr), textUsed(0), textCapacity(0), bytes(0) {}
+  // Moving an arena moves only the ownership of its blocks, never the
+  // payloads, so elements that point into it stay valid.
+  ElementArena(ElementArena &&other);
+  ElementArena &operator=(ElementArena &&other);
+
+  const wchar_t *AddText(const wchar_t *text, size_t length);
+  // Opens a block of exactly `length` characters for the AddText() calls
+  // that follow, when the caller knows how much text is coming.
+  void ReserveText(size_t length);
+  const std::vector<unsigned char> *AddBitmap(std::vector<unsigned char> data);
+  // Takes over every bitmap `from` holds without copying them; elements that
+  // point to them now depend on this arena instead.
+  void TakeBitmaps(ElementArena &from);
+  // Takes over everything `from` holds, text included.
+  void TakeAll(ElementArena &from);
   void Clear();
-  void ProcessData(const unsigned char *data, int length);
-  std::vector<PrinterElement> GetElements();
-  void SetRepaintCallback(void (*callback)(void *), void *param);
-  void SetMaxColumns(int cols);
+  // Memory held for payloads, in bytes.
+  size_t Bytes() const { return bytes; }
+
+private:
+  std::vector<std::unique_ptr<wchar_t[]> > textBlocks;
+  wchar_t *textBlock;  // the block short runs are packed into
+  size_t textUsed;     // of textBlock, in characters
+  size_t textCapacity;
+  std::vector<std::unique_ptr<std::vector<unsigned char> > > bitmaps;
+  size_t bytes;
+};
+
+// A list of elements together with the arena their payloads live in. It is
+// owned by one thread at a time (a session under its mutex, or the caller of
+// GetElements()), which is what allows bitmaps to be edited in place.
+class ElementList {
+  friend class VirtualPrinter;
+
+public:
+  size_t size() const { return elements.size(); }
+  bool empty() const { return elements.empty(); }
+  const PrinterElement &operator[](size_t i) const { return elements[i]; }
+  PrinterElement &operator[](size_t i) { return elements[i]; }
+  const PrinterElement &back() const { return elements.back(); }
+  PrinterElement &back() { return elements.back(); }
+  void pop_back() { elements.pop_back(); }
+  void clear();
+  // The elements themselves, valid as long as the list is.
+  const std::vector<PrinterElement> &Elements() const { return elements; }
+
+  // Payload for an element that is then push_back()ed onto this list.
+  const wchar_t *AddText(const std::wstring &text) {
+    return arena.AddText(text.data(), text.size());
+  }
+  const wchar_t *AddText(const wchar_t *text, size_t length) {
+    return arena.AddText(text, length);
+  }
+  const std::vector<unsigned char> *AddBitmap(std::vector<unsigned char> data) {
+    return arena.AddBitmap(std::move(data));
+  }
+  // The bitmap of one of this list's elements, for growing it in place.
+  std::vector<unsigned char> &EditBitmap(const PrinterElement &el) {
+    return const_cast<std::vector<unsigned char> &>(*el.bitmap);
+  }
+  // Appends an element whose payload, if any, is already in this list.
+  void push_back(const PrinterElement &el) { elements.push_back(el); }
+  // Appends a copy of an element from anywhere else, payload included.
+  void CopyElement(const PrinterElement &el);
+  // Moves all of `other` onto the end of this list.
+  void Splice(ElementList &other);
+  // Memory held by the list, elements and payloads, in bytes.
+  size_t Bytes() const {
+    return elements.capacity() * sizeof(PrinterElement) + arena.Bytes();
+  }
 
 private:
   std::vector<PrinterElement> elements;
+  ElementArena arena;
+};
+
+// A bitmap held in the printer, either an NV image (FS q) or the raster
+// graphics buffer (GS ( L / GS 8 L).
+struct StoredImage {
+  int widthDots = 0;
+  int heightDots = 0;
+  int scaleX = 1; // GS ( L bx, applied when the image is printed
+  int scaleY = 1; // GS ( L by
+  std::vector<unsigned char> raster; // row-major, MSB = leftmost dot
+};
+
+// Why a print job ended.
+enum JobEndReason {
+  JOB_END_CLOSE, // the connection closed
+  JOB_END_IDLE,  // no data for longer than the job idle timeout
+  JOB_END_CUT    // a paper cut, when jobs are split per cut
+};
+
+// One print job on the paper: what one connection sent between two job
+// boundaries.
+struct PrintJob {
+  unsigned long long id = 0; // from 1, in the order the jobs started
+  std::chrono::system_clock::time_point started;
+  std::chrono::system_clock::time_point ended;
+  long long bytes = 0;       // ESC/POS bytes received for the job
+  size_t firstElement = 0;   // its elements on the paper (GetElements())
+  size_t elementCount = 0;
+  JobEndReason endReason = JOB_END_CLOSE;
+  size_t memoryBytes = 0;    // held on the paper: elements, text and bitmaps
+  // How long the job takes to print on the printer's PrinterProfile, from
+  // the paper motion of its elements; 0 without a profile.
+  long long printMicros = 0;
+};
+
+// What the paper holds, for sizing the retention limits.
+struct PaperUsage {
+  size_t jobs = 0;     // on the paper
+  size_t elements = 0;
+  size_t bytes = 0;    // held by those jobs (PrintJob::memoryBytes)
+  size_t liveBytes = 0; // held by the sessions still printing
+  unsigned long long evictedJobs = 0; // dropped by the limits so far
+};
+
+// The input rings of the connections, for sizing them. See Feed().
+struct IngestStats {
+  size_t rings = 0;         // connections with a ring
+  size_t bufferedBytes = 0; // received and not yet parsed, over all rings
+  size_t peakBytes = 0;     // the fullest any ring has been
+  unsigned long long stalls = 0; // times a connection's ring was full
+  // Payloads skipped, and text printed in pieces, because they would have
+  // grown a session's buffer past SetSessionBufferLimit().
+  unsigned long long bufferCaps = 0;
+};
+
+// The mechanism of a real printer, for testing a client against its speed:
+// with a print speed set, the paper motion of every element takes the time
+// it would take on that printer, and input is only parsed as fast as it is
+// printed. The input ring of each connection shrinks to the receive buffer,
+// so a client sending faster than that sees the printer's TCP window close.
+struct PrinterProfile {
+  int printSpeedMmPerSec = 0; // 0 = print instantly, no throttling
+  int lineFeedMs = 0;         // per line feed, on top of its motion
+  int cutMs = 0;              // per cut
+  size_t receiveBufferBytes = 0; // rounded up to a power of two; 0 = 1 MB
+};
+
+// What the printer reports about itself to a client that asks (DLE EOT, GS r,
+// ESC u, ESC v) or has Automatic Status Back on (GS a). There is no mechanism
+// behind it: the UI or a test sets it to see how the client copes.
+struct PrinterStatus {
+  bool coverOpen = false;
+  bool paperNearEnd = false;
+  bool paperEnd = false;
+  bool drawerOpen = false; // drawer kick-out connector pin 3 high
+  bool cutterError = false;
+  // A printer with its cover open, out of paper or in error is offline.
+  bool Offline() const { return coverOpen || paperEnd || cutterError; }
+};
+
+// What GS I answers.
+struct PrinterIdentity {
+  unsigned char modelId = 0x20;    // GS I 1
+  unsigned char typeId = 0x02;     // GS I 2: bit 1 = has an autocutter
+  unsigned char romVersion = 0x10; // GS I 3
+  std::string firmware = "1.00";        // GS I 65
+  std::string maker = "VirtualESCPOS";  // GS I 66
+  std::string model = "VirtualESCPOS";  // GS I 67
+  std::string serial = "00000000";      // GS I 68
+};
+
+// The committed paper. Clear(), Reset() and the retention limits start a new
+// roll rather than changing this one, so views of the old roll stay valid
+// until dropped.
+struct PaperRoll {
+  unsigned long long generation = 0; // from 1, one per roll
+  AppendLog<PrinterElement> elements;
+  // The text and bitmaps of each job on the roll, in job order. A job's
+  // payloads are shared with the next roll when the limits keep the job.
+  std::vector<std::shared_ptr<const ElementArena> > payloads;
+};
+
+// How far a consumer of the paper has read, for GetElementsSince().
+struct PaperVersion {
+  unsigned long long generation = 0;
+  size_t length = 0;
+};
+
+// What changed on the paper since the previous repaint notification.
+// Elements from firstElement on may have changed: [firstElement, endElement)
+// were committed since, and the live output that follows the committed paper
+// is to be taken again as a whole. After a restart the paper is a new roll,
+// and everything up to endElement is new.
+struct PaperChange {
+  bool restarted = false;
+  size_t firstElement = 0;
+  size_t endElement = 0;
+};
+
+// A read-only window onto committed elements. Taking one takes no lock and
+// copies no element; the elements it shows never change.
+class PaperView {
+  friend class VirtualPrinter;
+
+public:
+  PaperView() : first(0), last(0), restart(false) {}
+
+  size_t size() const { return last - first; }
+  bool empty() const { return first == last; }
+  const PrinterElement &operator[](size_t i) const {
+    return roll->elements.At(first + i);
+  }
+  // Position on the paper of the view's first element.
+  size_t offset() const { return first; }
+  // The paper was cleared after the version the view was asked for, so the
+  // view starts from the top of a new roll instead of continuing the old one.
+  bool restarted() const { return restart; }
+  // Pass to GetElementsSince() to get what is committed after this view.
+  PaperVersion version() const {
+    PaperVersion v;
+    if (roll) v.generation = roll->generation;
+    v.length = last;
+    return v;
+  }
+
+private:
+  std::shared_ptr<const PaperRoll> roll;
+  size_t first;
+  size_t last;
+  bool restart;
+};
+
+class VirtualPrinter;
+class PaperArchive;
+
+// The parser for one stream of ESC/POS data, normally one client connection.
+// Everything a command can change (styles, page mode, half-received images)
+// lives here, so two terminals printing at the same time cannot style each
+// other's text. What the session prints stays its own until its job ends (see
+// PrintJob) and is committed to the printer's paper in one piece.
+class PrinterSession {
+  friend struct CommandTable; // holds the handlers of the command grammar
+  friend class VirtualPrinter;
+
+public:
+  explicit PrinterSession(VirtualPrinter &printer);
+  ~PrinterSession();
+
+  void ProcessData(const unsigned char *data, int length);
+  // For the connection's thread: copies what fits of the data into the
+  // session's input ring and returns how much that was, leaving the parsing
+  // to the printer's parser thread. It never waits. When the ring is full it
+  // takes less, and the parser thread calls the session's `room` (see
+  // VirtualPrinter::OpenSession()) once it has made space; until then the
+  // caller leaves the rest unread in the socket, and the client sees the
+  // printer busy, as with a real one.
+  // Use either this or ProcessData() on a session, not both.
+  int Feed(const unsigned char *data, int length);
+  // Ends the connection: prints anything still pending and commits the last
+  // job to the paper. The session takes no more data afterwards. Returns at
+  // once: input the parser thread has yet to parse is parsed first, and that
+  // thread commits the job after it.
+  void Close();
+  // From now on the session's status replies say the paper is out, whatever
+  // the printer's status: a fault injected for this one client.
+  void ReportPaperOut();
+
+private:
+  VirtualPrinter &printer;
+  bool closed;
+
+  // Sends bytes back to the client; empty for sessions nobody can answer.
+  // Replies are collected in replyBuffer while parsing and sent by
+  // ProcessData() once the session's mutex is released.
+  std::function<void(const unsigned char *, int)> reply;
+  std::vector<unsigned char> replyBuffer;
+  // Tells the connection that a Feed() which took less than it was given can
+  // be retried; called by the parser thread, without any lock held.
+  std::function<void()> room;
+  unsigned char asbMask; // GS a n: the status changes the client is sent
+  bool paperOut;         // ReportPaperOut()
+  void Reply(const unsigned char *data, size_t length);
+  // The printer's status as this session reports it.
+  PrinterStatus Status();
+
+  // The most any one of the buffers below may hold; see
+  // VirtualPrinter::SetSessionBufferLimit().
+  size_t bufferLimit;
+
+  // Fed data not yet parsed: written by the connection's thread, read by the
+  // parser thread. Created by the first Feed().
+  std::unique_ptr<SpscRing> input;
+  std::atomic<bool> inputQueued; // in the printer's parseQueue
+  bool inputParsing;             // being drained; guarded by parseMutex
+  std::atomic<bool> wantsRoom;   // a Feed() found the ring full
+  // Close() came while input was left: the parser thread commits the session
+  // once it has parsed it. Guarded by parseMutex.
+  bool closing;
+  // Queues the session for the parser thread unless it already is.
+  void ScheduleInput();
+
+  // The job being printed. It opens at accept, or with the first byte after
+  // the previous job ended, and its elements are the ones below.
+  PrintJob job;
+  bool jobOpen;
+  bool jobBoundary; // a cut just ended the job (jobs split per cut)
+  std::chrono::steady_clock::time_point lastActivity;
+
+  // Paper motion (see PrinterProfile): how many of `elements` are already
+  // added to the job's print time, and the tallest thing on the line those
+  // left off in, which sets how far its line feed moves the paper. A raster
+  // image prints as its rows come in; motionAheadDots are the rows of the
+  // one still arriving that are already counted.
+  size_t motionCounted;
+  int motionLineDots;
+  int motionAheadDots;
+
+  // Printed by this session and not yet committed to the paper.
+  ElementList elements;
+  // Guards all of the session's state against the UI thread, which reads the
+  // live elements while the connection thread parses. Connections never share
+  // a session, so this lock is never contended by another parser.
   std::mutex mutex;
-  void (*repaintCallback)(void *);
-  void *repaintParam;
 
   // Parser parsing state
+  //
+  // Most commands are described once, in the command table in
+  // VirtualPrinter.cpp: the prefix states look the command byte up there and
+  // the generic states collect its parameters and payload length before its
+  // handler runs. Only payloads whose shape the table cannot express (image
+  // data, NUL-terminated lists, repeated records) have states of their own.
   enum ParseState {
     STATE_NORMAL,
-    STATE_ESC,
-    STATE_ESC_EXCLAMATION, // ESC ! n
-    STATE_ESC_E,           // ESC E n
-    STATE_ESC_MINUS,       // ESC - n
-    STATE_ESC_BRACE,       // ESC { n (upside-down)
-    STATE_ESC_M,           // ESC M n (character font)
-    STATE_ESC_d,           // ESC d n
-    STATE_ESC_3,           // ESC 3 n (Set line spacing)
-    STATE_ESC_a,           // ESC a n (Select justification)
-
-    // ESC * m nL nH d... (Select bit image mode - legacy column graphics)
-    STATE_ESC_STAR,      // ESC * m
-    STATE_ESC_STAR_nL,   // ESC * m nL
-    STATE_ESC_STAR_nH,   // ESC * m nL nH
-    STATE_ESC_STAR_DATA, // ESC * ... image data
 
+    // A command prefix has been seen; the next byte selects the command.
+    STATE_ESC,
     STATE_GS,
-    STATE_GS_V,
-    STATE_GS_V_n,
-    STATE_GS_v,
-    STATE_GS_v_0,
-    STATE_GS_v_0_xL,
-    STATE_GS_v_0_xH,
-    STATE_GS_v_0_yL,
-    STATE_GS_v_0_yH,
-    STATE_GS_v_0_DATA,
-
-    // New states for ignoring/handling additional commands
-    STATE_ESC_c, // ESC c 0/1/3/4/5 n
-    STATE_ESC_t, // ESC t n
-
-    // New states for Download Bit Image (GS * x y d...)
-    STATE_GS_STAR,
-    STATE_GS_STAR_y,
-    STATE_GS_STAR_DATA,
-
-    // New states for Print Download Bit Image (GS / m)
-    STATE_GS_SLASH,
+    STATE_FS,
+    STATE_DLE,
+
+    STATE_CMD_PARAMS, // collecting activeCommand's fixed parameters
+    STATE_CMD_LEN,    // reading the little-endian length of its payload
 
     // --- Generic parameter consumption -------------------------------------
     // Commands we recognise but do not render still have to swallow their
     // parameters; otherwise those bytes fall through to the text stream and
     // are printed as garbage.
-    STATE_SKIP_N,   // consume `skipRemaining` bytes, then STATE_NORMAL
-    STATE_READ_LEN, // read a little-endian length, then skip that many
-
-    STATE_PAREN_fn, // ESC ( fn pL pH ... (consumed only)
-    STATE_GS_8,     // GS 8 L p1 p2 p3 p4 ...
-
-    // GS ( <id> pL pH d1...dk. The identifier selects a command group: 'k' is
-    // the 2D code group (QR Code), 'L' the raster graphics group.
-    STATE_GS_PAREN_id,
-    STATE_GS_PAREN_pL,
-    STATE_GS_PAREN_pH,
-    STATE_GS_PAREN_DATA,
-
-    // ESC & y c1 c2 [x d1...d(x*y)]... (define user-defined characters)
-    STATE_ESC_AMP_y,
-    STATE_ESC_AMP_c1,
-    STATE_ESC_AMP_c2,
-    STATE_ESC_AMP_x,
-
-    STATE_ESC_D, // ESC D n1...nk NUL (set horizontal tab positions)
-
-    // DLE (real-time commands)
-    STATE_DLE,
-    STATE_DLE_DC4,
-
-    // FS (two-byte command set)
-    STATE_FS,
-    STATE_FS_q_n,    // FS q n
-    STATE_FS_q_HDR,  // FS q ... xL xH yL yH
-    STATE_FS_q_DATA, // FS q ... image data
-    STATE_FS_p_n,    // FS p n
-    STATE_FS_p_m,    // FS p n m
-
-    STATE_GS_8_LEN, // GS 8 L p1 p2 p3 p4 (32-bit payload length)
+    STATE_SKIP_N, // consume `skipRemaining` bytes, then skipReturnState
+
+    // --- Payloads -----------------------------------------------------------
+    STATE_ESC_STAR_DATA, // ESC * m nL nH: column image data
+    STATE_GS_v_0_DATA,   // GS v 0 m xL xH yL yH: raster data
+    STATE_GS_STAR_DATA,  // GS * x y: downloaded bit image data
+    STATE_GS_PAREN_DATA, // GS ( <id> / GS 8 L: collected payload
+    STATE_ESC_AMP_x,     // ESC & y c1 c2: next character's width x
+    STATE_ESC_D,         // ESC D n1...nk NUL: tab positions
+    STATE_FS_q_HDR,      // FS q n: xL xH yL yH of the next image
+    STATE_FS_q_DATA,     // FS q n: image data
 
     // Barcodes: GS k m d1...dk NUL (function A)
     //           GS k m n d1...dn  (function B)
-    STATE_GS_k,
     STATE_GS_k_DATA_A, // function A: collect until NUL
     STATE_GS_k_n,      // function B: read n
-    STATE_GS_k_DATA_B, // function B: collect n bytes
-
-    // Barcode settings that take a single parameter
-    STATE_GS_h, // GS h n - barcode height
-    STATE_GS_w, // GS w n - barcode module width
-    STATE_GS_H, // GS H n - HRI position
-    STATE_GS_f, // GS f n - HRI font
-
-    STATE_GS_EXCLAMATION, // GS ! n - character size
-    STATE_GS_B,           // GS B n - reverse printing
-
-    // Text attributes
-    STATE_ESC_G,     // ESC G n / ESC g n - double-strike
-    STATE_ESC_r,     // ESC r n - select print colour
-    STATE_ESC_SP,    // ESC SP n - right-side character spacing
-    STATE_ESC_V,     // ESC V n - 90 degree rotation
-
-    // Horizontal positioning: ESC $ nL nH and ESC \ nL nH
-    STATE_ESC_DOLLAR_nL,
-    STATE_ESC_DOLLAR_nH,
-    STATE_ESC_BSLASH_nL,
-    STATE_ESC_BSLASH_nH,
-
-    // GS L nL nH (left margin) and GS W nL nH (print area width)
-    STATE_GS_L_nL,
-    STATE_GS_L_nH,
-    STATE_GS_W_nL,
-    STATE_GS_W_nH,
-
-    // Feeds: ESC J n / ESC K n (dots) and ESC e n (reverse lines)
-    STATE_ESC_J,
-    STATE_ESC_K,
-    STATE_ESC_e,
-
-    // Page mode: ESC T n (print direction) and
-    // ESC W xL xH yL yH dxL dxH dyL dyH (print area)
-    STATE_ESC_T,
-    STATE_ESC_W,
-
-    // GS $ nL nH / GS \ nL nH - vertical print position in page mode
-    STATE_GS_DOLLAR_nL,
-    STATE_GS_DOLLAR_nH,
-    STATE_GS_BSLASH_nL,
-    STATE_GS_BSLASH_nH
+    STATE_GS_k_DATA_B  // function B: collect n bytes
   };
 
   ParseState state;
@@ -246,6 +536,10 @@ private:
   int areaWidthDots;    // GS W
   int currentFont;
   bool isUnderlineMode;
+  // The style ApplyStyle() last interned: runs of elements in one style cost
+  // a comparison each rather than a StyleTable lookup.
+  ElementStyle internedStyle;
+  StyleId internedStyleId;
 
   // Line Spacing
   int currentLineSpacing; // -1 = Default (Auto based on font), >=0 = Fixed
@@ -263,7 +557,7 @@ private:
   // Justification (ESC a n): 0 = left, 1 = center, 2 = right
   int currentAlign;
 
-  // Max columns (0 = disabled)
+  // Max columns (0 = disabled), picked up from the printer before each chunk
   int maxColumns;
   int currentColumn; // Current column position for auto-CRLF
 
@@ -279,8 +573,7 @@ private:
   int pageDirection; // ESC T n, 0..3
   int pageCursorX;   // print position along the text flow, in dots
   int pageCursorY;   // print position across lines, in dots
-  std::vector<PrinterElement> pageElements;
-  std::vector<unsigned char> pendingParams; // ESC W's eight parameter bytes
+  ElementList pageElements;
 
   // Current text buffer
   std::wstring currentText;
@@ -301,12 +594,14 @@ private:
   std::vector<unsigned char> escStarData;
 
   // --- Parameter consumption bookkeeping ------------------------------------
+  const CommandSpec *activeCommand; // the command being parsed
+  unsigned char cmdParams[8];       // its fixed parameters (ESC W has eight)
+  int cmdParamCount;                // parameters collected so far
   long long skipRemaining;    // STATE_SKIP_N
   ParseState skipReturnState; // state to enter once the skip completes
-  int pendingParam;           // low byte of a 16-bit nL/nH parameter pair
-  int lenBytesRemaining;      // STATE_READ_LEN: length bytes still to read
-  int lenShift;            // STATE_READ_LEN: current byte's shift
-  long long pendingLen;    // STATE_READ_LEN: accumulated length
+  int lenBytesRemaining;      // STATE_CMD_LEN: length bytes still to read
+  int lenShift;            // STATE_CMD_LEN: current byte's shift
+  long long pendingLen;    // STATE_CMD_LEN: accumulated length
 
   int userCharY;         // ESC &: bytes per column
   int userCharRemaining; // ESC &: characters still to read
@@ -318,17 +613,7 @@ private:
   std::vector<unsigned char> nvBuffer;
   int nvImageIndex; // FS p: which stored image to print
 
-  // A bitmap held in the printer, either an NV image (FS q) or the raster
-  // graphics buffer (GS ( L / GS 8 L).
-  struct StoredImage {
-    int widthDots = 0;
-    int heightDots = 0;
-    int scaleX = 1; // GS ( L bx, applied when the image is printed
-    int scaleY = 1; // GS ( L by
-    std::vector<unsigned char> raster; // row-major, MSB = leftmost dot
-  };
-  std::vector<StoredImage> nvImages; // FS q, addressed from 1 by FS p
-  StoredImage graphicsBuffer;        // GS ( L fn 112, printed by fn 50
+  StoredImage graphicsBuffer; // GS ( L fn 112, printed by fn 50
 
   // Horizontal tab positions (ESC D), in columns. Empty = default every 8.
   std::vector<int> tabStops;
@@ -341,6 +626,7 @@ private:
   int barcodeHriFont;   // GS f n
   int barcodeExpected;  // function B: bytes still to collect
   std::vector<unsigned char> barcodeData;
+  bool barcodeOverflow; // function A ran past bufferLimit: not printed
 
   // --- GS ( <id> command groups ---------------------------------------------
   int parenId;       // the identifier byte ('k', 'L', ...)
@@ -352,6 +638,29 @@ private:
   int qrEcLevel;     // fn 69: 0 = L, 1 = M, 2 = Q, 3 = H
   std::vector<unsigned char> qrStoredData; // fn 80: symbol storage area
 
+  // Returns every formatting register to its power-on value and drops the
+  // session's uncommitted elements. `clearCaches` also drops the downloaded
+  // and buffered images (the printer's Clear, as opposed to Reset).
+  void ResetState(bool clearCaches);
+  // Appends what the session has printed so far, including the line and page
+  // still being built, to `out`. Called with `mutex` held.
+  void AppendLiveElements(ElementList &out);
+  // Prints whatever is still pending at the end of the connection: the
+  // current line and, if page mode was left on, the page. Called with `mutex`
+  // held.
+  void Finish();
+  // Starts a new job. Called with `mutex` held.
+  void BeginJob();
+  // Commits the job's elements to the paper and records it. Called with
+  // `mutex` held.
+  void EndJob(JobEndReason reason);
+  // True if the open job has seen no data for longer than the idle timeout.
+  bool JobIdle(std::chrono::steady_clock::time_point now) const;
+  // Adds the motion of the elements emitted since the last call to the job's
+  // print time and, when throttled, to the printer's mechanism. Called with
+  // `mutex` held.
+  void CountMotion();
+
   void FlushSegment();
   void AddNewLine();
   void AddCutLine();
@@ -359,7 +668,7 @@ private:
 
   // --- Page mode helpers ----------------------------------------------------
   // The buffer new elements go to: the page buffer while page mode is active.
-  std::vector<PrinterElement> &Target();
+  ElementList &Target();
   // Appends an element, stamping it with the page position in page mode and
   // advancing the print position past it.
   void PushElement(PrinterElement &el);
@@ -378,10 +687,85 @@ private:
 
   // Consume `n` bytes of parameters, then enter `next`.
   void SkipBytes(long long n, ParseState next = STATE_NORMAL);
-  // Read a little-endian length of `numLenBytes` bytes, then skip that many.
-  void BeginLengthSkip(int numLenBytes);
+  // Whether a payload of `bytes` may be collected into a buffer; counts a
+  // cap if not, and the caller skips it instead.
+  bool FitsBuffer(long long bytes);
+  // Looks up the command byte following `prefix` and starts parsing it;
+  // unknown commands return to STATE_NORMAL.
+  void DispatchCommand(unsigned char prefix, unsigned char cmd);
+  // Starts collecting the parameters (and payload length) of `spec`.
+  void BeginCommand(const CommandSpec *spec);
+  // Called once the fixed parameters are in: reads the length, if any.
+  void CommandParamsComplete();
+  // Runs the active command's handler, or skips its payload if it has none.
+  void RunCommand();
+
+  // --- Command handlers -----------------------------------------------------
+  // Each receives the command's fixed parameters; a payload length, where the
+  // command has one, is in pendingLen. The parser is back in STATE_NORMAL
+  // when a handler runs, and a handler that reads on sets the next state.
+  void CmdInitialize(const unsigned char *p);      // ESC @
+  void CmdEmphasized(const unsigned char *p);      // ESC E n
+  void CmdUnderline(const unsigned char *p);       // ESC - n
+  void CmdFeedLines(const unsigned char *p);       // ESC d n
+  void CmdCodePage(const unsigned char *p);        // ESC t n
+  void CmdLineSpacing(const unsigned char *p);     // ESC 3 n
+  void CmdDefaultSpacing(const unsigned char *p);  // ESC 2
+  void CmdPrintMode(const unsigned char *p);       // ESC ! n
+  void CmdBitImage(const unsigned char *p);        // ESC * m nL nH
+  void CmdJustification(const unsigned char *p);   // ESC a n
+  void CmdCut(const unsigned char *p);             // ESC i / ESC m
+  void CmdUserChars(const unsigned char *p);       // ESC & y c1 c2
+  void CmdTabPositions(const unsigned char *p);    // ESC D
+  void CmdUpsideDown(const unsigned char *p);      // ESC { n
+  void CmdFont(const unsigned char *p);            // ESC M n
+  void CmdDoubleStrike(const unsigned char *p);    // ESC G n / ESC g n
+  void CmdColor(const unsigned char *p);           // ESC r n
+  void CmdCharSpacing(const unsigned char *p);     // ESC SP n
+  void CmdRotate90(const unsigned char *p);        // ESC V n
+  void CmdAbsolutePos(const unsigned char *p);     // ESC $ nL nH
+  void CmdRelativePos(const unsigned char *p);     // ESC \ nL nH
+  void CmdFeedDots(const unsigned char *p);        // ESC J n
+  void CmdReverseDots(const unsigned char *p);     // ESC K n
+  void CmdReverseLines(const unsigned char *p);    // ESC e n
+  void CmdPageMode(const unsigned char *p);        // ESC L
+  void CmdStandardMode(const unsigned char *p);    // ESC S
+  void CmdPrintPage(const unsigned char *p);       // ESC FF
+  void CmdPrintDirection(const unsigned char *p);  // ESC T n
+  void CmdPrintArea(const unsigned char *p);       // ESC W x y dx dy
+  void CmdCutPaper(const unsigned char *p);        // GS V m [n]
+  void CmdRasterSelect(const unsigned char *p);    // GS v <fn>
+  void CmdRasterImage(const unsigned char *p);     // GS v 0 m xL xH yL yH
+  void CmdDefineImage(const unsigned char *p);     // GS * x y
+  void CmdPrintImage(const unsigned char *p);      // GS / m
+  void CmdParenGroup(const unsigned char *p);      // GS ( <id> pL pH
+  void CmdLargeGraphics(const unsigned char *p);   // GS 8 L p1 p2 p3 p4
+  void CmdBarcode(const unsigned char *p);         // GS k m
+  void CmdBarcodeHeight(const unsigned char *p);   // GS h n
+  void CmdBarcodeModule(const unsigned char *p);   // GS w n
+  void CmdHriPosition(const unsigned char *p);     // GS H n
+  void CmdHriFont(const unsigned char *p);         // GS f n
+  void CmdCharSize(const unsigned char *p);        // GS ! n
+  void CmdReverse(const unsigned char *p);         // GS B n
+  void CmdLeftMargin(const unsigned char *p);      // GS L nL nH
+  void CmdAreaWidth(const unsigned char *p);       // GS W nL nH
+  void CmdPageAbsoluteY(const unsigned char *p);   // GS $ nL nH
+  void CmdPageRelativeY(const unsigned char *p);   // GS \ nL nH
+  void CmdDefineNvImages(const unsigned char *p);  // FS q n
+  void CmdPrintNvImage(const unsigned char *p);    // FS p n m
+  void CmdRealtimeDc4(const unsigned char *p);     // DLE DC4 fn
+  void CmdRealtimeStatus(const unsigned char *p);  // DLE EOT n
+  void CmdTransmitStatus(const unsigned char *p);  // GS r n
+  void CmdTransmitId(const unsigned char *p);      // GS I n
+  void CmdAsb(const unsigned char *p);             // GS a n
+  void CmdDrawerStatus(const unsigned char *p);    // ESC u n
+  void CmdPaperStatus(const unsigned char *p);     // ESC v
   // HT (0x09): advance to the next tab stop by padding with spaces.
   void HandleTab();
+  // Appends a run of printable bytes (no control codes) to the current line,
+  // wrapping at maxColumns in standard mode and at the print area in page
+  // mode exactly as if the bytes had arrived one at a time.
+  void AppendText(const unsigned char *text, size_t length);
   // Encodes the collected GS k data and appends it to the paper.
   void CommitBarcode();
   // Emits a horizontal move (ESC $ / ESC \).
@@ -390,6 +774,8 @@ private:
   void AddFeed(int dots);
   // Copies the current formatting state onto an element being emitted.
   void ApplyStyle(PrinterElement &el);
+  // The style of an element that takes only the justification (images).
+  void ApplyAlign(PrinterElement &el);
   // Dispatches a completed GS ( <id> payload.
   void HandleParenCommand();
   // Handles the 2D code group (GS ( k): QR Code settings, store and print.
@@ -406,3 +792,196 @@ private:
   void AddBitmapElement(const std::vector<unsigned char> &raster, int widthDots,
                         int heightDots);
 };
+
+// The printer itself: the paper shared by every session, the printer-wide NV
+// memory, and the sessions that are currently printing.
+//
+// Lock order is sessionsMutex, then a session's mutex, then mutex (the paper).
+// nvMutex, notifyMutex, parseMutex and statusMutex are leaves: no other lock
+// is taken while one is held.
+class VirtualPrinter {
+  friend class PrinterSession;
+
+public:
+  VirtualPrinter();
+  ~VirtualPrinter();
+
+  void Reset();
+  void Clear();
+  // Feeds data that did not arrive over a connection, such as a file, through
+  // the printer's own session. Its output is never closed into a job.
+  void ProcessData(const unsigned char *data, int length);
+  // Starts a new job, normally one per client connection. The session shows
+  // up in GetElements() as it prints and is committed by its Close().
+  // `reply`, if given, sends to the client; without it, status requests go
+  // unanswered. `room` is called when a Feed() that found the input ring full
+  // can be retried. Both are called without any of the printer's locks held,
+  // from the thread that parses for every session, so neither may wait on
+  // the client.
+  std::shared_ptr<PrinterSession> OpenSession(
+      std::function<void(const unsigned char *, int)> reply = nullptr,
+      std::function<void()> room = nullptr);
+  // The paper, followed by the live output of every open session in the
+  // order they were opened. This copies the whole roll; a view does not.
+  ElementList GetElements();
+  // The committed paper as it is now, without locking or copying.
+  PaperView GetPaper();
+  // What was committed after `since`: the whole paper, restarted(), if it
+  // was cleared in between. `live`, if given, receives the output of the open
+  // sessions as it stood when the view was taken.
+  PaperView GetElementsSince(const PaperVersion &since,
+                             ElementList *live = nullptr);
+  // `callback` is told what changed on the paper, from a thread of the
+  // printer's own. Changes are coalesced: however often the paper changes, it
+  // runs at most once per frame interval (default 16 ms, 0 = every change),
+  // and the change it gets covers everything since the previous call.
+  void SetRepaintCallback(void (*callback)(const PaperChange &, void *),
+                          void *param);
+  void SetFrameInterval(int ms);
+  void SetMaxColumns(int cols);
+
+  // --- Jobs -------------------------------------------------------------------
+  // A job ends when its connection closes, when it has been idle for
+  // `idleMs` (0 = never), and, if `perCut` is set, at every paper cut.
+  void SetJobIdleTimeout(int idleMs);
+  void SetJobPerCut(bool perCut);
+  // Finished jobs, in the order they reached the paper. Job `n` is looked up
+  // directly, so asking for the last receipt does not scan the roll.
+  size_t GetJobCount();
+  bool GetJob(size_t n, PrintJob &out);
+  bool FindJob(unsigned long long id, PrintJob &out); // by PrintJob::id
+  ElementList GetJobElements(size_t n);
+
+  // --- Retention --------------------------------------------------------------
+  // Limits on the finished jobs kept on the paper; 0 = no limit. Jobs leave
+  // only whole and oldest first, when a job is committed or a limit changes.
+  // Once a limit is passed, jobs are dropped until every limit is met with a
+  // quarter to spare, so the roll is rebuilt once per batch, not per job. The
+  // newest job always stays, even if it alone is over the byte limit.
+  void SetMaxJobs(size_t maxJobs);
+  void SetMaxPaperBytes(size_t maxBytes);
+  void SetMaxJobAge(int maxAgeSeconds);
+  PaperUsage GetPaperUsage();
+  IngestStats GetIngestStats();
+
+  // --- Status -----------------------------------------------------------------
+  // Status requests are answered from these as they are parsed. A change
+  // SetStatus() makes is pushed at once to every open session whose client
+  // enabled Automatic Status Back for it.
+  void SetStatus(const PrinterStatus &status);
+  PrinterStatus GetStatus();
+  void SetIdentity(const PrinterIdentity &identity);
+  PrinterIdentity GetIdentity();
+
+  // --- Throttling -------------------------------------------------------------
+  // Prints at the speed of `profile` from now on; the receive buffer applies
+  // to the connections opened afterwards. A default profile prints instantly.
+  void SetProfile(const PrinterProfile &profile);
+  PrinterProfile GetProfile();
+
+  // --- Limits -----------------------------------------------------------------
+  // The most any one parse buffer of a session may hold: an image, a 2D code
+  // or barcode payload, or the text of a line. Larger payloads are skipped
+  // and a longer line is printed in pieces, so one client's stream cannot
+  // grow the process without bound. Applies to the sessions opened
+  // afterwards; 0 = the default, 8 MB.
+  void SetSessionBufferLimit(size_t bytes);
+
+  // --- Archive ----------------------------------------------------------------
+  // While an archive file is open, the jobs that leave the paper (through the
+  // retention limits, Clear() or Reset()) are written to it and can be read
+  // back one at a time, without holding them in memory. See PaperArchive.
+  bool OpenArchive(const std::string &path); // UTF-8
+  void CloseArchive();
+  size_t GetArchivedJobCount();
+  bool GetArchivedJob(size_t n, PrintJob &out);
+  ElementList GetArchivedJobElements(size_t n);
+
+private:
+  // Committed jobs. Only holders of `mutex` append to the roll or replace
+  // it; readers take it with std::atomic_load and need no lock.
+  std::shared_ptr<PaperRoll> paper;
+  unsigned long long paperGeneration;
+  std::deque<PrintJob> jobs; // one record per job on the paper
+  // id -> position among all the jobs ever committed to the paper; minus
+  // jobsDropped, that is the job's index in `jobs`.
+  std::unordered_map<unsigned long long, unsigned long long> jobIndex;
+  unsigned long long jobsDropped; // left the paper, by Clear() or the limits
+  unsigned long long jobsEvicted; // by the limits alone
+  size_t paperBytes;                    // sum of the jobs' memoryBytes
+  std::mutex mutex;                     // guards the writers of the above
+  std::atomic<size_t> maxJobs;
+  std::atomic<size_t> maxPaperBytes;
+  std::atomic<int> maxJobAgeSeconds;
+  std::unique_ptr<PaperArchive> archive;
+  // Repaint notifications. Repaint() only marks the paper dirty; the
+  // notifier thread, started with the first callback, works out the change
+  // and calls the callback, then waits out the frame interval.
+  void (*repaintCallback)(const PaperChange &, void *);
+  void *repaintParam;
+  std::mutex notifyMutex; // guards the notifier state below
+  std::condition_variable notifyChanged;
+  std::thread notifyThread;
+  bool notifyStop;
+  bool repaintPending;
+  int frameIntervalMs;
+  PaperVersion notifiedVersion; // notifier thread only
+  std::atomic<int> maxColumns;
+  std::atomic<int> jobIdleMs;
+  std::atomic<bool> jobPerCut;
+  std::atomic<unsigned long long> nextJobId;
+
+  // The parser thread, started by the first PrinterSession::Feed(), and the
+  // sessions whose input rings have data for it. A session in the queue or
+  // being drained is not committed until it is out again.
+  std::mutex parseMutex; // guards the state below
+  std::condition_variable parseReady; // for the parser thread
+  std::deque<PrinterSession *> parseQueue;
+  std::thread parseThread;
+  bool parseStop;
+  std::atomic<size_t> ingestPeak;
+  std::atomic<unsigned long long> ingestStalls;
+  std::atomic<size_t> sessionBufferLimit;
+  std::atomic<unsigned long long> bufferCaps;
+  void ParseLoop();
+
+  std::vector<std::shared_ptr<PrinterSession> > sessions;
+  std::mutex sessionsMutex;
+  std::shared_ptr<PrinterSession> localSession; // ProcessData()
+
+  // NV bit images (FS q) belong to the printer, not to a connection: a logo
+  // stored by one job is printed by FS p in the next.
+  std::vector<StoredImage> nvImages; // addressed from 1 by FS p
+  std::mutex nvMutex;
+
+  PrinterStatus status;
+  PrinterIdentity identity;
+  PrinterProfile profile;
+  std::mutex statusMutex; // guards the three above
+
+  // The simulated mechanism: when, in steady_clock microseconds, the paper
+  // will have finished the motion asked of it so far. The parser waits for
+  // it between steps while `throttled`.
+  std::atomic<long long> mechanismFreeUs;
+  std::atomic<bool> throttled;
+
+  void Repaint();
+  void NotifyLoop();
+  // Replaces the paper with an empty roll. Called with `mutex` held.
+  void NewRoll();
+  // Drops the oldest jobs if a retention limit is passed, and rebuilds the
+  // roll without them. Called with `mutex` held.
+  void ApplyRetention();
+  // Hands the oldest `count` jobs, still on the current roll, to the archive.
+  // Called with `mutex` held.
+  void ArchiveJobs(size_t count);
+  // Removes `session` from the open sessions and commits its last job.
+  void CommitSession(PrinterSession *session);
+  // Appends `session`'s elements to the paper as the job `job`. Called with
+  // the session's mutex held.
+  void CommitJob(PrinterSession &session, PrintJob &job);
+  void ClearNvImages();
+  void AddNvImage(const StoredImage &img);
+  // Copies NV image `index` (from 1) into `out`; false if there is none.
+  bool GetNvImage(int index, StoredImage &out);
+};
@@ -10,7 +10,10 @@
 #include <vector>
 #include <string>
 #include <sstream>
+#include <memory>
+#include <mutex>
 #include "VirtualPrinter.h"
+#include "ByteRing.h"
 #include "FontA12x24.h"
 #include "FontB10x24.h"
 #include "Network.h"
@@ -26,6 +29,9 @@ static const wchar_t* REG_VAL_WIN_H = L"WinH";
 static const wchar_t* REG_VAL_WIN_MAX = L"WinMax";
 static const wchar_t* REG_VAL_FONTE = L"Fonte";
 static const wchar_t* REG_VAL_ALWAYSONTOP = L"AlwaysOnTop";
+static const wchar_t* REG_VAL_MEMORIA = L"LimiteMemoria";
+static const wchar_t* REG_VAL_CAPTURA = L"CapturaKB";
+static const wchar_t* REG_VAL_VELOCIDADE_REAL = L"VelocidadeReal";
 
 static const wchar_t* STR_INSTALAR_IMPRESSORA = L"Instalar Impressora Virtual";
 
@@ -58,15 +64,36 @@ VirtualPrinter printer;
 NetworkServer server;
 HWND hMainWindow;
 HINSTANCE hAppInstance;
+// The elements as last painted: the committed paper up to g_paperVersion,
+// then the live output of the jobs still printing. Elements only point at
+// their text and bitmaps; g_paper and g_liveElements own them.
 std::vector<PrinterElement> currentElements;
-std::vector<unsigned char> g_rawBuffer;
-const size_t MAX_BUFFER_SIZE = 1024 * 1024; // 1MB Limit
+PaperVersion g_paperVersion;
+size_t g_committedElements = 0;
+// Where, in paper pixels, the line holding the end of the committed paper
+// started at the last paint: what the printer appends can only change the
+// paper from there down.
+int g_changeTop = 0;
+PaperView g_paper;
+ElementList g_liveElements;
+// The archived receipt shown instead of the paper, from 1; 0 shows the paper.
+int g_archivedJob = 0;
+ElementList g_archivedElements;
+// What was received, for "Salvar": the last bytes of all the connections
+// together, and those of the last connection to close, which is normally one
+// receipt. Connections append from their own threads.
+ByteRing g_rawCapture(1024 * 1024);
+std::shared_ptr<ByteRing> g_lastConnection;
 float currentY = 10.0f;
 float scale = 1.0f; // Zoom factor, maybe?
 
 // Settings
 int g_porta = 9100;
 int g_colunas = 0;
+// Paper kept in memory, in MB; the oldest receipts are dropped past it.
+int g_memoriaMB = 256;
+// Size of each raw capture ring, in KB.
+int g_capturaKB = 1024;
 // The Font A cell is 12x24, so 24 draws it dot for dot: one pixel per dot, and
 // 48 columns across the 576 dots of 80 mm paper. Other sizes scale the matrix.
 int g_fontSize = 24;
@@ -77,6 +104,8 @@ int g_winW = 530;
 int g_winH = 700;
 bool g_winMax = false;
 bool g_alwaysOnTop = false;
+// Print at the pace of a real printer instead of at once (see RealSpeedProfile).
+bool g_velocidadeReal = false;
 
 // ---- Registry helpers ----
 
@@ -121,6 +150,21 @@ void LoadSettings() {
             g_alwaysOnTop = (dwValue != 0);
         }
 
+        dwSize = sizeof(DWORD);
+        if (RegQueryValueEx(hKey, REG_VAL_MEMORIA, NULL, &dwType, (LPBYTE)&dwValue, &dwSize) == ERROR_SUCCESS) {
+            g_memoriaMB = (int)dwValue;
+        }
+
+        dwSize = sizeof(DWORD);
+        if (RegQueryValueEx(hKey, REG_VAL_CAPTURA, NULL, &dwType, (LPBYTE)&dwValue, &dwSize) == ERROR_SUCCESS) {
+            if ((int)dwValue > 0) g_capturaKB = (int)dwValue;
+        }
+
+        dwSize = sizeof(DWORD);
+        if (RegQueryValueEx(hKey, REG_VAL_VELOCIDADE_REAL, NULL, &dwType, (LPBYTE)&dwValue, &dwSize) == ERROR_SUCCESS) {
+            g_velocidadeReal = (dwValue != 0);
+        }
+
         RegCloseKey(hKey);
     }
 }
@@ -170,6 +214,15 @@ void SaveSettings() {
         dwValue = g_alwaysOnTop ? 1 : 0;
         RegSetValueEx(hKey, REG_VAL_ALWAYSONTOP, 0, REG_DWORD, (LPBYTE)&dwValue, sizeof(DWORD));
 
+        dwValue = (DWORD)g_memoriaMB;
+        RegSetValueEx(hKey, REG_VAL_MEMORIA, 0, REG_DWORD, (LPBYTE)&dwValue, sizeof(DWORD));
+
+        dwValue = (DWORD)g_capturaKB;
+        RegSetValueEx(hKey, REG_VAL_CAPTURA, 0, REG_DWORD, (LPBYTE)&dwValue, sizeof(DWORD));
+
+        dwValue = g_velocidadeReal ? 1 : 0;
+        RegSetValueEx(hKey, REG_VAL_VELOCIDADE_REAL, 0, REG_DWORD, (LPBYTE)&dwValue, sizeof(DWORD));
+
         RegCloseKey(hKey);
     }
 }
@@ -183,12 +236,27 @@ HMENU CreateMainMenu() {
     AppendMenu(hSubMenu, MF_STRING, IDM_PORTA, L"&Porto...");
     AppendMenu(hSubMenu, MF_STRING, IDM_COLUNAS, L"&Colunas...");
     AppendMenu(hSubMenu, MF_STRING, IDM_FONTE, L"&Tamanho do texto...");
+    AppendMenu(hSubMenu, MF_STRING, IDM_MEMORIA, L"Limite de &memória...");
+    AppendMenu(hSubMenu, MF_STRING, IDM_ARQUIVO, L"Recibo &arquivado...");
+    AppendMenu(hSubMenu, MF_STRING, IDM_CAPTURA, L"Tamanho da ca&ptura...");
     AppendMenu(hSubMenu, MF_STRING | (g_alwaysOnTop ? MF_CHECKED : MF_UNCHECKED), IDM_ALWAYSONTOP, L"&Sempre no topo");
+
+    // What the printer answers to status requests (DLE EOT, GS r, ASB), to
+    // see how the point of sale copes with a printer that needs attention.
+    HMENU hEstado = CreatePopupMenu();
+    AppendMenu(hEstado, MF_STRING, IDM_ESTADO_TAMPA, L"&Tampa aberta");
+    AppendMenu(hEstado, MF_STRING, IDM_ESTADO_POUCO_PAPEL, L"Papel &quase no fim");
+    AppendMenu(hEstado, MF_STRING, IDM_ESTADO_SEM_PAPEL, L"Sem &papel");
+    AppendMenu(hEstado, MF_STRING, IDM_ESTADO_GAVETA, L"&Gaveta aberta");
+    AppendMenu(hEstado, MF_STRING, IDM_ESTADO_GUILHOTINA, L"Erro da g&uilhotina");
+    AppendMenu(hSubMenu, MF_POPUP, (UINT_PTR)hEstado, L"&Estado da impressora");
+    AppendMenu(hSubMenu, MF_STRING | (g_velocidadeReal ? MF_CHECKED : MF_UNCHECKED), IDM_VELOCIDADE_REAL, L"&Velocidade real (250 mm/s)");
     AppendMenu(hSubMenu, MF_SEPARATOR, 0, NULL);
     AppendMenu(hSubMenu, MF_STRING, IDM_INSTALAR_DRIVER, L"&Instalar Impressora Virtual");
     AppendMenu(hSubMenu, MF_SEPARATOR, 0, NULL);
     AppendMenu(hSubMenu, MF_STRING, IDM_LIMPAR, L"&Limpar");
     AppendMenu(hSubMenu, MF_STRING, IDM_SALVAR, L"Salvar");
+    AppendMenu(hSubMenu, MF_STRING, IDM_SALVAR_LIGACAO, L"Salvar última ligação");
     AppendMenu(hSubMenu, MF_STRING, IDM_SAIR, L"&Sair");
 
     AppendMenu(hMenu, MF_POPUP, (UINT_PTR)hSubMenu, L"&Menu");
@@ -249,21 +317,178 @@ INT_PTR ShowInputDialog(HWND hParent, const wchar_t* title, int currentValue) {
 }
 
 
-// Update the window title with current port
+// Update the window title with current port and the memory the paper holds,
+// or with the archived receipt on show
 void UpdateWindowTitle() {
     wchar_t title[128];
-    _snwprintf_s(title, _countof(title), _TRUNCATE, L"Impressora ESC/POS Virtual (Porto %d)", g_porta);
+    if (g_archivedJob > 0) {
+        _snwprintf_s(title, _countof(title), _TRUNCATE, L"Impressora ESC/POS Virtual (Porto %d) - Recibo arquivado %d de %u",
+            g_porta, g_archivedJob, (unsigned)printer.GetArchivedJobCount());
+    } else {
+        PaperUsage usage = printer.GetPaperUsage();
+        _snwprintf_s(title, _countof(title), _TRUNCATE, L"Impressora ESC/POS Virtual (Porto %d) - %.1f MB",
+            g_porta, (usage.bytes + usage.liveBytes) / (1024.0 * 1024.0));
+    }
     SetWindowText(hMainWindow, title);
 }
 
-// Function to handle repaint
-void UpdatePrinter(void* param) {
+// Function to handle repaint. The printer calls it at most once a frame, from
+// a thread of its own.
+void UpdatePrinter(const PaperChange& change, void* param) {
     // Post message to UI thread to trigger repaint safely
     if (hMainWindow) {
-        PostMessage(hMainWindow, WM_USER + 1, 0, 0);
+        PostMessage(hMainWindow, WM_USER + 1, change.restarted ? 1 : 0, 0);
+    }
+}
+
+// Invalidates what a paper change can have touched: everything when the paper
+// was restarted, otherwise only from the line where the committed paper ended
+// at the last paint. Jobs committed since then come after it, and the live
+// output is always below it.
+void InvalidatePaperChange(HWND hwnd, bool restarted) {
+    if (g_archivedJob > 0) return; // the archived receipt does not change
+    if (restarted) {
+        InvalidateRect(hwnd, NULL, TRUE);
+        return;
+    }
+    RECT rect;
+    GetClientRect(hwnd, &rect);
+    SCROLLINFO si;
+    si.cbSize = sizeof(si);
+    si.fMask = SIF_POS;
+    GetScrollInfo(hwnd, SB_VERT, &si);
+    int top = g_changeTop - si.nPos;
+    if (top < rect.top) top = rect.top;
+    // Below the window, the change still needs a paint for the scroll range.
+    if (top > rect.bottom - 1) top = rect.bottom - 1;
+    rect.top = top;
+    InvalidateRect(hwnd, &rect, TRUE);
+}
+
+// Asks for a file name and writes what `capture` holds to it, oldest first.
+void SaveCapture(HWND hwnd, ByteRing& capture) {
+    if (capture.Size() == 0) return;
+    wchar_t filename[MAX_PATH] = L"impressora.txt";
+    OPENFILENAME ofn = { 0 };
+    ofn.lStructSize = sizeof(ofn);
+    ofn.hwndOwner = hwnd;
+    ofn.lpstrFilter = L"Text Files (*.txt)\0*.txt\0All Files (*.*)\0*.*\0";
+    ofn.lpstrFile = filename;
+    ofn.nMaxFile = MAX_PATH;
+    ofn.lpstrDefExt = L"txt";
+    ofn.Flags = OFN_OVERWRITEPROMPT | OFN_PATHMUSTEXIST;
+
+    if (GetSaveFileName(&ofn)) {
+        HANDLE hFile = CreateFile(filename, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (hFile != INVALID_HANDLE_VALUE) {
+            capture.ForEachSpan([hFile](const unsigned char* data, size_t len) {
+                DWORD written;
+                WriteFile(hFile, data, (DWORD)len, &written, NULL);
+            });
+            CloseHandle(hFile);
+            MessageBox(hwnd, L"Ficheiro guardado com sucesso.", L"Sucesso", MB_OK | MB_ICONINFORMATION);
+        } else {
+            MessageBox(hwnd, L"Erro ao criar ficheiro.", L"Erro", MB_OK | MB_ICONERROR);
+        }
     }
 }
 
+// "Velocidade real": a typical 80 mm thermal printer, 250 mm/s with a 4 KB
+// receive buffer, to see how the point of sale copes with its pace.
+PrinterProfile RealSpeedProfile() {
+    PrinterProfile profile;
+    profile.printSpeedMmPerSec = 250;
+    profile.cutMs = 300;
+    profile.receiveBufferBytes = 4096;
+    return profile;
+}
+
+// A terminal that connects and never sends, or opens connection after
+// connection, must not keep the others from printing.
+NetworkServer::Limits ServerLimits() {
+    NetworkServer::Limits limits;
+    limits.maxConnections = 32;
+    limits.queueLength = 32;
+    limits.idleTimeoutMs = 5 * 60 * 1000;
+    return limits;
+}
+
+// Starts listening on g_porta. Each connection prints through its own printer
+// session, so simultaneous jobs keep their own styles, and its output reaches
+// the paper as one job when the connection closes. The connection's thread
+// only hands over what fits in the session's input ring; the printer's parser
+// thread prints it and has the connection read again once there is room.
+bool StartServer() {
+    PrinterProfile profile = g_velocidadeReal ? RealSpeedProfile() : PrinterProfile();
+    printer.SetProfile(profile);
+    server.SetLimits(ServerLimits());
+    std::vector<NetworkServer::Endpoint> endpoints(1);
+    endpoints[0].port = g_porta;
+    endpoints[0].receiveBufferBytes = (int)profile.receiveBufferBytes;
+    endpoints[0].onAccept = [](const NetworkServer::Writer& writer) {
+        std::shared_ptr<PrinterSession> session = printer.OpenSession(
+            [writer](const unsigned char* data, int len) { writer.Send(data, len); },
+            [writer]() { writer.Resume(); });
+        std::shared_ptr<ByteRing> capture = std::make_shared<ByteRing>((size_t)g_capturaKB * 1024);
+        NetworkServer::ConnectionCallbacks callbacks;
+        callbacks.onData = [session, capture](const unsigned char* data, int len) {
+            int taken = session->Feed(data, len);
+            // The rest comes again once the printer has room.
+            g_rawCapture.Append(data, taken);
+            capture->Append(data, taken);
+            return taken;
+        };
+        callbacks.onClose = [session, capture]() {
+            session->Close();
+            if (capture->Size() > 0) std::atomic_store(&g_lastConnection, capture);
+        };
+        return callbacks;
+    };
+    return server.Start(endpoints);
+}
+
+// Opens today's receipt archive, %LOCALAPPDATA%\MAPENO\VirtualESCPOS\recibos-AAAAMMDD.bin:
+// the receipts that leave the paper go there instead of being lost.
+void OpenReceiptArchive() {
+    const wchar_t* base = _wgetenv(L"LOCALAPPDATA");
+    if (!base) return;
+    std::wstring dir = std::wstring(base) + L"\\MAPENO";
+    CreateDirectory(dir.c_str(), NULL);
+    dir += L"\\VirtualESCPOS";
+    CreateDirectory(dir.c_str(), NULL);
+
+    SYSTEMTIME now;
+    GetLocalTime(&now);
+    wchar_t name[64];
+    _snwprintf_s(name, _countof(name), _TRUNCATE, L"\\recibos-%04d%02d%02d.bin", now.wYear, now.wMonth, now.wDay);
+    std::wstring path = dir + name;
+
+    int n = WideCharToMultiByte(CP_UTF8, 0, path.c_str(), -1, NULL, 0, NULL, NULL);
+    if (n <= 0) return;
+    std::string utf8(n, '\0');
+    WideCharToMultiByte(CP_UTF8, 0, path.c_str(), -1, &utf8[0], n, NULL, NULL);
+    utf8.resize(n - 1);
+    printer.OpenArchive(utf8);
+}
+
+// Brings currentElements up to date for a repaint. Only what changed since
+// the last one is fetched: the jobs committed since then and the output of the
+// jobs still printing, which replaces the previous live tail.
+const std::vector<PrinterElement>& RefreshElements() {
+    PaperView added = printer.GetElementsSince(g_paperVersion, &g_liveElements);
+    if (added.restarted()) g_committedElements = 0;
+    currentElements.erase(currentElements.begin() + g_committedElements,
+                          currentElements.end());
+    currentElements.reserve(currentElements.size() + added.size() + g_liveElements.size());
+    for (size_t i = 0; i < added.size(); ++i) currentElements.push_back(added[i]);
+    g_committedElements = currentElements.size();
+    g_paperVersion = added.version();
+    g_paper = added; // keeps the roll, and with it the payloads, alive
+    const std::vector<PrinterElement>& live = g_liveElements.Elements();
+    currentElements.insert(currentElements.end(), live.begin(), live.end());
+    return currentElements;
+}
+
 void UpdateScroll(HWND hwnd, int totalHeight) {
     RECT rect;
     GetClientRect(hwnd, &rect);
@@ -357,9 +582,9 @@ static FontCell FontCellFor(int font) {
 // of the Font A cell, so the other fonts follow from the ratio of the cells:
 // Font B is as tall as Font A, Font C two thirds of it.
 static int ElementFontHeight(const PrinterElement& el, int fontSize) {
-    int baseHeight = MulDiv(fontSize, FontCellFor(el.font).cellH, FONT_A_HEIGHT);
+    int baseHeight = MulDiv(fontSize, FontCellFor(el.Style().font).cellH, FONT_A_HEIGHT);
     if (baseHeight < 1) baseHeight = 1;
-    return baseHeight * el.heightScale;
+    return baseHeight * el.Style().heightScale;
 }
 
 // Width of the Font A cell for a given text size. The cell is 12 dots wide and
@@ -381,31 +606,31 @@ static int DotsToPixels(int dots, int charWidth) {
 // cell narrowed in the ratio of the two cells, so Font B comes out 10 dots
 // wide where Font A is 12 - which is what puts 57 columns on the line.
 static int ElementNaturalWidth(const PrinterElement& el, int charWidth) {
-    int w = MulDiv(charWidth, FontCellFor(el.font).cellW, FONT_A_WIDTH);
+    int w = MulDiv(charWidth, FontCellFor(el.Style().font).cellW, FONT_A_WIDTH);
     return w < 1 ? 1 : w;
 }
 
 // Width in pixels of one character cell, the horizontal multiplier from
 // ESC ! / GS ! included.
 static int ElementCellWidth(const PrinterElement& el, int charWidth) {
-    return ElementNaturalWidth(el, charWidth) * el.widthScale;
+    return ElementNaturalWidth(el, charWidth) * el.Style().widthScale;
 }
 
 // Extra pixels inserted after each glyph, from ESC SP.
 static int ElementCharExtra(const PrinterElement& el, int charWidth) {
-    return DotsToPixels(el.charSpacing, charWidth);
+    return DotsToPixels(el.Style().charSpacing, charWidth);
 }
 
 // Width of one cell of an ESC V rotated run: a glyph turned 90 degrees is as
 // wide as the font is tall.
 static int RotatedCellWidth(const PrinterElement& el, int fontSize, int charWidth) {
-    int cell = ElementFontHeight(el, fontSize) + DotsToPixels(el.charSpacing, charWidth);
+    int cell = ElementFontHeight(el, fontSize) + DotsToPixels(el.Style().charSpacing, charWidth);
     return cell < 1 ? 1 : cell;
 }
 
 // Distance from one character to the next, ESC SP spacing included.
 static int ElementAdvance(const PrinterElement& el, int fontSize, int charWidth) {
-    if (el.isRotated90) return RotatedCellWidth(el, fontSize, charWidth);
+    if (el.Style().isRotated90) return RotatedCellWidth(el, fontSize, charWidth);
     return ElementCellWidth(el, charWidth) + ElementCharExtra(el, charWidth);
 }
 
@@ -413,7 +638,7 @@ static int ElementAdvance(const PrinterElement& el, int fontSize, int charWidth)
 // this is arithmetic rather than a question for the font engine - which is the
 // point of a dot matrix font: 48 columns are 48 cells wide, exactly.
 static int ElementTextWidth(const PrinterElement& el, int fontSize, int charWidth) {
-    return ElementAdvance(el, fontSize, charWidth) * (int)el.text.length();
+    return ElementAdvance(el, fontSize, charWidth) * (int)el.TextLength();
 }
 
 // Total pixel width of the run of TEXT elements starting at startIdx, up to the
@@ -444,7 +669,7 @@ static int MeasureTextLineHeight(const std::vector<PrinterElement>& elements, si
 static bool LineHasUpsideDown(const std::vector<PrinterElement>& elements, size_t startIdx) {
     for (size_t i = startIdx; i < elements.size(); ++i) {
         if (elements[i].type != ELEMENT_TEXT) break;
-        if (elements[i].isUpsideDown) return true;
+        if (elements[i].Style().isUpsideDown) return true;
     }
     return false;
 }
@@ -479,12 +704,13 @@ static void BuildTextBitmap(const PrinterElement& el, int fontSize, int charWidt
                             std::vector<unsigned char>* bits, int* outW, int* outH) {
     *outW = 0;
     *outH = 0;
-    int count = (int)el.text.length();
+    const ElementStyle& style = el.Style();
+    int count = (int)el.TextLength();
     int advance = ElementAdvance(el, fontSize, charWidth);
     // Turned 90 degrees, a glyph is as wide as the cell is tall and vice versa.
-    int cellW = el.isRotated90 ? ElementFontHeight(el, fontSize)
+    int cellW = style.isRotated90 ? ElementFontHeight(el, fontSize)
                                : ElementCellWidth(el, charWidth);
-    int height = el.isRotated90 ? ElementCellWidth(el, charWidth)
+    int height = style.isRotated90 ? ElementCellWidth(el, charWidth)
                                 : ElementFontHeight(el, fontSize);
     int width = advance * count;
     if (count < 1 || width < 1 || height < 1 || cellW < 1) return;
@@ -492,7 +718,7 @@ static void BuildTextBitmap(const PrinterElement& el, int fontSize, int charWidt
     int stride = ((width + 31) / 32) * 4; // DIB rows are DWORD aligned
     bits->assign((size_t)stride * height, 0xFF);
 
-    FontCell cell = FontCellFor(el.font);
+    FontCell cell = FontCellFor(style.font);
     // ESC - underlines the whole cell, so the rule goes on the bottom dot row
     // rather than immediately under the glyph: descenders reach row 22.
     const int underlineRow = cell.srcH - 1;
@@ -504,25 +730,25 @@ static void BuildTextBitmap(const PrinterElement& el, int fontSize, int charWidt
             unsigned char* row = &(*bits)[(size_t)dy * stride];
             for (int dx = 0; dx < advance; ++dx) {
                 bool ink = false;
-                if (el.isRotated90) {
+                if (style.isRotated90) {
                     // ESC V turns each glyph 90 degrees clockwise while the
                     // line still runs left to right, so the glyph's bottom edge
                     // ends up on the left and its left edge on top.
                     if (dx < cellW) {
                         int sy = cell.srcH - 1 - dx * cell.srcH / cellW;
                         int sx = dy * cell.srcW / height;
-                        ink = (el.isUnderline && sy == underlineRow) ||
-                              GlyphDot(cell, glyph, sx, sy, el.isBold);
+                        ink = (style.isUnderline && sy == underlineRow) ||
+                              GlyphDot(cell, glyph, sx, sy, style.isBold);
                     }
                 } else {
                     int sy = dy * cell.srcH / height;
-                    ink = el.isUnderline && sy == underlineRow;
+                    ink = style.isUnderline && sy == underlineRow;
                     if (!ink && dx < cellW) {
-                        ink = GlyphDot(cell, glyph, dx * cell.srcW / cellW, sy, el.isBold);
+                        ink = GlyphDot(cell, glyph, dx * cell.srcW / cellW, sy, style.isBold);
                     }
                 }
                 // GS B swaps ink and paper over the whole cell.
-                if (ink != el.isReverse) {
+                if (ink != style.isReverse) {
                     int px = originX + dx;
                     row[px / 8] &= (unsigned char)~(0x80 >> (px % 8));
                 }
@@ -566,7 +792,7 @@ static void DrawTextSegment(HDC hdc, const PrinterElement& el, int x, int y,
     BuildTextBitmap(el, fontSize, charWidth, &bits, &w, &h);
     if (w > 0 && h > 0) {
         BlitTextBitmap(hdc, bits, w, h, x, y,
-                       el.isRed ? RGB(255, 0, 0) : RGB(0, 0, 0));
+                       el.Style().isRed ? RGB(255, 0, 0) : RGB(0, 0, 0));
     }
 
     if (outSize) {
@@ -673,9 +899,9 @@ static void DrawBitmapElement(HDC hdc, const PrinterElement& el, int x, int y,
     std::vector<unsigned char> actualData;
     if (el.isColumnFormat) {
         // Convert GS * format to Raster
-        actualData = ConvertColumnToRaster(el.bitmapData, w / 8, h / 8);
+        actualData = ConvertColumnToRaster(*el.bitmap, w / 8, h / 8);
     } else {
-        actualData = el.bitmapData;
+        actualData = *el.bitmap;
     }
 
     std::vector<unsigned char> dibData = ConvertToDIB(actualData, wBytes, h);
@@ -716,24 +942,7 @@ LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
                 // Restart the server on the new port
                 if (g_porta != oldPort) {
                     server.Stop();
-                    if (!server.Start(g_porta, [](const unsigned char* data, int len) {
-                        printer.ProcessData(data, len);
-
-                        // Buffer data logic
-                        if (g_rawBuffer.size() + len > MAX_BUFFER_SIZE) {
-                            size_t overflow = (g_rawBuffer.size() + len) - MAX_BUFFER_SIZE;
-                            if (overflow < g_rawBuffer.size()) {
-                                g_rawBuffer.erase(g_rawBuffer.begin(), g_rawBuffer.begin() + overflow);
-                            } else {
-                                g_rawBuffer.clear();
-                                if ((size_t)len > MAX_BUFFER_SIZE) {
-                                     data += (len - MAX_BUFFER_SIZE);
-                                     len = MAX_BUFFER_SIZE;
-                                }
-                            }
-                        }
-                        g_rawBuffer.insert(g_rawBuffer.end(), data, data + len);
-                    })) {
+                    if (!StartServer()) {
                         wchar_t msg[128];
                         _snwprintf_s(msg, _countof(msg), _TRUNCATE,
                             L"Falha ao iniciar o servidor no porto %d.\nO porto pode estar em uso.", g_porta);
@@ -744,28 +953,21 @@ LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
             return 0;
         }
         case IDM_SALVAR:
+            SaveCapture(hwnd, g_rawCapture);
+            return 0;
+        case IDM_SALVAR_LIGACAO:
         {
-            if (g_rawBuffer.empty()) return 0;
-            wchar_t filename[MAX_PATH] = L"impressora.txt";
-            OPENFILENAME ofn = { 0 };
-            ofn.lStructSize = sizeof(ofn);
-            ofn.hwndOwner = hwnd;
-            ofn.lpstrFilter = L"Text Files (*.txt)\0*.txt\0All Files (*.*)\0*.*\0";
-            ofn.lpstrFile = filename;
-            ofn.nMaxFile = MAX_PATH;
-            ofn.lpstrDefExt = L"txt";
-            ofn.Flags = OFN_OVERWRITEPROMPT | OFN_PATHMUSTEXIST;
-
-            if (GetSaveFileName(&ofn)) {
-                HANDLE hFile = CreateFile(filename, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
-                if (hFile != INVALID_HANDLE_VALUE) {
-                    DWORD written;
-                    WriteFile(hFile, g_rawBuffer.data(), (DWORD)g_rawBuffer.size(), &written, NULL);
-                    CloseHandle(hFile);
-                    MessageBox(hwnd, L"Ficheiro guardado com sucesso.", L"Sucesso", MB_OK | MB_ICONINFORMATION);
-                } else {
-                    MessageBox(hwnd, L"Erro ao criar ficheiro.", L"Erro", MB_OK | MB_ICONERROR);
-                }
+            std::shared_ptr<ByteRing> last = std::atomic_load(&g_lastConnection);
+            if (last) SaveCapture(hwnd, *last);
+            return 0;
+        }
+        case IDM_CAPTURA:
+        {
+            INT_PTR newSize = ShowInputDialog(hwnd, L"Tamanho da captura em KB", g_capturaKB);
+            if (newSize > 0) {
+                g_capturaKB = (int)newSize;
+                SaveSettings();
+                g_rawCapture.SetCapacity((size_t)g_capturaKB * 1024);
             }
             return 0;
         }
@@ -779,12 +981,39 @@ LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
             }
             return 0;
         }
+        case IDM_ARQUIVO:
+        {
+            size_t count = printer.GetArchivedJobCount();
+            wchar_t prompt[96];
+            _snwprintf_s(prompt, _countof(prompt), _TRUNCATE, L"Recibo arquivado (1 a %u, 0 = papel)", (unsigned)count);
+            INT_PTR n = ShowInputDialog(hwnd, prompt, g_archivedJob);
+            if (n >= 0 && (size_t)n <= count) {
+                g_archivedJob = (int)n;
+                // Read back from the archive only now, and only this receipt.
+                g_archivedElements = n > 0 ? printer.GetArchivedJobElements((size_t)n - 1) : ElementList();
+                UpdateWindowTitle();
+                InvalidateRect(hwnd, NULL, TRUE);
+            }
+            return 0;
+        }
+        case IDM_MEMORIA:
+        {
+            INT_PTR newLimit = ShowInputDialog(hwnd, L"Limite de memória em MB (0 = sem limite)", g_memoriaMB);
+            if (newLimit >= 0) {
+                g_memoriaMB = (int)newLimit;
+                SaveSettings();
+                printer.SetMaxPaperBytes((size_t)g_memoriaMB * 1024 * 1024);
+                UpdateWindowTitle();
+            }
+            return 0;
+        }
         case IDM_LIMPAR:
         {
-             if (g_rawBuffer.empty()) return 0;
+             if (g_rawCapture.Size() == 0) return 0;
              if (MessageBox(hwnd, L"Tem a certeza que deseja limpar tudo?", L"Confirmar", MB_YESNO | MB_ICONQUESTION) == IDYES) {
                  printer.Clear();
-                 g_rawBuffer.clear();
+                 g_rawCapture.Clear();
+                 std::atomic_store(&g_lastConnection, std::shared_ptr<ByteRing>());
                  // Force repaint
                  InvalidateRect(hwnd, NULL, TRUE);
              }
@@ -817,6 +1046,45 @@ LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
             SaveSettings();
             return 0;
         }
+        case IDM_ESTADO_TAMPA:
+        case IDM_ESTADO_POUCO_PAPEL:
+        case IDM_ESTADO_SEM_PAPEL:
+        case IDM_ESTADO_GAVETA:
+        case IDM_ESTADO_GUILHOTINA:
+        {
+            PrinterStatus status = printer.GetStatus();
+            bool* flag = LOWORD(wParam) == IDM_ESTADO_TAMPA ? &status.coverOpen :
+                         LOWORD(wParam) == IDM_ESTADO_POUCO_PAPEL ? &status.paperNearEnd :
+                         LOWORD(wParam) == IDM_ESTADO_SEM_PAPEL ? &status.paperEnd :
+                         LOWORD(wParam) == IDM_ESTADO_GAVETA ? &status.drawerOpen :
+                         &status.cutterError;
+            *flag = !*flag;
+            printer.SetStatus(status); // clients with ASB on are told at once
+
+            HMENU hMenu = GetMenu(hwnd);
+            if (hMenu) {
+                CheckMenuItem(hMenu, LOWORD(wParam), *flag ? MF_CHECKED : MF_UNCHECKED);
+            }
+            return 0;
+        }
+        case IDM_VELOCIDADE_REAL:
+        {
+            g_velocidadeReal = !g_velocidadeReal;
+            SaveSettings();
+            HMENU hMenu = GetMenu(hwnd);
+            if (hMenu) {
+                CheckMenuItem(hMenu, IDM_VELOCIDADE_REAL, g_velocidadeReal ? MF_CHECKED : MF_UNCHECKED);
+            }
+            // The receive buffer belongs to the listening socket: restart it.
+            server.Stop();
+            if (!StartServer()) {
+                wchar_t msg[128];
+                _snwprintf_s(msg, _countof(msg), _TRUNCATE,
+                    L"Falha ao iniciar o servidor no porto %d.\nO porto pode estar em uso.", g_porta);
+                MessageBox(hwnd, msg, L"Erro", MB_OK | MB_ICONERROR);
+            }
+            return 0;
+        }
         case IDM_INSTALAR_DRIVER:
         {
             wchar_t psPath[MAX_PATH];
@@ -987,7 +1255,8 @@ LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
         FillRect(hdc, &rect, (HBRUSH)GetStockObject(WHITE_BRUSH));
 
         // Get elements thread-safely
-        std::vector<PrinterElement> elements = printer.GetElements();
+        const std::vector<PrinterElement>& elements =
+            g_archivedJob > 0 ? g_archivedElements.Elements() : RefreshElements();
 
         // Get Scroll Pos
         SCROLLINFO scrollSi;
@@ -1028,13 +1297,13 @@ LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
 
         // Left edge of the printable area for an element, honouring GS L.
         auto elementBaseX = [&](const PrinterElement& el) -> int {
-            return leftMargin + DotsToPixels(el.marginLeft, charWidth);
+            return leftMargin + DotsToPixels(el.Style().marginLeft, charWidth);
         };
 
         // Width of the printable area: GS W if set, else the configured paper
         // width, else whatever the window gives us.
         auto elementAreaWidth = [&](const PrinterElement& el) -> int {
-            if (el.areaWidth > 0) return DotsToPixels(el.areaWidth, charWidth);
+            if (el.Style().areaWidth > 0) return DotsToPixels(el.Style().areaWidth, charWidth);
             if (paperWidth > 0) return paperWidth;
             return rect.right - elementBaseX(el) - leftMargin;
         };
@@ -1043,8 +1312,8 @@ LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
             int base = elementBaseX(el);
             int areaW = elementAreaWidth(el);
             int startX = base;
-            if (el.align == 1) startX = base + (areaW - contentWidth) / 2;
-            else if (el.align == 2) startX = base + areaW - contentWidth;
+            if (el.Style().align == 1) startX = base + (areaW - contentWidth) / 2;
+            else if (el.Style().align == 2) startX = base + areaW - contentWidth;
             if (startX < base) startX = base;
             return startX;
         };
@@ -1057,9 +1326,16 @@ LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
         int pageSavedDC = 0;
 
         bool atLineStart = true;
+        bool changeTopFound = g_archivedJob > 0;
         for (size_t idx = 0; idx < elements.size(); ++idx) {
             const PrinterElement& el = elements[idx];
 
+            // y is the top of the line (or page) this element is on.
+            if (!changeTopFound && idx >= g_committedElements) {
+                g_changeTop = y + yScrollOffset;
+                changeTopFound = true;
+            }
+
             if (el.type == ELEMENT_PAGE_BEGIN) {
                 if (!atLineStart) {
                     y += currentLineMaxHeight + 4;
@@ -1258,6 +1534,7 @@ LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
         }
 
         if (pageSavedDC) RestoreDC(hdc, pageSavedDC); // page left open by a truncated stream
+        if (!changeTopFound) g_changeTop = y + yScrollOffset; // nothing live
 
         SelectObject(hdc, oldPen);
         SelectObject(hdc, oldFont);
@@ -1275,7 +1552,8 @@ LRESULT CALLBACK WindowProc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
     return 0;
 
     case WM_USER + 1:
-        InvalidateRect(hwnd, NULL, TRUE);
+        UpdateWindowTitle();
+        InvalidatePaperChange(hwnd, wParam != 0);
         return 0;
 
     }
@@ -1334,26 +1612,12 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, PWSTR pCmdLine
 
     // Apply columns setting to the printer
     printer.SetMaxColumns(g_colunas);
+    printer.SetMaxPaperBytes((size_t)g_memoriaMB * 1024 * 1024);
+    OpenReceiptArchive();
+    g_rawCapture.SetCapacity((size_t)g_capturaKB * 1024);
 
     // Start network server on the configured port
-    if (!server.Start(g_porta, [](const unsigned char* data, int len) {
-        printer.ProcessData(data, len);
-        
-        // Buffer data logic
-        if (g_rawBuffer.size() + len > MAX_BUFFER_SIZE) {
-            size_t overflow = (g_rawBuffer.size() + len) - MAX_BUFFER_SIZE;
-            if (overflow < g_rawBuffer.size()) {
-                g_rawBuffer.erase(g_rawBuffer.begin(), g_rawBuffer.begin() + overflow);
-            } else {
-                g_rawBuffer.clear();
-                if ((size_t)len > MAX_BUFFER_SIZE) {
-                        data += (len - MAX_BUFFER_SIZE);
-                        len = MAX_BUFFER_SIZE;
-                }
-            }
-        }
-        g_rawBuffer.insert(g_rawBuffer.end(), data, data + len);
-    })) {
+    if (!StartServer()) {
         wchar_t msg[128];
         _snwprintf_s(msg, _countof(msg), _TRUNCATE,
             L"Falha ao iniciar o servidor no porto %d.\nO porto pode estar em uso.", g_porta);
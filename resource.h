@@ -13,6 +13,16 @@
 #define IDM_LIMPAR      206
 #define IDM_ALWAYSONTOP 207
 #define IDM_INSTALAR_DRIVER 208
+#define IDM_MEMORIA     209
+#define IDM_ARQUIVO     210
+#define IDM_SALVAR_LIGACAO 211
+#define IDM_CAPTURA     212
+#define IDM_ESTADO_TAMPA        213
+#define IDM_ESTADO_POUCO_PAPEL  214
+#define IDM_ESTADO_SEM_PAPEL    215
+#define IDM_ESTADO_GAVETA       216
+#define IDM_ESTADO_GUILHOTINA   217
+#define IDM_VELOCIDADE_REAL     218
 
 // Dialog IDs
 #define IDD_INPUT_DLG   300
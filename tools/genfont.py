@@ -27,6 +27,11 @@ Run from the repository root:
 
     python tools/genfont.py
 
+or, to write the tables again from the glyphs already in them - after a
+change to the code emitted, on a machine without Pillow or DejaVu:
+
+    python tools/genfont.py --reemit
+
 The character set is the union of ASCII and every code page table in
 CodePages.cpp, so anything ESC t can select has a glyph.
 """
@@ -36,7 +41,10 @@ import re
 import sys
 import unicodedata
 
-from PIL import Image, ImageDraw, ImageFont
+try:
+    from PIL import Image, ImageDraw, ImageFont
+except ImportError:
+    Image = None  # enough for --reemit; rasterizing checks for it
 
 FONT_CANDIDATES = [
     "C:/Windows/Fonts/DejavuSansMono-5m7L.ttf",
@@ -281,6 +289,8 @@ def load_font(size):
     fixed pitch font - and the glyph has to fit between the top of the cell and
     its last row once it is stood on the baseline.
     """
+    if Image is None:
+        sys.exit("Pillow is needed to rasterize the glyphs (pip install Pillow)")
     for path in FONT_CANDIDATES:
         if os.path.exists(path):
             font = ImageFont.truetype(path, size)
@@ -388,6 +398,7 @@ const unsigned short *Font%(letter)sGlyph(wchar_t ch);
 
 SOURCE_HEAD = """#include "%(basename)s.h"
 
+#include <algorithm>
 #include <cstddef>
 
 // Generated by tools/genfont.py - do not edit by hand.
@@ -401,32 +412,31 @@ SOURCE_HEAD = """#include "%(basename)s.h"
 
 namespace {
 
-struct Glyph {
-  unsigned short code;
-  unsigned short rows[FONT_%(letter)s_HEIGHT];
-};
-
-// Sorted by code point: Font%(letter)sGlyph binary searches it.
-const Glyph kGlyphs[] = {
+// The rows of every glyph, in code point order. Each glyph starts a 64 byte
+// line of its own and its %(h)d rows fit in it, so drawing one touches a
+// single cache line; the words past the last row are padding.
+alignas(64) const unsigned short kRows[][32] = {
 """
 
 SOURCE_TAIL = """};
 
-const size_t kGlyphCount = sizeof(kGlyphs) / sizeof(kGlyphs[0]);
+// The page tables below point into kRows: the glyph of U+hhll is entry ll of
+// the page for hh, null when there is none, and the page of a high byte with
+// no glyphs at all is the empty one.
+const unsigned short *const kNoGlyphs[256] = {};
+
+%(pages)s
+// By the high byte of the code point. Entry 256, the empty page, stands for
+// every code point past U+FFFF.
+const unsigned short *const *const kPages[257] = {
+%(page_table)s};
 
 } // namespace
 
 const unsigned short *Font%(letter)sGlyph(wchar_t ch) {
+  // Two loads and no branch: min() clamps the page without one.
   unsigned int code = (unsigned int)ch;
-  if (code > 0xFFFF) return NULL;
-  size_t lo = 0, hi = kGlyphCount;
-  while (lo < hi) {
-    size_t mid = lo + (hi - lo) / 2;
-    if (kGlyphs[mid].code < code) lo = mid + 1;
-    else hi = mid;
-  }
-  if (lo < kGlyphCount && kGlyphs[lo].code == code) return kGlyphs[lo].rows;
-  return NULL;
+  return kPages[std::min(code >> 8, 256u)][code & 0xFF];
 }
 """
 
@@ -463,26 +473,51 @@ def to_words(g):
     return words
 
 
+def emit_pages(glyphs):
+    """The page of every high byte that has glyphs, and the table of them."""
+    pages = {}
+    for i, (cp, _) in enumerate(glyphs):
+        pages.setdefault(cp >> 8, [None] * 256)[cp & 0xFF] = i
+
+    out = []
+    for hi in sorted(pages):
+        out.append("const unsigned short *const kPage%02X[256] = {" % hi)
+        for lo, i in enumerate(pages[hi]):
+            if lo % 8 == 0:
+                out.append("\n    ")
+            out.append("NULL, " if i is None else "kRows[%d], " % i)
+        out.append("\n};\n\n")
+
+    table = []
+    for hi in range(257):
+        if hi % 8 == 0:
+            table.append("    " if hi == 0 else "\n    ")
+        table.append("kPage%02X, " % hi if hi in pages else "kNoGlyphs, ")
+    table.append("\n")
+    return "".join(out), "".join(table)
+
+
 def emit(spec, glyphs):
     fields = dict(spec, msb=spec["w"] - 1, baseline=BASELINE)
+    fields["pages"], fields["page_table"] = emit_pages(glyphs)
 
     with open(os.path.join(ROOT, spec["basename"] + ".h"), "w",
               encoding="utf-8", newline="\n") as f:
         f.write(HEADER % fields)
 
     out = [SOURCE_HEAD % fields]
-    for cp, words in glyphs:
+    for i, (cp, words) in enumerate(glyphs):
         try:
             label = unicodedata.name(chr(cp))
         except ValueError:
             label = "<unnamed>"
-        out.append("    // U+%04X %s\n" % (cp, label))
-        out.append("    {0x%04X, {" % cp)
-        for i, w in enumerate(words):
-            if i % 8 == 0:
+        out.append("    // %d: U+%04X %s\n" % (i, cp, label))
+        out.append("    {")
+        for j, w in enumerate(words):
+            if j % 8 == 0:
                 out.append("\n     ")
             out.append("0x%03X, " % w)
-        out.append("}},\n")
+        out.append("},\n")
     out.append(SOURCE_TAIL % fields)
 
     with open(os.path.join(ROOT, spec["basename"] + ".cpp"), "w",
@@ -490,6 +525,21 @@ def emit(spec, glyphs):
         f.write("".join(out))
 
 
+def read_back(spec):
+    """The glyphs as the last run wrote them, for --reemit."""
+    src = open(os.path.join(ROOT, spec["basename"] + ".cpp"), encoding="utf-8").read()
+    glyphs = []
+    # Each glyph is a comment naming its code point followed by its rows; an
+    # older table also repeats the code point first, hence the last rows only.
+    for m in re.finditer(r"// (?:\d+: )?U\+([0-9A-F]{4}) [^\n]*\n(.*?)\}\}?,\n",
+                         src, re.S):
+        words = [int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]+)", m.group(2))]
+        glyphs.append((int(m.group(1), 16), words[-spec["h"]:]))
+    if not glyphs:
+        sys.exit("no glyphs found in %s.cpp" % spec["basename"])
+    return glyphs
+
+
 def generate(spec, codes):
     set_cell(spec["w"], spec["h"])
     font, font_path = load_font(spec["size"])
@@ -518,6 +568,12 @@ def generate(spec, codes):
 
 
 def main():
+    if sys.argv[1:] == ["--reemit"]:
+        for spec in FONTS:
+            glyphs = read_back(spec)
+            emit(spec, glyphs)
+            print("Font %s: %d glyphs written again" % (spec["letter"], len(glyphs)))
+        return
     codes = charset()
     for spec in FONTS:
         generate(spec, codes)
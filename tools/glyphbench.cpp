@@ -0,0 +1,73 @@
+// Times FontAGlyph() and FontBGlyph(), the lookups the renderer makes for
+// every character it packs, on text shaped like a receipt and on code points
+// from all over the table.
+//
+// From the repository root:
+//
+//   g++ -O2 -std=c++17 -I. tools/glyphbench.cpp FontA12x24.cpp FontB10x24.cpp
+//       -o glyphbench
+//
+//   ./glyphbench [million lookups]
+//
+// To compare two versions of the tables, build it against each.
+
+#include "../FontA12x24.h"
+#include "../FontB10x24.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cwchar>
+#include <vector>
+
+// Looks up every character of `text` until `lookups` are done; returns ns per
+// lookup. Summing a row of each keeps the compiler from dropping them.
+static double Time(const unsigned short *(*glyph)(wchar_t),
+                   const std::vector<wchar_t> &text, long long lookups,
+                   unsigned long long *sum) {
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  size_t at = 0;
+  for (long long i = 0; i < lookups; ++i) {
+    const unsigned short *rows = glyph(text[at]);
+    if (rows) *sum += rows[12];
+    if (++at == text.size()) at = 0;
+  }
+  double seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start).count();
+  return seconds * 1e9 / lookups;
+}
+
+int main(int argc, char **argv) {
+  long long lookups = (argc > 1 ? atoll(argv[1]) : 100) * 1000000LL;
+  if (lookups <= 0) {
+    fprintf(stderr, "usage: glyphbench [million lookups]\n");
+    return 1;
+  }
+
+  // A receipt: mostly ASCII, the odd accented letter and a rule.
+  const wchar_t *receipt =
+      L"CAF\u00C9 S\u00C3O JO\u00C3O        Rua das Flores, 120\n"
+      L"2 x P\u00C3O DE QUEIJO             R$ 9,00\n"
+      L"1 x CAPPUCCINO                  R$ 12,50\n"
+      L"\u2500\u2500\u2500\u2500\u2500\u2500\u2500\u2500\u2500\u2500"
+      L"\u2500\u2500\u2500\u2500\u2500\u2500\u2500\u2500\u2500\u2500\n"
+      L"TOTAL                           R$ 21,50\n";
+  std::vector<wchar_t> text(receipt, receipt + wcslen(receipt));
+
+  // Every code point of the Basic Multilingual Plane, in a scattered order,
+  // most of which have no glyph.
+  std::vector<wchar_t> scattered(0x10000);
+  for (unsigned int i = 0; i < 0x10000; ++i)
+    scattered[i] = (wchar_t)((i * 40503u) & 0xFFFF);
+
+  unsigned long long sum = 0;
+  printf("receipt text:  Font A %.2f ns, Font B %.2f ns per lookup\n",
+         Time(FontAGlyph, text, lookups, &sum),
+         Time(FontBGlyph, text, lookups, &sum));
+  printf("scattered BMP: Font A %.2f ns, Font B %.2f ns per lookup\n",
+         Time(FontAGlyph, scattered, lookups, &sum),
+         Time(FontBGlyph, scattered, lookups, &sum));
+  printf("(checksum %llu)\n", sum);
+  return 0;
+}
@@ -0,0 +1,100 @@
+// Parser throughput: MB/s through VirtualPrinter::ProcessData() for text
+// shaped like a receipt and for long lines, fed in network-sized chunks.
+//
+// From the repository root:
+//
+//   g++ -O2 -std=c++17 -I. tools/parsebench.cpp VirtualPrinter.cpp
+//       PaperArchive.cpp Barcode.cpp CodePages.cpp QRCode.cpp -lpthread
+//       -o parsebench
+//
+//   ./parsebench [MB per stream] [chunk bytes]
+//
+// The paper is cleared between passes, so what is timed is the parse and the
+// elements it makes, not a roll growing without bound.
+
+#include "../VirtualPrinter.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// Bytes of paper text processed before the paper is cleared again.
+static const size_t PASS_BYTES = 1 << 20;
+
+// 48-column receipt lines: item, quantity and price, with the odd bold title
+// and a rule, like the streams POS software sends.
+static std::string ReceiptText(size_t bytes) {
+  std::string text;
+  char line[64];
+  for (int n = 0; text.size() < bytes; ++n) {
+    if (n % 40 == 0) {
+      text += "\x1b" "E\x01" "CAFE SAO JOAO - RUA DAS FLORES, 120\n";
+      text.append("\x1b" "E\x00", 3); // bold off
+      text.append(47, '-');
+      text += '\n';
+    }
+    snprintf(line, sizeof(line), "%-28.28s %3d x %6d.%02d %5d.%02d\n",
+             "PAO DE QUEIJO TRADICIONAL", 1 + n % 9, 3 + n % 17, n % 100,
+             (1 + n % 9) * (3 + n % 17), (n * 7) % 100);
+    text += line;
+  }
+  text.resize(bytes);
+  return text;
+}
+
+// Lines of 200 to 600 printable characters: logs and reports sent to a
+// printer with no column limit.
+static std::string LongLineText(size_t bytes) {
+  static const char words[] =
+      "the quick brown fox jumps over the lazy dog 0123456789 ";
+  std::string text;
+  for (int n = 0; text.size() < bytes; ++n) {
+    size_t length = 200 + (size_t)(n * 37) % 401;
+    for (size_t i = 0; i < length; ++i)
+      text += words[(n + i) % (sizeof(words) - 1)];
+    text += '\n';
+  }
+  text.resize(bytes);
+  return text;
+}
+
+// Feeds `text` through a fresh printer `chunk` bytes at a time; returns MB/s.
+static double Run(const std::string &text, int columns, size_t chunk) {
+  VirtualPrinter printer;
+  printer.SetMaxColumns(columns);
+  const unsigned char *data = (const unsigned char *)text.data();
+  double seconds = 0;
+  for (size_t pass = 0; pass < text.size(); pass += PASS_BYTES) {
+    size_t end = pass + PASS_BYTES < text.size() ? pass + PASS_BYTES
+                                                 : text.size();
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    for (size_t at = pass; at < end; at += chunk) {
+      printer.ProcessData(data + at, (int)(end - at < chunk ? end - at : chunk));
+    }
+    seconds += std::chrono::duration<double>(
+                   std::chrono::steady_clock::now() - start).count();
+    printer.Clear();
+  }
+  return text.size() / 1e6 / seconds;
+}
+
+int main(int argc, char **argv) {
+  long long megabytes = argc > 1 ? atoll(argv[1]) : 8;
+  long long chunk = argc > 2 ? atoll(argv[2]) : 4096;
+  if (megabytes <= 0 || chunk <= 0) {
+    fprintf(stderr, "usage: parsebench [MB per stream] [chunk bytes]\n");
+    return 1;
+  }
+  size_t bytes = (size_t)megabytes << 20;
+
+  std::string receipt = ReceiptText(bytes);
+  std::string longLines = LongLineText(bytes);
+  printf("48-column receipt lines: %7.1f MB/s\n",
+         Run(receipt, 48, (size_t)chunk));
+  printf("200-600 char lines:      %7.1f MB/s (no column limit)\n",
+         Run(longLines, 0, (size_t)chunk));
+  return 0;
+}
@@ -0,0 +1,211 @@
+// Runs a whole store's printers in one process, without a window: one
+// virtual printer per port listed in a farm file (see PrinterFarm.h), all
+// served by the same network reactor. Prints what each printer has received
+// every few seconds until stopped with Ctrl+C.
+//
+// From the repository root:
+//
+//   SOURCES="PrinterFarm.cpp Network.cpp VirtualPrinter.cpp PaperArchive.cpp
+//            Barcode.cpp CodePages.cpp QRCode.cpp"
+//   g++ -O2 -std=c++17 -I. tools/printerfarm.cpp $SOURCES -lpthread
+//       -o printerfarm
+//
+//   ./printerfarm farm.txt [-a archive directory] [-i seconds] [--io-uring]
+//                [limits] [fault options]
+//
+// With -a, each printer keeps the receipts that leave its paper in
+// <directory>/<name>.bin. "last job" is how long the printer's last receipt
+// would take to print, for the printers given a speed in the farm file.
+//
+// The limits keep one terminal from taking the farm from the others:
+//
+//   --max-connections n[:queue]  serve n at once, the next queue wait
+//   --idle-timeout seconds       close connections silent for that long
+//   --session-buffer KB          the most one connection's parser may hold
+//
+// The fault options make the printers misbehave, to test how a point of
+// sale copes (see NetworkServer::FaultPlan):
+//
+//   --fault-delay ms[:jitter]    wait before every chunk read
+//   --fault-stall bytes:ms       stop reading once a connection sent bytes
+//   --fault-reset percent[:bytes]  reset connections within their first bytes
+//   --fault-paper-out percent    answer status requests with the paper out
+//   --fault-refuse percent       reset connections as soon as accepted
+//   --fault-seed n               another repeatable run (default 1)
+
+#include "../PrinterFarm.h"
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::atomic<bool> g_stop(false);
+
+static void OnSignal(int) { g_stop = true; }
+
+// "a" or "a:b", for the fault options; b is left alone when not given.
+static bool ParsePair(const char *text, long long &a, long long &b) {
+  char *end;
+  a = strtoll(text, &end, 10);
+  if (end == text || a < 0) return false;
+  if (*end == ':') {
+    const char *rest = end + 1;
+    b = strtoll(rest, &end, 10);
+    if (end == rest || b < 0) return false;
+  }
+  return *end == 0;
+}
+
+static void PrintStats(PrinterFarm &farm, bool faults, bool limited) {
+  std::vector<PrinterFarm::PrinterStats> stats = farm.GetStats();
+  printf("%-16s %5s %8s %5s %10s %6s %9s %9s %7s %9s\n", "printer", "port",
+         "conns", "open", "received", "jobs", "paper", "buffered", "stalls",
+         "last job");
+  for (size_t i = 0; i < stats.size(); ++i) {
+    const PrinterFarm::PrinterStats &s = stats[i];
+    printf("%-16s %5d %8llu %5d %8.1fMB %6zu %7.1fMB %7.1fKB %7llu %8.2fs\n",
+           s.name.c_str(), s.port, s.connections, s.openConnections,
+           s.bytesReceived / 1048576.0, s.jobs,
+           (s.paper.bytes + s.paper.liveBytes) / 1048576.0,
+           s.ingest.bufferedBytes / 1024.0, s.ingest.stalls,
+           s.lastJobPrintMicros / 1e6);
+  }
+  if (limited) {
+    NetworkServer::ConnectionStats c = farm.GetConnectionStats();
+    unsigned long long caps = 0;
+    for (size_t i = 0; i < stats.size(); ++i) {
+      caps += stats[i].ingest.bufferCaps;
+    }
+    printf("limits: %d open, %d waiting, %llu queued, %llu refused, "
+           "%llu idle closed, %llu buffer caps\n",
+           c.open, c.waiting, c.queued, c.refused, c.idleClosed, caps);
+  }
+  if (faults) {
+    NetworkServer::FaultStats f = farm.GetFaultStats();
+    printf("faults: %llu delays, %llu stalls, %llu resets, %llu paper out, "
+           "%llu refused\n",
+           f.delays, f.stalls, f.resets, f.paperOuts, f.refused);
+  }
+  printf("\n");
+  fflush(stdout);
+}
+
+int main(int argc, char **argv) {
+  std::string configPath, archiveDir;
+  int intervalSeconds = 10;
+  bool ioUring = false;
+  NetworkServer::Limits limits;
+  long long sessionBufferKB = 0;
+  bool limited = false;
+  NetworkServer::FaultPlan faults;
+  bool faulty = false;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    long long a = 0, b = 0;
+    bool fault = arg.compare(0, 8, "--fault-") == 0;
+    if (fault && (i + 1 == argc || !ParsePair(argv[i + 1], a, b))) {
+      fprintf(stderr, "%s needs a number or two, as in 10:5\n", argv[i]);
+      return 1;
+    }
+    if (arg == "-a" && i + 1 < argc) {
+      archiveDir = argv[++i];
+    } else if (arg == "-i" && i + 1 < argc) {
+      intervalSeconds = atoi(argv[++i]);
+    } else if (arg == "--io-uring") {
+      ioUring = true;
+    } else if (arg == "--max-connections" && i + 1 < argc) {
+      long long n = 0, queue = 0;
+      if (!ParsePair(argv[++i], n, queue)) {
+        fprintf(stderr, "--max-connections needs n or n:queue\n");
+        return 1;
+      }
+      limits.maxConnections = (int)n;
+      limits.queueLength = (int)queue;
+      limited = true;
+    } else if (arg == "--idle-timeout" && i + 1 < argc) {
+      limits.idleTimeoutMs = atoi(argv[++i]) * 1000;
+      limited = true;
+    } else if (arg == "--session-buffer" && i + 1 < argc) {
+      sessionBufferKB = atoll(argv[++i]);
+      limited = true;
+    } else if (arg == "--fault-delay") {
+      faults.readDelayMs = (int)a;
+      faults.readJitterMs = (int)b;
+    } else if (arg == "--fault-stall") {
+      faults.stallAfterBytes = a;
+      faults.stallMs = (int)b;
+    } else if (arg == "--fault-reset") {
+      faults.resetPercent = (int)a;
+      if (b > 0) faults.resetWithinBytes = b;
+    } else if (arg == "--fault-paper-out") {
+      faults.paperOutPercent = (int)a;
+    } else if (arg == "--fault-refuse") {
+      faults.refusePercent = (int)a;
+    } else if (arg == "--fault-seed") {
+      faults.seed = (unsigned long long)a;
+    } else if (configPath.empty() && arg[0] != '-') {
+      configPath = arg;
+    } else {
+      fprintf(stderr, "unknown argument: %s\n", argv[i]);
+      return 1;
+    }
+    if (fault) {
+      faulty = true;
+      ++i;
+    }
+  }
+  if (configPath.empty()) {
+    fprintf(stderr, "usage: printerfarm farm.txt [-a archive directory] "
+                    "[-i seconds] [--io-uring] [limits] "
+                    "[--fault-... n[:m]]\n");
+    return 1;
+  }
+
+  std::ifstream in(configPath);
+  if (!in) {
+    fprintf(stderr, "cannot read %s\n", configPath.c_str());
+    return 1;
+  }
+  std::vector<PrinterFarm::PrinterConfig> printers;
+  std::string error;
+  if (!PrinterFarm::ParseConfig(in, printers, error)) {
+    fprintf(stderr, "%s: %s\n", configPath.c_str(), error.c_str());
+    return 1;
+  }
+
+  // Before Start(), so that a stop asked for while starting is not missed.
+  std::signal(SIGINT, OnSignal);
+  std::signal(SIGTERM, OnSignal);
+
+  PrinterFarm farm;
+  if (ioUring) {
+    farm.SetBackend(NetworkServer::BACKEND_IO_URING);
+  }
+  farm.SetLimits(limits);
+  farm.SetSessionBufferLimit((size_t)sessionBufferKB * 1024);
+  farm.SetFaultPlan(faults);
+  if (!farm.Start(printers, archiveDir)) {
+    fprintf(stderr, "cannot start: a port is taken or listed twice, or an "
+                    "archive cannot be opened\n");
+    return 1;
+  }
+  printf("%zu printers listening\n\n", printers.size());
+  std::chrono::steady_clock::time_point next = std::chrono::steady_clock::now();
+  while (!g_stop) {
+    if (intervalSeconds > 0 && std::chrono::steady_clock::now() >= next) {
+      PrintStats(farm, faulty, limited);
+      next += std::chrono::seconds(intervalSeconds);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+
+  farm.Stop();
+  PrintStats(farm, faulty, limited);
+  return 0;
+}
@@ -0,0 +1,188 @@
+// Renders ESC/POS captures to images without a window, with the portable
+// rasterizer in PaperRaster.cpp: for batch rendering on a box with no
+// display, and for timing the renderer.
+//
+// From the repository root:
+//
+//   SOURCES="PaperRaster.cpp FontA12x24.cpp FontB10x24.cpp VirtualPrinter.cpp
+//            PaperArchive.cpp Barcode.cpp CodePages.cpp QRCode.cpp"
+//   g++ -O2 -std=c++17 -I. tools/renderpaper.cpp $SOURCES -lpthread
+//       -o renderpaper
+//
+//   ./renderpaper capture.bin... [-o paper.pbm] [--red] [--cut-marks]
+//                 [--font-size px] [--columns n] [--bench times]
+//
+// The captures are printed one after the other on one roll, which is then
+// written as a PBM, or with --red as a PPM with the red text in red. At the
+// default font size one pixel is one dot, at 203 dpi. --bench renders the
+// whole roll that many times, then as many 700-row windows onto it, then
+// scrolls a 700-row window down the roll and back through the tile cache,
+// and prints how long each took.
+
+#include "../PaperRaster.h"
+#include "../VirtualPrinter.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+static bool WritePbm(const char *path, const PaperImage &image) {
+  FILE *f = fopen(path, "wb");
+  if (!f) return false;
+  fprintf(f, "P4\n%d %d\n", image.width, image.height);
+  int rowBytes = (image.width + 7) / 8;
+  for (int y = 0; y < image.height; ++y) {
+    fwrite(&image.black[(size_t)y * image.stride], 1, rowBytes, f);
+  }
+  return fclose(f) == 0;
+}
+
+static bool WritePpm(const char *path, const PaperImage &image) {
+  FILE *f = fopen(path, "wb");
+  if (!f) return false;
+  fprintf(f, "P6\n%d %d\n255\n", image.width, image.height);
+  std::vector<unsigned char> row((size_t)image.width * 3);
+  for (int y = 0; y < image.height; ++y) {
+    for (int x = 0; x < image.width; ++x) {
+      unsigned char *p = &row[(size_t)x * 3];
+      // Black over red, as the ink shows on the paper.
+      bool black = image.Black(x, y), red = image.Red(x, y);
+      p[0] = black ? 0 : 255;
+      p[1] = p[2] = black || red ? 0 : 255;
+    }
+    fwrite(row.data(), 1, row.size(), f);
+  }
+  return fclose(f) == 0;
+}
+
+int main(int argc, char **argv) {
+  std::vector<std::string> inputs;
+  std::string output = "paper.pbm";
+  RasterOptions options;
+  options.cutMarks = false;
+  int columns = 0;
+  int benchRuns = 0;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "-o" && i + 1 < argc) {
+      output = argv[++i];
+    } else if (arg == "--red") {
+      options.twoColour = true;
+    } else if (arg == "--cut-marks") {
+      options.cutMarks = true;
+    } else if (arg == "--font-size" && i + 1 < argc) {
+      options.fontSize = atoi(argv[++i]);
+    } else if (arg == "--columns" && i + 1 < argc) {
+      columns = atoi(argv[++i]);
+    } else if (arg == "--bench" && i + 1 < argc) {
+      benchRuns = atoi(argv[++i]);
+    } else if (arg[0] != '-') {
+      inputs.push_back(arg);
+    } else {
+      fprintf(stderr, "unknown argument: %s\n", argv[i]);
+      return 1;
+    }
+  }
+  if (inputs.empty()) {
+    fprintf(stderr, "usage: renderpaper capture.bin... [-o paper.pbm] [--red] "
+                    "[--cut-marks] [--font-size px] [--columns n] "
+                    "[--bench times]\n");
+    return 1;
+  }
+
+  VirtualPrinter printer;
+  if (columns > 0) {
+    printer.SetMaxColumns(columns);
+    options.columns = columns; // the paper is as wide, as in the apps
+  }
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    std::ifstream in(inputs[i].c_str(), std::ios::binary);
+    if (!in) {
+      fprintf(stderr, "cannot read %s\n", inputs[i].c_str());
+      return 1;
+    }
+    std::vector<unsigned char> data((std::istreambuf_iterator<char>(in)),
+                                    std::istreambuf_iterator<char>());
+    if (!data.empty()) printer.ProcessData(data.data(), (int)data.size());
+  }
+  ElementList elements = printer.GetElements();
+
+  PaperImage image;
+  image.height = -1; // all of it
+  PaperLayout layout = RenderPaper(elements.Elements(), options, &image);
+
+  if (benchRuns > 0) {
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    for (int i = 0; i < benchRuns; ++i) {
+      PaperImage again;
+      again.height = layout.height;
+      RenderPaper(elements.Elements(), options, &again);
+    }
+    double seconds = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - start).count();
+    size_t glyphs = 0;
+    for (size_t i = 0; i < elements.size(); ++i)
+      glyphs += elements[i].TextLength();
+    printf("%zu elements, %dx%d pixels: %.3f ms per render, %.1f Mpixel/s, "
+           "%.2f M glyphs/s\n",
+           elements.size(), layout.width, layout.height,
+           seconds * 1000 / benchRuns,
+           (double)layout.width * layout.height * benchRuns / seconds / 1e6,
+           (double)glyphs * benchRuns / seconds / 1e6);
+
+    // What a window showing 700 rows of the roll costs once the paper is
+    // laid out: only the lines in view are visited.
+    PaperLayoutIndex index;
+    index.Update(elements.Elements(), options, 0);
+    const int windowRows = 700;
+    int positions = layout.height > windowRows ? layout.height - windowRows : 1;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < benchRuns; ++i) {
+      PaperImage window;
+      window.top = (int)((long long)i * 7919 % positions);
+      window.height = windowRows;
+      index.Draw(elements.Elements(), options, &window);
+    }
+    seconds = std::chrono::duration<double>(
+                  std::chrono::steady_clock::now() - start).count();
+    printf("%zu lines, %d rows in view: %.3f ms per paint\n", index.Lines(),
+           windowRows, seconds * 1000 / benchRuns);
+
+    // Scrolling, as the wheel does it: 60 rows a frame, all the way down and
+    // back up, so that the way back finds the tiles drawn on the way down.
+    PaperTileCache tiles;
+    const int scrollStep = 60;
+    int frames = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < benchRuns; ++i) {
+      for (int pass = 0; pass < 2; ++pass) {
+        for (int top = 0; top < positions; top += scrollStep, ++frames) {
+          PaperImage window;
+          window.top = pass == 0 ? top : positions - 1 - top;
+          window.height = windowRows;
+          tiles.Draw(index, elements.Elements(), options, &window);
+        }
+      }
+    }
+    seconds = std::chrono::duration<double>(
+                  std::chrono::steady_clock::now() - start).count();
+    printf("%d frames scrolled: %.3f ms per frame, %llu tiles drawn, "
+           "%zu kept in %zu KB\n",
+           frames, seconds * 1000 / frames, tiles.Drawn(), tiles.Tiles(),
+           tiles.Bytes() / 1024);
+  }
+
+  bool written = options.twoColour ? WritePpm(output.c_str(), image)
+                                   : WritePbm(output.c_str(), image);
+  if (!written) {
+    fprintf(stderr, "cannot write %s\n", output.c_str());
+    return 1;
+  }
+  printf("%s: %dx%d\n", output.c_str(), image.width, image.height);
+  return 0;
+}